@@ -0,0 +1,10 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "GameMode/SikGameInstance.h"
+
+#include "GameMode/SikOnlineSession.h"
+
+TSubclassOf<UOnlineSession> USikGameInstance::GetOnlineSessionClass()
+{
+	return USikOnlineSession::StaticClass();
+}
@@ -2,11 +2,19 @@
 
 #include "GameMode/SikLobbyGameMode.h"
 
+#include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "GameMode/SikLobbyGameState.h"
+#include "GameMode/SikLobbyPlayerState.h"
+#include "Subsystem/SikSubsystem.h"
 #include "System/SikLogger.h"
 
 ASikLobbyGameMode::ASikLobbyGameMode(const FObjectInitializer& ObjectInitializer)
 {
 	bUseSeamlessTravel = true;
+	GameStateClass = ASikLobbyGameState::StaticClass();
+	PlayerStateClass = ASikLobbyPlayerState::StaticClass();
 }
 
 FOnLobbyPlayersChanged ASikLobbyGameMode::OnLobbyPlayersChangedGlobal;
@@ -17,13 +25,37 @@ void ASikLobbyGameMode::PostLogin(APlayerController* NewPlayer)
 
 	LOG_INFO(TEXT("Player joined lobby"));
 
+	/** Host's own controller logging in ends the host flow, clients end theirs once the lobby map has loaded */
+	if (NewPlayer && NewPlayer->IsLocalController() && GetGameInstance())
+	{
+		if (USikSubsystem* SikSubsystem = GetGameInstance()->GetSubsystem<USikSubsystem>())
+		{
+			SikSubsystem->GetSessionMetrics().EndSpan(SIK_SPAN_SERVERTRAVEL, true);
+			SikSubsystem->GetSessionMetrics().EndSpan(SIK_SPAN_HOSTGAME, true);
+		}
+	}
+	/** Remote players who joined without reserving still take a slot on the reservation beacon */
+	else if (USikSubsystem* SikSubsystem = GetGameInstance() ? GetGameInstance()->GetSubsystem<USikSubsystem>() : nullptr; 
+		SikSubsystem && NewPlayer && NewPlayer->PlayerState)
+	{
+		SikSubsystem->HandleLobbyPlayerLogin(NewPlayer->PlayerState->GetUniqueId());
+	}
+
 	CurrentLobbyPlayers += 1;
 	
 	OnLobbyPlayersChangedGlobal.Broadcast(CurrentLobbyPlayers);
+	
+	NotifyDedicatedServer();
 }
 
 void ASikLobbyGameMode::Logout(AController* ExitingController)
 {
+	if (USikSubsystem* SikSubsystem = GetGameInstance() ? GetGameInstance()->GetSubsystem<USikSubsystem>() : nullptr; 
+		SikSubsystem && ExitingController && ExitingController->PlayerState)
+	{
+		SikSubsystem->HandleLobbyPlayerLogout(ExitingController->PlayerState->GetUniqueId());
+	}
+	
 	Super::Logout(ExitingController);
 
 	LOG_INFO(TEXT("Player left lobby"));
@@ -31,4 +63,19 @@ void ASikLobbyGameMode::Logout(AController* ExitingController)
 	CurrentLobbyPlayers -= 1;
 	
 	OnLobbyPlayersChangedGlobal.Broadcast(CurrentLobbyPlayers);
+	
+	NotifyDedicatedServer();
+}
+
+void ASikLobbyGameMode::NotifyDedicatedServer() const
+{
+	if (GetNetMode() != NM_DedicatedServer || !GetGameInstance())
+	{
+		return;
+	}
+	
+	if (USikSubsystem* SikSubsystem = GetGameInstance()->GetSubsystem<USikSubsystem>())
+	{
+		SikSubsystem->HandleDedicatedServerLobbyPlayersChanged(CurrentLobbyPlayers);
+	}
 }
@@ -0,0 +1,120 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "GameMode/SikLobbyGameState.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameMode/SikLobbyPlayerState.h"
+#include "Net/UnrealNetwork.h"
+#include "Subsystem/SikSubsystem.h"
+#include "System/SikLogger.h"
+#include "TimerManager.h"
+
+void ASikLobbyGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ASikLobbyGameState, PrefetchMapPath);
+}
+
+void ASikLobbyGameState::SetPrefetchMapPath(const FString& InMapPath)
+{
+	if (!HasAuthority() || PrefetchMapPath == InMapPath)
+	{
+		return;
+	}
+
+	LOG_INFO(TEXT("Lobby prefetching %s"), *InMapPath);
+
+	const FString OldPrefetchMapPath = PrefetchMapPath;
+	PrefetchMapPath = InMapPath;
+
+	/** RepNotify only runs on clients, the listen server host prefetches as well */
+	OnRep_PrefetchMapPath(OldPrefetchMapPath);
+}
+
+int32 ASikLobbyGameState::GetNumPlayersReadyForMap() const
+{
+	int32 NumReady = 0;
+
+	for (const APlayerState* PlayerState : PlayerArray)
+	{
+		if (const ASikLobbyPlayerState* LobbyPlayerState = Cast<ASikLobbyPlayerState>(PlayerState))
+		{
+			const ESikMapPrefetchState State = LobbyPlayerState->GetMapPrefetchState();
+			NumReady += (State == ESikMapPrefetchState::Ready || State == ESikMapPrefetchState::Skipped || 
+				State == ESikMapPrefetchState::Failed) ? 1 : 0;
+		}
+	}
+
+	return NumReady;
+}
+
+void ASikLobbyGameState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PrefetchReportTimer);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASikLobbyGameState::OnRep_PrefetchMapPath(const FString& OldPrefetchMapPath)
+{
+	const UGameInstance* GameInstance = GetGameInstance();
+	USikSubsystem* SikSubsystem = GameInstance ? GameInstance->GetSubsystem<USikSubsystem>() : nullptr;
+
+	/** Host picked another map, the world of the one it dropped would otherwise be held until the travel */
+	if (SikSubsystem && !OldPrefetchMapPath.IsEmpty() && OldPrefetchMapPath != PrefetchMapPath)
+	{
+		SikSubsystem->ReleasePreloadedMap(OldPrefetchMapPath);
+	}
+
+	if (PrefetchMapPath.IsEmpty())
+	{
+		return;
+	}
+
+	if (SikSubsystem)
+	{
+		SikSubsystem->PreloadTravelMaps(PrefetchMapPath);
+	}
+
+	/** Dedicated servers have no player to report for */
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		GetWorldTimerManager().SetTimer(PrefetchReportTimer, this, &ThisClass::ReportLocalMapPrefetch, 
+			PrefetchReportInterval, true, 0.f);
+	}
+}
+
+void ASikLobbyGameState::ReportLocalMapPrefetch()
+{
+	const UGameInstance* GameInstance = GetGameInstance();
+	USikSubsystem* SikSubsystem = GameInstance ? GameInstance->GetSubsystem<USikSubsystem>() : nullptr;
+	if (!SikSubsystem)
+	{
+		GetWorldTimerManager().ClearTimer(PrefetchReportTimer);
+		return;
+	}
+
+	float Progress = 0.f;
+	const ESikMapPrefetchState State = SikSubsystem->GetMapPreloadState(PrefetchMapPath, Progress);
+
+	/** Player state of a joining client may replicate after the game state, keep polling until it shows up */
+	const APlayerController* PC = GetGameInstance()->GetFirstLocalPlayerController(GetWorld());
+	ASikLobbyPlayerState* LocalPlayerState = PC ? PC->GetPlayerState<ASikLobbyPlayerState>() : nullptr;
+	if (!LocalPlayerState)
+	{
+		return;
+	}
+
+	LocalPlayerState->ReportMapPrefetch(State, Progress);
+
+	if (State == ESikMapPrefetchState::Ready || State == ESikMapPrefetchState::Failed || State == ESikMapPrefetchState::Skipped)
+	{
+		GetWorldTimerManager().ClearTimer(PrefetchReportTimer);
+	}
+}
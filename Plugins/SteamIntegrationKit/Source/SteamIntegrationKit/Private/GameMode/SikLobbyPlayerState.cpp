@@ -0,0 +1,55 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "GameMode/SikLobbyPlayerState.h"
+
+#include "Engine/World.h"
+#include "GameMode/SikLobbyGameState.h"
+#include "Net/UnrealNetwork.h"
+#include "System/SikLogger.h"
+
+void ASikLobbyPlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ASikLobbyPlayerState, MapPrefetchState);
+	DOREPLIFETIME(ASikLobbyPlayerState, MapPrefetchPercent);
+}
+
+void ASikLobbyPlayerState::ReportMapPrefetch(const ESikMapPrefetchState InState, const float InProgress)
+{
+	const uint8 Percent = static_cast<uint8>(FMath::Clamp(FMath::FloorToInt32(InProgress * 100.f), 0, 100));
+	if (InState == LastReportedState && Percent == LastReportedPercent)
+	{
+		return;
+	}
+
+	LastReportedState = InState;
+	LastReportedPercent = Percent;
+
+	ServerReportMapPrefetch(InState, Percent);
+}
+
+void ASikLobbyPlayerState::ServerReportMapPrefetch_Implementation(const ESikMapPrefetchState InState, const uint8 InPercent)
+{
+	if (InState != MapPrefetchState && InState != ESikMapPrefetchState::Loading)
+	{
+		LOG_INFO(TEXT("%s map prefetch %s"), *GetPlayerName(), *UEnum::GetValueAsString(InState));
+	}
+
+	MapPrefetchState = InState;
+	MapPrefetchPercent = FMath::Min<uint8>(InPercent, 100);
+
+	/** RepNotify only runs on clients, the listen server host refreshes as well */
+	OnRep_MapPrefetch();
+}
+
+void ASikLobbyPlayerState::OnRep_MapPrefetch()
+{
+	if (const UWorld* World = GetWorld())
+	{
+		if (ASikLobbyGameState* LobbyGameState = World->GetGameState<ASikLobbyGameState>())
+		{
+			LobbyGameState->OnMapPrefetchChanged.Broadcast(this);
+		}
+	}
+}
@@ -0,0 +1,19 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "GameMode/SikOnlineSession.h"
+
+#include "Engine/GameInstance.h"
+#include "Subsystem/SikSubsystem.h"
+
+void USikOnlineSession::HandleDisconnect(UWorld* World, UNetDriver* NetDriver)
+{
+	const UGameInstance* GameInstance = GetTypedOuter<UGameInstance>();
+	USikSubsystem* SikSubsystem = GameInstance ? GameInstance->GetSubsystem<USikSubsystem>() : nullptr;
+	
+	if (SikSubsystem && SikSubsystem->DeferDisconnect(World, NetDriver))
+	{
+		return;
+	}
+	
+	Super::HandleDisconnect(World, NetDriver);
+}
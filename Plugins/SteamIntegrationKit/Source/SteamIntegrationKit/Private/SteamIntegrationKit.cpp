@@ -2,17 +2,32 @@
 
 #include "SteamIntegrationKit.h"
 
+#include "System/SikLogger.h"
+#include "Tests/SikBenchmark.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
 #define LOCTEXT_NAMESPACE "FSteamIntegrationKitModule"
 
 void FSteamIntegrationKitModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	SikLog::StartSink();
+	
+#if WITH_DEV_AUTOMATION_TESTS
+	/** As early as the module can, before the game starts allocating on its worker threads */
+	if (FParse::Param(FCommandLine::Get(), TEXT("SikBenchmark")))
+	{
+		SikBenchmark::InstallAllocationCounter();
+	}
+#endif
 }
 
 void FSteamIntegrationKitModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	SikLog::StopSink();
 }
 
 #undef LOCTEXT_NAMESPACE
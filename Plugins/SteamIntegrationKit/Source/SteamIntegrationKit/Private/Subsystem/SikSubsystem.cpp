@@ -4,18 +4,73 @@
 
 #include "OnlineSessionSettings.h"
 #include "OnlineSubsystem.h"
+#include "OnlineSubsystemNames.h"
+#include "Interfaces/OnlineIdentityInterface.h"
 #include "Online/OnlineSessionNames.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
 #include "Engine/LocalPlayer.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "GameMode/SikLobbyGameMode.h"
+#include "GameMode/SikLobbyGameState.h"
+#include "OnlineBeaconHost.h"
+#include "PartyBeaconClient.h"
+#include "PartyBeaconHost.h"
+#include "TimerManager.h"
 #include "System/SikLogger.h"
+#include "System/SikSessionCode.h"
+#include "System/SikMockOnlineSession.h"
+#include "System/SikSessionListFilter.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
 #include "Engine/Engine.h"
+#include "Misc/App.h"
 #include "Misc/CoreDelegates.h"
+#include "Misc/CommandLine.h"
+#include "Algo/StableSort.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+#include "Misc/PackageName.h"
+#include "GameMapsSettings.h"
 
-DEFINE_LOG_CATEGORY(SteamIntegrationKitLog);
+#pragma region Session Query
+
+FSikSessionQuery FSikSessionQuery::FromFilter(const FSikCustomSessionSettings& InFilter)
+{
+	FSikSessionQuery Query;
+	Query.MapName = InFilter.MapName.IsEmpty() ? SETTING_FILTER_ANY : InFilter.MapName;
+	Query.GameMode = InFilter.GameMode.IsEmpty() ? SETTING_FILTER_ANY : InFilter.GameMode;
+	Query.Players = InFilter.Players.IsEmpty() ? SETTING_FILTER_ANY : InFilter.Players;
+	Query.bPublicOnly = true;
+	Query.MinOpenSlots = 1;
+	return Query;
+}
+
+bool FSikSessionQuery::IsFullySpecified() const
+{
+	return MapName != SETTING_FILTER_ANY && GameMode != SETTING_FILTER_ANY && Players != SETTING_FILTER_ANY;
+}
+
+bool FSikSessionQuery::operator==(const FSikSessionQuery& Other) const
+{
+	return MapName == Other.MapName && GameMode == Other.GameMode && Players == Other.Players &&
+		bPublicOnly == Other.bPublicOnly && MinOpenSlots == Other.MinOpenSlots;
+}
+
+bool FSikSessionQuery::Covers(const FSikSessionQuery& Other) const
+{
+	return *this == Other && MaxSearchResults >= Other.MaxSearchResults;
+}
+
+#pragma endregion Session Query
 
 USikSubsystem::USikSubsystem():
 	CreateSessionCompleteDelegate(FOnCreateSessionCompleteDelegate::CreateUObject(this, &ThisClass::OnCreateSessionCompleteCallback)),
 	FindSessionsCompleteDelegate(FOnFindSessionsCompleteDelegate::CreateUObject(this, &ThisClass::OnFindSessionsCompleteCallback)),
+	FindSessionByCodeCompleteDelegate(FOnFindSessionsCompleteDelegate::CreateUObject(this, &ThisClass::OnFindSessionByCodeCompleteCallback)),
 	JoinSessionCompleteDelegate(FOnJoinSessionCompleteDelegate::CreateUObject(this, &ThisClass::OnJoinSessionCompleteCallback)),
 	DestroySessionCompleteDelegate(FOnDestroySessionCompleteDelegate::CreateUObject(this, &ThisClass::OnDestroySessionCompleteCallback)),
 	StartSessionCompleteDelegate(FOnStartSessionCompleteDelegate::CreateUObject(this, &ThisClass::OnStartSessionCompleteCallback))
@@ -32,17 +87,97 @@ USikSubsystem::USikSubsystem():
 	{
 		LOG_ERROR(TEXT("USikSubsystem::USikSubsystem Online Subsystem does not support sessions!"));
 	}
-
-	FCoreDelegates::OnPreExit.AddUObject(this, &USikSubsystem::HandleAppExit);
 }
 
 void USikSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 	
+	/** Config is only loaded once constructed, the backend is picked here rather than in the constructor */
+	if (ShouldUseMockBackend())
+	{
+		FSikMockBackendSettings MockSettings;
+		MockSettings.Seed = MockBackendSeed;
+		MockSettings.LobbyCount = MockBackendLobbyCount;
+		MockSettings.Latency = MockBackendLatency;
+		MockSettings.LatencyJitter = MockBackendLatencyJitter;
+		MockSettings.FailureRate = MockBackendFailureRate;
+		MockSettings.MapNames = MockBackendMapNames;
+		MockSettings.GameModes = MockBackendGameModes;
+		MockSettings.Players = MockBackendPlayers;
+		
+		FParse::Value(FCommandLine::Get(), TEXT("SikMockSeed="), MockSettings.Seed);
+		FParse::Value(FCommandLine::Get(), TEXT("SikMockLobbies="), MockSettings.LobbyCount);
+		FParse::Value(FCommandLine::Get(), TEXT("SikMockFailureRate="), MockSettings.FailureRate);
+		
+		LOG_WARNING(TEXT("Using the mock session backend, seed %d"), MockSettings.Seed);
+		
+		MockSession = MakeShared<FSikMockOnlineSession, ESPMode::ThreadSafe>(MockSettings);
+		SessionInterface = MockSession;
+	}
+	else if (bStartInLanMode || FParse::Param(FCommandLine::Get(), TEXT("SikLan")))
+	{
+		if (const IOnlineSessionPtr LanSessionInterface = ResolveLanSessionInterface(LanSubsystemName))
+		{
+			LOG_WARNING(TEXT("Starting in LAN mode on %s"), *LanSubsystemName.ToString());
+			
+			SessionInterface = LanSessionInterface;
+			bLanMode = true;
+		}
+	}
+	
+	/** Binds the session events on whichever backend was picked above */
+	SetSessionInterface(SessionInterface);
+	
+	/** Bound here rather than in the constructor so the class default object never listens */
+	PreExitDelegateHandle = FCoreDelegates::OnPreExit.AddUObject(this, &USikSubsystem::HandleAppExit, true);
+	
 	if (GEngine)
 	{
-		GEngine->OnNetworkFailure().AddUObject(this, &USikSubsystem::HandleNetworkFailure);
+		NetworkFailureDelegateHandle = GEngine->OnNetworkFailure().AddUObject(this, &USikSubsystem::HandleNetworkFailure);
+		TravelFailureDelegateHandle = GEngine->OnTravelFailure().AddUObject(this, &USikSubsystem::HandleTravelFailure);
+	}
+	
+	FlightRecorder.SetCapacity(FlightRecorderCapacity);
+	
+	SessionMetrics.SetWindowSize(SessionMetricsWindowSize);
+	PostLoadMapDelegateHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &ThisClass::OnPostLoadMapWithWorld);
+	
+	SessionPollScheduler.MinInterval = SessionPollMinInterval;
+	SessionPollScheduler.IdleInterval = SessionPollIdleInterval;
+	SessionPollScheduler.MaxBackoffInterval = SessionPollMaxBackoffInterval;
+	SessionPollScheduler.JitterFraction = SessionPollJitterFraction;
+	
+	if (LatencyProbeTransport == ESikLatencyProbeTransport::UdpEcho)
+	{
+		LatencyProbe = MakeShared<FSikUdpEchoLatencyProbe>(LatencyProbeTimeout);
+	}
+	else
+	{
+		LatencyProbe = MakeShared<FSikBackendLatencyProbe>();
+	}
+	
+	/** Lobbies carry no ping, hosts and clients both need their relay ping location to estimate one */
+	if (const IOnlineSubsystem* DefaultSubsystem = IOnlineSubsystem::Get(); !MockSession.IsValid() && DefaultSubsystem && DefaultSubsystem->GetSubsystemName() == STEAM_SUBSYSTEM)
+	{
+		FSikSteamPingLocation::InitRelayNetworkAccess();
+	}
+	
+	if (FParse::Param(FCommandLine::Get(), TEXT("SikMatchmakerServer")))
+	{
+		MatchmakerServer = MakeUnique<FSikMatchmakerServer>(GetMatchmakerSettings());
+		MatchmakerServer->Start(GetMatchmakerPort(), bMatchmakerServerBindAny);
+	}
+	
+	MatchmakingClient = MakeUnique<FSikMatchmakingClient>(*this);
+	
+	bDedicatedServer = IsRunningDedicatedServer();
+	if (bDedicatedServer && GetGameInstance())
+	{
+		LOG_WARNING(TEXT("Running as a dedicated server, the session is advertised once the lobby map is loaded"));
+		
+		GetGameInstance()->GetTimerManager().SetTimer(DedicatedServerLoadTimerHandle, this, &ThisClass::UpdateDedicatedServerLoad, 
+			FMath::Max(DedicatedServerLoadInterval, 1.f), true);
 	}
 }
 
@@ -53,6 +188,36 @@ void USikSubsystem::Deinitialize()
 	LOG_WARNING(TEXT("USikSubsystem::Deinitialize called"));
 
 	HandleAppExit();
+	CancelSessionTasks();
+	
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapDelegateHandle);
+	
+	/** Engine delegates outlive the game instance, the next one would otherwise get every callback twice */
+	FCoreDelegates::OnPreExit.Remove(PreExitDelegateHandle);
+	if (GEngine)
+	{
+		GEngine->OnNetworkFailure().Remove(NetworkFailureDelegateHandle);
+		GEngine->OnTravelFailure().Remove(TravelFailureDelegateHandle);
+	}
+	
+	if (SessionInterface.IsValid())
+	{
+		SessionInterface->ClearOnSessionSettingsUpdatedDelegate_Handle(SessionSettingsUpdatedDelegateHandle);
+		SessionInterface->ClearOnSessionUserInviteAcceptedDelegate_Handle(SessionUserInviteAcceptedDelegateHandle);
+	}
+	
+	LatencyProbe.Reset();
+	LatencyEchoServer.Reset();
+	
+	/** Before the server, an in process connection calls its matchmaker */
+	MatchmakingClient.Reset();
+	MatchmakerServer.Reset();
+	
+	if (MockSession.IsValid())
+	{
+		SessionInterface.Reset();
+		MockSession.Reset();
+	}
 }
 
 #pragma region Session Operations
@@ -61,253 +226,3990 @@ void USikSubsystem::CreateSession(const FSikCustomSessionSettings& InCustomSessi
 {
 	LOG_INFO(TEXT("Called"));
 
-	if (!SessionInterface.IsValid())
+	ClearReconnectTarget();
+
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Create;
+	Operation.CreateSettings = InCustomSessionSettings;
+	
+	EnqueueSessionOperation(MoveTemp(Operation));
+}
+
+void USikSubsystem::ExecuteCreateSession(const FSikCustomSessionSettings& InCustomSessionSettings)
+{
+	LOG_INFO(TEXT("Called"));
+	
+	if (ActiveSessionOperation.SessionName == NAME_PartySession)
 	{
-		LOG_ERROR(TEXT("CreateSession SessionInterface is INVALID"));
-		MultiplayerSessionsOnCreateSessionComplete.Broadcast(false);
+		ExecuteCreateParty(ActiveSessionOperation.MaxPartyMembers);
 		return;
 	}
-	
-	if (SessionInterface->GetNamedSession(NAME_GameSession))
-	{		
-		LOG_ERROR(TEXT("NAME_GameSession already exists, destroying before creating a new one"));
-		
-		bCreateSessionOnDestroy = true;
-		SessionSettingsForTheSessionToCreateAfterDestruction = InCustomSessionSettings;
-		
-		DestroySession();
-		
+
+	if (!SessionInterface.IsValid())
+	{
+		LOG_ERROR(TEXT("CreateSession SessionInterface is INVALID"));
+		if (IsGameSessionOperation())
+		{
+			MultiplayerSessionsOnCreateSessionComplete.Broadcast(false);
+		}
+		FinishSessionOperation(ESikSessionOperationResult::Failed);
 		return;
 	}
 
 	CreateSessionCompleteDelegateHandle = SessionInterface->AddOnCreateSessionCompleteDelegate_Handle(CreateSessionCompleteDelegate);
 
-	int32 NumPublicConnections = 2;
-	if (InCustomSessionSettings.Players == "2v2") NumPublicConnections = 4;
-	else if (InCustomSessionSettings.Players == "4v4") NumPublicConnections = 8;
+	const FSikPackedSessionSettings PackedSettings = FSikSessionSchema::FromReadable(InCustomSessionSettings);
+	if (PackedSettings.MapId == 0 || PackedSettings.GameModeId == 0)
+	{
+		LOG_WARNING(TEXT("Map %s or game mode %s is not in the session schema, sessions will not list it"), 
+			*InCustomSessionSettings.MapName, *InCustomSessionSettings.GameMode);
+	}
+	
+	const int32 NumPublicConnections = PackedSettings.GetNumPublicConnections();
+	
+	/** Dedicated servers have no player to attach presence or a lobby to, they are advertised as game servers */
+	const bool bPlayerHosted = !bLanMode && !bDedicatedServer;
 	
 	const TSharedPtr<FOnlineSessionSettings> OnlineSessionSettings = MakeShareable(new FOnlineSessionSettings());
-	OnlineSessionSettings->bIsLANMatch = false;
+	OnlineSessionSettings->bIsLANMatch = bLanMode;
+	OnlineSessionSettings->bIsDedicated = bDedicatedServer;
 	OnlineSessionSettings->NumPublicConnections = NumPublicConnections;
 	OnlineSessionSettings->bAllowJoinInProgress = true;
-	OnlineSessionSettings->bAllowJoinViaPresence = true;
+	OnlineSessionSettings->bAllowJoinViaPresence = bPlayerHosted;
 	OnlineSessionSettings->bShouldAdvertise = true;
-	OnlineSessionSettings->bUsesPresence = true;
-	OnlineSessionSettings->bUseLobbiesIfAvailable = true;
+	OnlineSessionSettings->bUsesPresence = bPlayerHosted;
+	OnlineSessionSettings->bUseLobbiesIfAvailable = bPlayerHosted;
 	OnlineSessionSettings->Set(SETTING_FILTERSEED, SETTING_FILTERSEED_VALUE, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
-	OnlineSessionSettings->Set(SETTING_MAPNAME, InCustomSessionSettings.MapName, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
-	OnlineSessionSettings->Set(SETTING_GAMEMODE, InCustomSessionSettings.GameMode, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
-	OnlineSessionSettings->Set(SETTING_NUMPLAYERSREQUIRED, InCustomSessionSettings.Players, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
-	OnlineSessionSettings->Set(SETTING_SESSION_VISIBILITY, InCustomSessionSettings.Visibility, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	FSikSessionSchema::Advertise(PackedSettings, *OnlineSessionSettings);
 	OnlineSessionSettings->Set(SETTING_SESSIONKEY, GenerateSessionUniqueCode(), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	if (bDedicatedServer)
+	{
+		OnlineSessionSettings->Set(SETTING_SERVERLOAD, 0, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	}
+	if (StartLatencyEchoServer())
+	{
+		OnlineSessionSettings->Set(SETTING_LATENCYECHOPORT, LatencyProbeEchoPort, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	}
+	if (const FString PingLocation = bLanMode ? FString() : FSikSteamPingLocation::GetLocalPingLocation(); !PingLocation.IsEmpty())
+	{
+		OnlineSessionSettings->Set(SETTING_PINGLOCATION, PingLocation, EOnlineDataAdvertisementType::ViaOnlineService);
+	}
+	else
+	{
+		OnlineSessionSettings->Remove(SETTING_PINGLOCATION);
+	}
 
-	if (!SessionInterface->CreateSession(*GetWorld()->GetFirstLocalPlayerFromController()->GetPreferredUniqueNetId(), NAME_GameSession, *OnlineSessionSettings))
+	/** Without a local player the backend hosts as player 0, which it maps to the server itself */
+	const FUniqueNetIdPtr LocalUserId = bDedicatedServer ? nullptr : GetLocalUserId();
+	const bool bCreateStarted = bDedicatedServer ? SessionInterface->CreateSession(0, NAME_GameSession, *OnlineSessionSettings) :
+		LocalUserId.IsValid() && SessionInterface->CreateSession(*LocalUserId, NAME_GameSession, *OnlineSessionSettings);
+	if (!bCreateStarted)
 	{
 		LOG_ERROR(TEXT("CreateSession failed to execute create session"));
 
 		SessionInterface->ClearOnCreateSessionCompleteDelegate_Handle(CreateSessionCompleteDelegateHandle);
-		MultiplayerSessionsOnCreateSessionComplete.Broadcast(false);
+		if (IsGameSessionOperation())
+		{
+			MultiplayerSessionsOnCreateSessionComplete.Broadcast(false);
+		}
+		FinishSessionOperation(ESikSessionOperationResult::Failed);
 	}
 }
 
 void USikSubsystem::FindSessions()
 {
-	LOG_INFO(TEXT("Called"));
+	/** Unfiltered search, private and full sessions are returned too */
+	FSikSessionQuery Query;
+	Query.bPublicOnly = false;
+	Query.MinOpenSlots = 0;
+	Query.MaxSearchResults = MaxRetainedSearchResults;
+	
+	FindSessions(Query);
+}
+
+void USikSubsystem::FindSessions(const FSikSessionQuery& InQuery)
+{
+	LOG_INFO(TEXT("Called Map: %s | GameMode: %s | Players: %s"), *InQuery.MapName, *InQuery.GameMode, *InQuery.Players);
 	
 	if (!SessionInterface.IsValid())
 	{
 		LOG_ERROR(TEXT("FindSessions SessionInterface is INVALID"));
-		MultiplayerSessionsOnFindSessionsComplete.Broadcast(TArray<FOnlineSessionSearchResult>(), false);
+		MultiplayerSessionsOnFindSessionsComplete.Broadcast(MakeShared<FSikSessionSearchSnapshot>(), false);
+		return;
+	}
+	
+	if (bFindSessionByCodeInProgress)
+	{
+		LOG_INFO(TEXT("Session code lookup in progress, running this search once it completes"));
+		SetPendingSessionSearch(InQuery);
+		return;
+	}
+	
+	/** Listeners still hear back while the join leaves the browser, with the cached snapshot if there is one */
+	if (IsSessionOperationQueued(ESikSessionOperation::Join))
+	{
+		LOG_WARNING(TEXT("Joining a session, skipping browse search"));
+		
+		const FSikSessionSearchSnapshotPtr CachedSnapshot = GetCachedSearchResults(InQuery);
+		const FSikSessionSearchSnapshotRef Snapshot = CachedSnapshot.IsValid() ? CachedSnapshot.ToSharedRef() : 
+			MakeShared<const FSikSessionSearchSnapshot>();
+		MultiplayerSessionsOnFindSessionsComplete.Broadcast(Snapshot, CachedSnapshot.IsValid());
 		return;
 	}
 	
+	/** Single flight, callers share the running search instead of cancelling it */
 	if (bFindSessionsInProgress)
 	{
-		LOG_INFO(TEXT("Find session already in progress calling to cancel search"));
-		CancelFindSessions();
+		if (InFlightSessionSearchQuery.Covers(InQuery))
+		{
+			LOG_INFO(TEXT("Same search already in progress, sharing its result"));
+			return;
+		}
+		
+		LOG_INFO(TEXT("Other search in progress, running this one once it completes"));
+		SetPendingSessionSearch(InQuery);
+		return;
+	}
+	
+	/** Fresh snapshot is served from the cache, the backend is asked again only once it turns stale */
+	if (const double CacheAge = GetCachedSearchResultsAge(InQuery); CacheAge >= 0.0 && CacheAge < SearchResultsCacheTTL)
+	{
+		BroadcastCachedSearchResults();
+		ScheduleSessionSearchRefresh(InQuery, SearchResultsCacheTTL - CacheAge);
+		return;
+	}
+	
+	if (const double RateLimitWait = GetSessionSearchRateLimitWait(); RateLimitWait > 0.0)
+	{
+		ScheduleSessionSearchRefresh(InQuery, RateLimitWait);
+		return;
+	}
+	
+	StartSessionSearch(InQuery);
+}
+
+void USikSubsystem::StartSessionSearch(const FSikSessionQuery& InQuery)
+{
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(SessionSearchRefreshTimerHandle);
 	}
 	
 	bFindSessionsInProgress = true;
+	InFlightSessionSearchQuery = InQuery;
+	InFlightSessionSearchId = ++LastSessionSearchId;
+	LastSessionSearchStartTime = FPlatformTime::Seconds();
+	SessionSearchDeadline = SessionSearchTimeBudget > 0.f ? LastSessionSearchStartTime + SessionSearchTimeBudget : 0.0;
+	
+	/** Tasks waiting for a search of their query are tied to this one, the searches after it are not theirs */
+	for (FSikAwaitedSessionSearch& AwaitedSearch : AwaitedSessionSearches)
+	{
+		if (AwaitedSearch.SearchId == 0 && InQuery.Covers(AwaitedSearch.Query))
+		{
+			AwaitedSearch.SearchId = InFlightSessionSearchId;
+		}
+	}
 	
-	FindSessionsCompleteDelegateHandle = SessionInterface->AddOnFindSessionsCompleteDelegate_Handle(FindSessionsCompleteDelegate);
+	INC_DWORD_STAT(STAT_SikSessionSearchesStarted);
+	SessionMetrics.BeginSpan(SIK_SPAN_FINDSESSIONS);
+	FlightRecorder.Record(ESikFlightEventType::Issued, ESikFlightSubject::FindSessions, 0, InQuery.MaxSearchResults);
 	
-	LastCreatedSessionSearch = MakeShareable(new FOnlineSessionSearch());
-	LastCreatedSessionSearch->MaxSearchResults = 10000;
-	LastCreatedSessionSearch->bIsLanQuery = false;
-	LastCreatedSessionSearch->QuerySettings.Set(SETTING_FILTERSEED, SETTING_FILTERSEED_VALUE, EOnlineComparisonOp::Equals);
-	LastCreatedSessionSearch->QuerySettings.Set(SEARCH_LOBBIES, true, EOnlineComparisonOp::Equals);
+	/** LAN hosts answer first and are the closest, they are listed ahead of the lobbies */
+	SessionSearchPasses = GetSessionSearchPasses();
+	SessionSearchPassResults.Reset();
+	bSessionSearchPassSucceeded = false;
+	
+	const IOnlineSubsystem* DefaultSubsystem = IOnlineSubsystem::Get();
+	if (bMergeLanSessions && !bLanMode && !MockSession.IsValid() && DefaultSubsystem && DefaultSubsystem->GetSubsystemName() == STEAM_SUBSYSTEM)
+	{
+		SessionSearchPasses.Insert(ESikSessionSearchPass::Lan, 0);
+	}
 	
 	if (!GetWorld() || GetWorld()->bIsTearingDown)
 	{
 		LOG_WARNING(TEXT("FindSessions aborted – world is tearing down"));
-		MultiplayerSessionsOnFindSessionsComplete.Broadcast(TArray<FOnlineSessionSearchResult>(), false);
+		SessionSearchPasses.Reset();
+		bFindSessionsInProgress = false;
+		SessionMetrics.EndSpan(SIK_SPAN_FINDSESSIONS, false);
+		
+		const FSikSessionSearchSnapshotRef EmptySnapshot = MakeShared<FSikSessionSearchSnapshot>();
+		MultiplayerSessionsOnFindSessionsComplete.Broadcast(EmptySnapshot, false);
+		CompleteAwaitedSessionSearches(InFlightSessionSearchId, EmptySnapshot, ESikSessionOperationResult::Failed);
+		return;
+	}
+	
+	/** Unknown names would be sent as id 0 and match the sessions that left the field unset, no session can match them */
+	if ((InQuery.MapName != SETTING_FILTER_ANY && FSikSessionSchema::GetMapId(InQuery.MapName) == 0) ||
+		(InQuery.GameMode != SETTING_FILTER_ANY && FSikSessionSchema::GetGameModeId(InQuery.GameMode) == 0) ||
+		(InQuery.Players != SETTING_FILTER_ANY && FSikSessionSchema::ParsePlayers(InQuery.Players) == ESikPlayersConfig::Any))
+	{
+		LOG_WARNING(TEXT("Filter is not in the session schema, Map: %s | GameMode: %s | Players: %s"), 
+			*InQuery.MapName, *InQuery.GameMode, *InQuery.Players);
+		
+		SessionSearchPasses.Reset();
+		LastCreatedSessionSearch = MakeShared<FOnlineSessionSearch>();
+		CompleteSessionSearchPass(true);
 		return;
 	}
+	
+	/** Backends may never answer a pass, the whole chain is cut off once the budget runs out */
+	if (UGameInstance* GameInstance = GetGameInstance(); GameInstance && SessionSearchDeadline > 0.0)
+	{
+		const uint32 SearchId = InFlightSessionSearchId;
+		GameInstance->GetTimerManager().SetTimer(SessionSearchBudgetTimerHandle, FTimerDelegate::CreateWeakLambda(this, [this, SearchId]()
+		{
+			if (bFindSessionsInProgress && InFlightSessionSearchId == SearchId)
+			{
+				ExpireSessionSearchBudget();
+			}
+		}), SessionSearchTimeBudget, false);
+	}
 
-	if (!SessionInterface->FindSessions(*GetWorld()->GetFirstLocalPlayerFromController()->GetPreferredUniqueNetId(), LastCreatedSessionSearch.ToSharedRef()))
+	if (!StartSessionSearchPass())
 	{
 		LOG_ERROR(TEXT("Call to session interface find sessions function failed"));
 		
-		SessionInterface->ClearOnFindSessionsCompleteDelegate_Handle(FindSessionsCompleteDelegateHandle);
+		ClearSessionSearchBudgetTimer();
 		bFindSessionsInProgress = false;
-		MultiplayerSessionsOnFindSessionsComplete.Broadcast(TArray<FOnlineSessionSearchResult>(), false);
+		SessionMetrics.EndSpan(SIK_SPAN_FINDSESSIONS, false);
+		
+		const FSikSessionSearchSnapshotRef EmptySnapshot = MakeShared<FSikSessionSearchSnapshot>();
+		MultiplayerSessionsOnFindSessionsComplete.Broadcast(EmptySnapshot, false);
+		CompleteAwaitedSessionSearches(InFlightSessionSearchId, EmptySnapshot, ESikSessionOperationResult::Failed);
+		ScheduleNextSessionBrowserPoll(InQuery, false, nullptr);
 	}
 }
 
-void USikSubsystem::CancelFindSessions()
+bool USikSubsystem::StartSessionSearchPass()
 {
-	LOG_INFO(TEXT("Called"));
-
-	if (!SessionInterface.IsValid())
+	while (!SessionSearchPasses.IsEmpty())
 	{
-		LOG_ERROR(TEXT("SessionInterface is INVALID"));
-		return;
+		const ESikSessionSearchPass Pass = SessionSearchPasses[0];
+		SessionSearchPasses.RemoveAt(0);
+		
+		/** Passes share the budget of the search, the ones left once it is spent are skipped */
+		const double RemainingBudget = SessionSearchDeadline > 0.0 ? SessionSearchDeadline - FPlatformTime::Seconds() : 0.0;
+		if (SessionSearchDeadline > 0.0 && RemainingBudget <= 0.0)
+		{
+			LOG_WARNING(TEXT("Search budget spent, skipping %d remaining passes"), SessionSearchPasses.Num() + 1);
+			SessionSearchPasses.Reset();
+			return false;
+		}
+		
+		FindSessionsCompleteDelegateHandle = SessionInterface->AddOnFindSessionsCompleteDelegate_Handle(FindSessionsCompleteDelegate);
+		LastCreatedSessionSearch = MakeSessionSearch(InFlightSessionSearchQuery, Pass);
+		
+		/** Backends honouring the timeout wind the pass down themselves, the budget timer catches the others */
+		if (SessionSearchDeadline > 0.0)
+		{
+			const float PassTimeout = static_cast<float>(RemainingBudget);
+			LastCreatedSessionSearch->TimeoutInSeconds = LastCreatedSessionSearch->TimeoutInSeconds > 0.f ? 
+				FMath::Min(LastCreatedSessionSearch->TimeoutInSeconds, PassTimeout) : PassTimeout;
+		}
+		
+		const FUniqueNetIdPtr LocalUserId = GetLocalUserId();
+		if (LocalUserId.IsValid() && SessionInterface->FindSessions(*LocalUserId, LastCreatedSessionSearch.ToSharedRef()))
+		{
+			return true;
+		}
+		
+		LOG_WARNING(TEXT("Search pass %d could not be started"), static_cast<int32>(Pass));
+		SessionInterface->ClearOnFindSessionsCompleteDelegate_Handle(FindSessionsCompleteDelegateHandle);
 	}
-
-	bFindSessionsInProgress = false;
 	
-	LOG_WARNING(TEXT("Aborting search"));
-
-	SessionInterface->ClearOnFindSessionsCompleteDelegate_Handle(FindSessionsCompleteDelegateHandle);
-	MultiplayerSessionsOnFindSessionsComplete.Broadcast(TArray<FOnlineSessionSearchResult>(), true);
+	return false;
 }
 
-void USikSubsystem::JoinSessions(FOnlineSessionSearchResult& InSessionToJoin)
+void USikSubsystem::ExpireSessionSearchBudget()
 {
-	LOG_INFO(TEXT("Called"));
+	LOG_WARNING(TEXT("Search ran out of its %.1fs budget, completing with the passes done so far"), SessionSearchTimeBudget);
 	
-	if (!SessionInterface.IsValid())
+	/** The running pass is cancelled on the backend, its completion arrives stale if it arrives at all */
+	SessionSearchPasses.Reset();
+	if (SessionInterface.IsValid())
 	{
-		LOG_ERROR(TEXT("SessionInterface is INVALID"));
-		MultiplayerSessionsOnJoinSessionsComplete.Broadcast(EOnJoinSessionCompleteResult::UnknownError);
-		return;
+		SessionInterface->ClearOnFindSessionsCompleteDelegate_Handle(FindSessionsCompleteDelegateHandle);
+		SessionInterface->CancelFindSessions();
 	}
 	
-	if (IsSessionInState(EOnlineSessionState::Creating) ||
-		IsSessionInState(EOnlineSessionState::Starting) ||
-		IsSessionInState(EOnlineSessionState::Ending))
+	CompleteSessionSearchPass(false);
+}
+
+void USikSubsystem::ClearSessionSearchBudgetTimer()
+{
+	if (UGameInstance* GameInstance = GetGameInstance())
 	{
-		LOG_ERROR(TEXT("JoinSession blocked: session busy"));
-		MultiplayerSessionsOnJoinSessionsComplete.Broadcast(EOnJoinSessionCompleteResult::UnknownError);
-		return;
+		GameInstance->GetTimerManager().ClearTimer(SessionSearchBudgetTimerHandle);
 	}
+}
 
-	JoinSessionCompleteDelegateHandle = SessionInterface->AddOnJoinSessionCompleteDelegate_Handle(JoinSessionCompleteDelegate);
-
-	InSessionToJoin.Session.SessionSettings.bUseLobbiesIfAvailable = true;
-	InSessionToJoin.Session.SessionSettings.bUsesPresence = true;
+TArray<ESikSessionSearchPass> USikSubsystem::GetSessionSearchPasses() const
+{
+	if (bLanMode)
+	{
+		return { ESikSessionSearchPass::Lan };
+	}
 	
-	if (!SessionInterface->JoinSession(*GetWorld()->GetFirstLocalPlayerFromController()->GetPreferredUniqueNetId(), NAME_GameSession, InSessionToJoin))
+	/** The mock backend only synthesizes lobbies */
+	if (bSearchDedicatedServers && !MockSession.IsValid())
 	{
-		LOG_ERROR(TEXT("Call to session interface join session function failed"));
-		
-		SessionInterface->ClearOnJoinSessionCompleteDelegate_Handle(JoinSessionCompleteDelegateHandle);
-		MultiplayerSessionsOnJoinSessionsComplete.Broadcast(EOnJoinSessionCompleteResult::UnknownError);
+		return { ESikSessionSearchPass::Lobbies, ESikSessionSearchPass::Servers };
 	}
+	
+	return { ESikSessionSearchPass::Lobbies };
 }
 
-void USikSubsystem::DestroySession()
+void USikSubsystem::ApplySessionSearchPass(FOnlineSessionSearch& OutSearch, const ESikSessionSearchPass InPass) const
 {
-	LOG_INFO(TEXT("Called"));
+	OutSearch.bIsLanQuery = InPass == ESikSessionSearchPass::Lan;
 	
-	if (!SessionInterface.IsValid())
+	switch (InPass)
 	{
-		LOG_ERROR(TEXT("SessionInterface is INVALID"));
-		MultiplayerSessionsOnDestroySessionComplete.Broadcast(false);
-		return;
+	case ESikSessionSearchPass::Lan:
+		/** Hosts on the local network answer within a few ms, the beacon would otherwise wait out its whole default timeout */
+		if (LanSearchResultWindow > 0.f)
+		{
+			OutSearch.TimeoutInSeconds = LanSearchResultWindow;
+		}
+		break;
+	case ESikSessionSearchPass::Lobbies:
+		OutSearch.QuerySettings.Set(SEARCH_LOBBIES, true, EOnlineComparisonOp::Equals);
+		break;
+	case ESikSessionSearchPass::Servers:
+		/** Without SEARCH_LOBBIES the backend queries its game server list */
+		OutSearch.QuerySettings.Set(SEARCH_DEDICATED_ONLY, true, EOnlineComparisonOp::Equals);
+		break;
 	}
+}
 
-	if (!IsSessionInState(EOnlineSessionState::Pending) &&
-		!IsSessionInState(EOnlineSessionState::InProgress) &&
-		!IsSessionInState(EOnlineSessionState::Ended))
+void USikSubsystem::MarkDedicatedSearchResults(FOnlineSessionSearch& InOutSearch)
+{
+	bool bDedicatedOnly = false;
+	if (!InOutSearch.QuerySettings.Get(SEARCH_DEDICATED_ONLY, bDedicatedOnly) || !bDedicatedOnly)
 	{
-		LOG_ERROR(TEXT("DestroySession failed: no session to destroy"));
-		MultiplayerSessionsOnDestroySessionComplete.Broadcast(false);
 		return;
 	}
+	
+	for (FOnlineSessionSearchResult& SearchResult : InOutSearch.SearchResults)
+	{
+		SearchResult.Session.SessionSettings.bIsDedicated = true;
+	}
+}
 
-	DestroySessionCompleteDelegateHandle = SessionInterface->AddOnDestroySessionCompleteDelegate_Handle(DestroySessionCompleteDelegate);
+TSharedRef<FOnlineSessionSearch> USikSubsystem::MakeSessionSearch(const FSikSessionQuery& InQuery, const ESikSessionSearchPass InPass) const
+{
+	const TSharedRef<FOnlineSessionSearch> SessionSearch = MakeShared<FOnlineSessionSearch>();
+	SessionSearch->MaxSearchResults = FMath::Clamp(InQuery.MaxSearchResults, 1, FMath::Max(1, MaxRetainedSearchResults));
+	SessionSearch->QuerySettings.Set(SETTING_FILTERSEED, SETTING_FILTERSEED_VALUE, EOnlineComparisonOp::Equals);
+	ApplySessionSearchPass(*SessionSearch, InPass);
 
-	if (!SessionInterface->DestroySession(NAME_GameSession))
+	/**
+	 * A fully specified public filter is the packed value itself, one equality term on the bucket key
+	 * Otherwise each pinned field is a term of its own, FSikSessionListFilter still checks the packed value of every result
+	 */
+	FOnlineSearchSettings& QuerySettings = SessionSearch->QuerySettings;
+	if (InQuery.IsFullySpecified() && InQuery.bPublicOnly)
 	{
-		LOG_ERROR(TEXT("Call to session interface destroy session function failed"));
+		FSikPackedSessionSettings BucketSettings;
+		BucketSettings.MapId = FSikSessionSchema::GetMapId(InQuery.MapName);
+		BucketSettings.GameModeId = FSikSessionSchema::GetGameModeId(InQuery.GameMode);
+		BucketSettings.Players = FSikSessionSchema::ParsePlayers(InQuery.Players);
+		BucketSettings.Visibility = ESikSessionVisibility::Public;
+		
+		QuerySettings.Set(SETTING_SESSIONSCHEMA, BucketSettings.Pack(), EOnlineComparisonOp::Equals);
+	}
+	else
+	{
+		if (InQuery.MapName != SETTING_FILTER_ANY)
+		{
+			QuerySettings.Set(SETTING_SCHEMA_MAP, static_cast<int32>(FSikSessionSchema::GetMapId(InQuery.MapName)), EOnlineComparisonOp::Equals);
+		}
+		if (InQuery.GameMode != SETTING_FILTER_ANY)
+		{
+			QuerySettings.Set(SETTING_SCHEMA_GAMEMODE, static_cast<int32>(FSikSessionSchema::GetGameModeId(InQuery.GameMode)), 
+				EOnlineComparisonOp::Equals);
+		}
+		if (InQuery.Players != SETTING_FILTER_ANY)
+		{
+			QuerySettings.Set(SETTING_SCHEMA_PLAYERS, static_cast<int32>(FSikSessionSchema::ParsePlayers(InQuery.Players)), 
+				EOnlineComparisonOp::Equals);
+		}
+		if (InQuery.bPublicOnly)
+		{
+			QuerySettings.Set(SETTING_SCHEMA_VISIBILITY, static_cast<int32>(ESikSessionVisibility::Public), EOnlineComparisonOp::Equals);
+		}
+	}
+	
+	if (InQuery.MinOpenSlots > 0)
+	{
+		QuerySettings.Set(SEARCH_MINSLOTSAVAILABLE, InQuery.MinOpenSlots, EOnlineComparisonOp::GreaterThanEquals);
+	}
+	
+	return SessionSearch;
+}
 
-		SessionInterface->ClearOnDestroySessionCompleteDelegate_Handle(DestroySessionCompleteDelegateHandle);
-		MultiplayerSessionsOnDestroySessionComplete.Broadcast(false);
+void USikSubsystem::StartSessionBrowserPolling(const FSikSessionQuery& InQuery)
+{
+	/** Result limit is owned by RequestMoreSessionResults, only a change of filters restarts the polling */
+	if (bSessionBrowserPolling && SessionBrowserQuery == InQuery)
+	{
+		return;
+	}
+	
+	LOG_INFO(TEXT("Called Map: %s | GameMode: %s | Players: %s"), *InQuery.MapName, *InQuery.GameMode, *InQuery.Players);
+	
+	SessionBrowserResultSteps = 1;
+	FSikSessionQuery LimitedQuery = InQuery;
+	LimitedQuery.MaxSearchResults = GetSessionBrowserResultLimit();
+	
+	bSessionBrowserPolling = true;
+	SessionBrowserQuery = LimitedQuery;
+	LastSessionBrowserFingerprint = 0;
+	LastSessionBrowserResultCount = 0;
+	SessionPollScheduler.Reset();
+	
+	PollSessionBrowser();
+}
+
+bool USikSubsystem::RequestMoreSessionResults()
+{
+	if (!bSessionBrowserPolling)
+	{
+		return false;
+	}
+	
+	/** Backend returned less than asked for, every matching session is already listed */
+	if (LastSessionBrowserResultCount < SessionBrowserQuery.MaxSearchResults)
+	{
+		return false;
+	}
+	
+	if (SessionBrowserQuery.MaxSearchResults >= MaxRetainedSearchResults)
+	{
+		LOG_INFO(TEXT("Retained results cap of %d reached, not loading more sessions"), MaxRetainedSearchResults);
+		return false;
+	}
+	
+	/** No offset to resume from, the next poll searches again from the start with the larger limit */
+	++SessionBrowserResultSteps;
+	SessionBrowserQuery.MaxSearchResults = GetSessionBrowserResultLimit();
+	
+	LOG_INFO(TEXT("Searching again for up to %d sessions"), SessionBrowserQuery.MaxSearchResults);
+	
+	SessionPollScheduler.Reset();
+	PollSessionBrowser();
+	
+	return true;
+}
+
+FSikSessionQuery USikSubsystem::MakeSessionBrowserQuery(const FSikCustomSessionSettings& InFilter) const
+{
+	FSikSessionQuery Query = FSikSessionQuery::FromFilter(InFilter);
+	Query.MaxSearchResults = FMath::Clamp(SessionSearchResultStep, 1, FMath::Max(1, MaxRetainedSearchResults));
+	return Query;
+}
+
+int32 USikSubsystem::GetSessionBrowserResultLimit() const
+{
+	return FMath::Clamp(SessionSearchResultStep * SessionBrowserResultSteps, 1, FMath::Max(1, MaxRetainedSearchResults));
+}
+
+void USikSubsystem::StopSessionBrowserPolling()
+{
+	LOG_INFO(TEXT("Called"));
+	
+	bSessionBrowserPolling = false;
+	
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(SessionBrowserPollTimerHandle);
+	}
+}
+
+void USikSubsystem::PollSessionBrowser()
+{
+	if (!bSessionBrowserPolling)
+	{
+		return;
+	}
+	
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(SessionBrowserPollTimerHandle);
+	}
+	
+	if (IsSessionOperationQueued(ESikSessionOperation::Join))
+	{
+		LOG_WARNING(TEXT("Joining a session, skipping browse search"));
+		return;
+	}
+	
+	/** The completion of the running search schedules the next poll */
+	if (bFindSessionsInProgress)
+	{
+		if (!InFlightSessionSearchQuery.Covers(SessionBrowserQuery))
+		{
+			SetPendingSessionSearch(SessionBrowserQuery);
+		}
+		return;
+	}
+	
+	if (bFindSessionByCodeInProgress)
+	{
+		SetSessionBrowserPollTimer(SessionPollScheduler.MinInterval);
+		return;
+	}
+	
+	if (const double RateLimitWait = GetSessionSearchRateLimitWait(); RateLimitWait > 0.0)
+	{
+		SetSessionBrowserPollTimer(RateLimitWait);
+		return;
+	}
+	
+	StartSessionSearch(SessionBrowserQuery);
+}
+
+void USikSubsystem::ScheduleNextSessionBrowserPoll(const FSikSessionQuery& InCompletedQuery, bool bWasSuccessful, 
+	const TArray<FOnlineSessionSearchResult>* InResults)
+{
+	if (!bSessionBrowserPolling || !InCompletedQuery.Covers(SessionBrowserQuery))
+	{
+		return;
+	}
+	
+	/** Order independent fingerprint of which sessions are listed and how many slots they have open */
+	uint32 Fingerprint = InResults ? InResults->Num() : 0;
+	if (InResults)
+	{
+		for (const FOnlineSessionSearchResult& SearchResult : *InResults)
+		{
+			Fingerprint += HashCombine(GetTypeHash(SearchResult.GetSessionIdStr()), GetTypeHash(SearchResult.Session.NumOpenPublicConnections));
+		}
+	}
+	
+	const bool bHasChanged = Fingerprint != LastSessionBrowserFingerprint;
+	LastSessionBrowserFingerprint = Fingerprint;
+	LastSessionBrowserResultCount = InResults ? InResults->Num() : 0;
+	
+	const bool bWasEmpty = !InResults || InResults->IsEmpty();
+	const float Delay = SessionPollScheduler.ComputeNextDelay(bWasSuccessful, bWasEmpty, bHasChanged, FApp::HasFocus());
+	
+	LOG_INFO(TEXT("Next session browser poll in %.2f seconds"), Delay);
+	
+	SetSessionBrowserPollTimer(Delay);
+}
+
+void USikSubsystem::SetSessionBrowserPollTimer(float InDelay)
+{
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().SetTimer(SessionBrowserPollTimerHandle, 
+			FTimerDelegate::CreateUObject(this, &ThisClass::PollSessionBrowser), FMath::Max(InDelay, KINDA_SMALL_NUMBER), false);
+	}
+}
+
+double USikSubsystem::GetSessionSearchRateLimitWait() const
+{
+	return LastSessionSearchStartTime + SessionPollScheduler.MinInterval - FPlatformTime::Seconds();
+}
+
+void USikSubsystem::FindSessionByCode(const FString& InSessionCode)
+{
+	FSikSessionCodeLookup Lookup;
+	Lookup.SessionCode = InSessionCode;
+	
+	EnqueueSessionCodeLookup(MoveTemp(Lookup));
+}
+
+void USikSubsystem::EnqueueSessionCodeLookup(FSikSessionCodeLookup&& InLookup)
+{
+	/** Leader moved on again, only its latest game session is worth following */
+	if (InLookup.bFollowParty)
+	{
+		QueuedSessionCodeLookups.RemoveAll([](const FSikSessionCodeLookup& QueuedLookup) { return QueuedLookup.bFollowParty; });
+	}
+	
+	/** One lookup at a time, running another would take over the state and the result of the one in flight */
+	if (bFindSessionByCodeInProgress || !QueuedSessionCodeLookups.IsEmpty())
+	{
+		LOG_INFO(TEXT("Lookup of %s in progress, looking up %s once it completes"), *SessionCodeToFind, *InLookup.SessionCode);
+		QueuedSessionCodeLookups.Add(MoveTemp(InLookup));
+		return;
+	}
+	
+	RunSessionCodeLookup(MoveTemp(InLookup));
+}
+
+void USikSubsystem::RunNextSessionCodeLookup()
+{
+	if (bFindSessionByCodeInProgress || QueuedSessionCodeLookups.IsEmpty())
+	{
+		return;
+	}
+	
+	FSikSessionCodeLookup NextLookup = MoveTemp(QueuedSessionCodeLookups[0]);
+	QueuedSessionCodeLookups.RemoveAt(0);
+	RunSessionCodeLookup(MoveTemp(NextLookup));
+}
+
+void USikSubsystem::RunSessionCodeLookup(FSikSessionCodeLookup&& InLookup)
+{
+	const FString SessionCode = InLookup.SessionCode;
+	
+	LOG_INFO(TEXT("Called Code: %s"), *SessionCode);
+	
+	ActiveSessionCodeLookup = MoveTemp(InLookup);
+	ActiveSessionCodeLookup.LookupId = ++LastSessionCodeLookupId;
+	
+	SessionMetrics.BeginSpan(SIK_SPAN_FINDSESSIONBYCODE);
+	FlightRecorder.Record(ESikFlightEventType::Issued, ESikFlightSubject::FindSessionByCode);
+	
+	/** LAN session ids are not lobby ids, the code is only ever advertised as the session key there */
+	FString DecodedSessionId;
+	if (bLanMode || !FSikSessionCode::DecodeSessionId(SessionCode, DecodedSessionId))
+	{
+		FindSessionBySessionKey(SessionCode);
+		return;
+	}
+	
+	if (!SessionInterface.IsValid() || !GetWorld() || GetWorld()->bIsTearingDown)
+	{
+		LOG_ERROR(TEXT("FindSessionByCode SessionInterface is INVALID or world is tearing down"));
+		CompleteFindSessionByCode(FOnlineSessionSearchResult(), false);
+		return;
+	}
+	
+	const FUniqueNetIdPtr SessionId = SessionInterface->CreateSessionIdFromString(DecodedSessionId);
+	const FUniqueNetIdPtr LocalUserId = GetLocalUserId();
+	if (!SessionId.IsValid() || !LocalUserId.IsValid())
+	{
+		FindSessionBySessionKey(SessionCode);
+		return;
+	}
+	
+	LOG_INFO(TEXT("Code %s decoded to session %s, looking it up by id"), *SessionCode, *DecodedSessionId);
+	
+	bFindSessionByCodeInProgress = true;
+	SessionCodeToFind = SessionCode;
+	
+	FlightRecorder.Record(ESikFlightEventType::Issued, ESikFlightSubject::FindSessionById);
+	
+	/** Backends without a lookup by id fail the call or the callback, both fall back to the session key search */
+	if (!SessionInterface->FindSessionById(*LocalUserId, *SessionId, *LocalUserId, 
+		FOnSingleSessionResultCompleteDelegate::CreateUObject(this, &ThisClass::OnFindSessionByIdCompleteCallback, ActiveSessionCodeLookup.LookupId)))
+	{
+		LOG_WARNING(TEXT("Lookup by id not supported, searching by session key"));
+		FindSessionBySessionKey(SessionCode);
+	}
+}
+
+void USikSubsystem::FindSessionBySessionKey(const FString& InSessionCode)
+{
+	LOG_INFO(TEXT("Called Code: %s"), *InSessionCode);
+	
+	if (!SessionInterface.IsValid())
+	{
+		LOG_ERROR(TEXT("FindSessionByCode SessionInterface is INVALID"));
+		bFindSessionByCodeInProgress = false;
+		CompleteFindSessionByCode(FOnlineSessionSearchResult(), false);
+		return;
+	}
+	
+	if (!GetWorld() || GetWorld()->bIsTearingDown)
+	{
+		LOG_WARNING(TEXT("FindSessionByCode aborted – world is tearing down"));
+		bFindSessionByCodeInProgress = false;
+		CompleteFindSessionByCode(FOnlineSessionSearchResult(), false);
+		return;
+	}
+	
+	/** Holds off browse searches until the lookup completes, the backend runs one search at a time */
+	bFindSessionByCodeInProgress = true;
+	
+	CancelSessionCodeSearch();
+	SessionCodeToFind = InSessionCode;
+	
+	/** The cached browse snapshot may already hold the session, public sessions are found without any request */
+	if (const FSikSessionHandle CachedResult = FindCachedSessionByCode(InSessionCode); CachedResult.IsValid())
+	{
+		LOG_INFO(TEXT("Found session with code %s in the cached search results"), *InSessionCode);
+		
+		FOnlineSessionSearchResult FoundResult = *CachedResult;
+		ApplyCachedLatency(FoundResult);
+		bFindSessionByCodeInProgress = false;
+		CompleteFindSessionByCode(FoundResult, true);
+		return;
+	}
+	
+	/** Backends only run one search at a time, wait for the running browse search and look through its results first */
+	if (bFindSessionsInProgress)
+	{
+		LOG_INFO(TEXT("Browse search in progress, looking up the code once it completes"));
+		bSessionKeyLookupPending = true;
+		return;
+	}
+	
+	FlightRecorder.Record(ESikFlightEventType::Issued, ESikFlightSubject::FindSessionBySessionKey);
+	
+	/** Codes of dedicated servers are random, their ids are not lobby ids, so the server pass runs once no lobby has the key */
+	SessionCodeSearchPasses = GetSessionSearchPasses();
+	
+	if (!StartSessionCodeSearchPass())
+	{
+		LOG_ERROR(TEXT("Call to session interface find sessions function failed"));
+		
+		bFindSessionByCodeInProgress = false;
+		CompleteFindSessionByCode(FOnlineSessionSearchResult(), false);
+	}
+}
+
+void USikSubsystem::CancelSessionCodeSearch()
+{
+	if (!SessionInterface.IsValid() || !FindSessionByCodeCompleteDelegateHandle.IsValid())
+	{
+		return;
+	}
+	
+	SessionInterface->ClearOnFindSessionsCompleteDelegate_Handle(FindSessionByCodeCompleteDelegateHandle);
+	SessionCodeSearchPasses.Reset();
+	
+	/**
+	 * Backends cancel whichever search they run, a key search is only started while no browse search is in flight,
+	 * see FindSessionBySessionKey, so cancelling it never takes a browse search down
+	 */
+	if (!bFindSessionsInProgress)
+	{
+		SessionInterface->CancelFindSessions();
+	}
+}
+
+bool USikSubsystem::StartSessionCodeSearchPass()
+{
+	while (!SessionCodeSearchPasses.IsEmpty())
+	{
+		const ESikSessionSearchPass Pass = SessionCodeSearchPasses[0];
+		SessionCodeSearchPasses.RemoveAt(0);
+		
+		FindSessionByCodeCompleteDelegateHandle = SessionInterface->AddOnFindSessionsCompleteDelegate_Handle(FindSessionByCodeCompleteDelegate);
+		
+		LastSessionCodeSearch = MakeShareable(new FOnlineSessionSearch());
+		/** LAN beacons ignore query terms, every host answers and the key is compared on the results */
+		LastSessionCodeSearch->MaxSearchResults = Pass == ESikSessionSearchPass::Lan ? FMath::Max(1, MaxRetainedSearchResults) : 1;
+		LastSessionCodeSearch->QuerySettings.Set(SETTING_FILTERSEED, SETTING_FILTERSEED_VALUE, EOnlineComparisonOp::Equals);
+		LastSessionCodeSearch->QuerySettings.Set(SETTING_SESSIONKEY, SessionCodeToFind, EOnlineComparisonOp::Equals);
+		ApplySessionSearchPass(*LastSessionCodeSearch, Pass);
+		
+		const FUniqueNetIdPtr LocalUserId = GetLocalUserId();
+		if (LocalUserId.IsValid() && SessionInterface->FindSessions(*LocalUserId, LastSessionCodeSearch.ToSharedRef()))
+		{
+			return true;
+		}
+		
+		LOG_WARNING(TEXT("Session key search pass %d could not be started"), static_cast<int32>(Pass));
+		SessionInterface->ClearOnFindSessionsCompleteDelegate_Handle(FindSessionByCodeCompleteDelegateHandle);
+	}
+	
+	return false;
+}
+
+void USikSubsystem::CompleteFindSessionByCode(const FOnlineSessionSearchResult& InSessionResult, bool bWasSuccessful)
+{
+	SessionMetrics.EndSpan(SIK_SPAN_FINDSESSIONBYCODE, bWasSuccessful);
+	FlightRecorder.Record(ESikFlightEventType::Callback, ESikFlightSubject::FindSessionByCode, bWasSuccessful);
+	
+	/** Cleared first, whoever gets the result may request the next lookup */
+	const FSikSessionCodeLookup CompletedLookup = MoveTemp(ActiveSessionCodeLookup);
+	ActiveSessionCodeLookup = FSikSessionCodeLookup();
+	
+	if (CompletedLookup.bFollowParty)
+	{
+		/** Member left the party or the leader moved on while the lookup ran */
+		if (CompletedLookup.SessionCode == PartyGameSessionCode)
+		{
+			FollowPartyIntoGameSession(InSessionResult, bWasSuccessful);
+		}
+	}
+	/** Awaited lookups are not broadcast, the HUD would join the session the awaiting code joins as well */
+	else if (CompletedLookup.bAwaited)
+	{
+		if (const TSharedPtr<FSikSessionTask> AwaitingTask = CompletedLookup.Task.Pin())
+		{
+			FSikSessionTaskResult TaskResult;
+			TaskResult.Result = bWasSuccessful ? ESikSessionOperationResult::Succeeded : ESikSessionOperationResult::Failed;
+			TaskResult.SessionResult = InSessionResult;
+			AwaitingTask->Complete(TaskResult);
+		}
+	}
+	else
+	{
+		MultiplayerSessionsOnFindSessionByCodeComplete.Broadcast(InSessionResult, bWasSuccessful);
+	}
+	
+	RunNextSessionCodeLookup();
+	RunPendingSessionSearch();
+}
+
+void USikSubsystem::RunPendingSessionSearch()
+{
+	if (!PendingSessionSearchQuery.IsSet() || bFindSessionsInProgress || bFindSessionByCodeInProgress)
+	{
+		return;
+	}
+	
+	const FSikSessionQuery NextQuery = PendingSessionSearchQuery.GetValue();
+	PendingSessionSearchQuery.Reset();
+	FindSessions(NextQuery);
+}
+
+void USikSubsystem::SetPendingSessionSearch(const FSikSessionQuery& InQuery)
+{
+	/** Same filters asked twice are one search, for the larger of the two result limits */
+	if (PendingSessionSearchQuery.IsSet() && PendingSessionSearchQuery.GetValue() == InQuery)
+	{
+		FSikSessionQuery& PendingQuery = PendingSessionSearchQuery.GetValue();
+		PendingQuery.MaxSearchResults = FMath::Max(PendingQuery.MaxSearchResults, InQuery.MaxSearchResults);
+		return;
+	}
+	
+	if (PendingSessionSearchQuery.IsSet())
+	{
+		LOG_INFO(TEXT("Pending search replaced by one with other filters"));
+		CancelAwaitedPendingSessionSearches(PendingSessionSearchQuery.GetValue(), &InQuery);
+	}
+	
+	PendingSessionSearchQuery = InQuery;
+}
+
+void USikSubsystem::ResetPendingSessionSearch()
+{
+	if (!PendingSessionSearchQuery.IsSet())
+	{
+		return;
+	}
+	
+	const FSikSessionQuery DroppedQuery = PendingSessionSearchQuery.GetValue();
+	PendingSessionSearchQuery.Reset();
+	CancelAwaitedPendingSessionSearches(DroppedQuery, nullptr);
+}
+
+void USikSubsystem::CancelAwaitedPendingSessionSearches(const FSikSessionQuery& InDroppedQuery, const FSikSessionQuery* InReplacementQuery)
+{
+	const UGameInstance* GameInstance = GetGameInstance();
+	const bool bRefreshScheduled = GameInstance && GameInstance->GetTimerManager().IsTimerActive(SessionSearchRefreshTimerHandle);
+	
+	/** Taken out first, a continuation may start the next search and await it */
+	TArray<TSharedPtr<FSikSessionTask>> TasksToCancel;
+	AwaitedSessionSearches.RemoveAll([&](const FSikAwaitedSessionSearch& InAwaitedSearch)
+	{
+		/** Tasks the replacement or the scheduled refresh still serves keep waiting */
+		if (InAwaitedSearch.SearchId != 0 || !InDroppedQuery.Covers(InAwaitedSearch.Query) ||
+			(InReplacementQuery && InReplacementQuery->Covers(InAwaitedSearch.Query)) ||
+			(bRefreshScheduled && ScheduledSessionSearchQuery.Covers(InAwaitedSearch.Query)))
+		{
+			return false;
+		}
+		
+		TasksToCancel.Add(InAwaitedSearch.Task.Pin());
+		return true;
+	});
+	
+	for (const TSharedPtr<FSikSessionTask>& Task : TasksToCancel)
+	{
+		if (Task.IsValid())
+		{
+			Task->Complete(ESikSessionOperationResult::Cancelled);
+		}
+	}
+}
+
+void USikSubsystem::BroadcastCachedSearchResults()
+{
+	UGameInstance* GameInstance = GetGameInstance();
+	if (!GameInstance || bCachedSearchBroadcastPending)
+	{
+		return;
+	}
+	
+	/** Deferred so callers hear back after FindSessions returns, as they would from the backend */
+	bCachedSearchBroadcastPending = true;
+	GameInstance->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this]()
+	{
+		bCachedSearchBroadcastPending = false;
+		
+		/** Cache dropped meanwhile, by a switch of backend, the search that replaces it broadcasts */
+		if (CachedSessionSearch.IsValid())
+		{
+			MultiplayerSessionsOnFindSessionsComplete.Broadcast(CachedSessionSearch.ToSharedRef(), true);
+		}
+	}));
+}
+
+void USikSubsystem::CancelFindSessions()
+{
+	LOG_INFO(TEXT("Called"));
+
+	if (!SessionInterface.IsValid())
+	{
+		LOG_ERROR(TEXT("SessionInterface is INVALID"));
+		return;
+	}
+
+	LOG_WARNING(TEXT("Aborting search"));
+
+	ResetPendingSessionSearch();
+	
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(SessionSearchRefreshTimerHandle);
+	}
+	
+	SessionSearchPasses.Reset();
+	SessionSearchPassResults.Reset();
+	ClearSessionSearchBudgetTimer();
+
+	const uint32 CancelledSearchId = bFindSessionsInProgress ? InFlightSessionSearchId : 0;
+	
+	/** Without cancelling on the backend it keeps the old search pending and ignores the next one */
+	if (bFindSessionsInProgress)
+	{
+		SessionInterface->CancelFindSessions();
+		SessionMetrics.CancelSpan(SIK_SPAN_FINDSESSIONS);
+		FlightRecorder.Record(ESikFlightEventType::Issued, ESikFlightSubject::CancelFindSessions);
+	}
+	
+	bFindSessionsInProgress = false;
+
+	SessionInterface->ClearOnFindSessionsCompleteDelegate_Handle(FindSessionsCompleteDelegateHandle);
+	
+	/** Reported as unsuccessful, an empty successful result would clear the lists of listeners until their next search */
+	const FSikSessionSearchSnapshotRef EmptySnapshot = MakeShared<FSikSessionSearchSnapshot>();
+	MultiplayerSessionsOnFindSessionsComplete.Broadcast(EmptySnapshot, false);
+	CompleteAwaitedSessionSearches(CancelledSearchId, EmptySnapshot, ESikSessionOperationResult::Cancelled);
+	
+	/** Cancelled search never completes, keep the browser polling */
+	if (bSessionBrowserPolling)
+	{
+		SetSessionBrowserPollTimer(SessionPollScheduler.MinInterval);
+	}
+	
+	/** A code lookup waiting on the cancelled search would never hear back, issue it now */
+	if (bSessionKeyLookupPending)
+	{
+		bSessionKeyLookupPending = false;
+		FindSessionBySessionKey(SessionCodeToFind);
+	}
+}
+
+void USikSubsystem::JoinSessions(const FOnlineSessionSearchResult& InSessionToJoin)
+{
+	LOG_INFO(TEXT("Called"));
+	
+	EnqueueJoinSession(FOnlineSessionSearchResult(InSessionToJoin));
+}
+
+void USikSubsystem::JoinSessions(const FSikSessionHandle& InSessionToJoin)
+{
+	if (!InSessionToJoin.IsValid())
+	{
+		LOG_ERROR(TEXT("InSessionToJoin is INVALID"));
+		return;
+	}
+	
+	/** The one copy of the join, the queued operation outlives the snapshot being replaced and adjusts the settings it joins with */
+	FOnlineSessionSearchResult SessionToJoin = *InSessionToJoin;
+	ApplyCachedLatency(SessionToJoin);
+	EnqueueJoinSession(MoveTemp(SessionToJoin));
+}
+
+void USikSubsystem::EnqueueJoinSession(FOnlineSessionSearchResult&& InSessionToJoin)
+{
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Join;
+	Operation.SessionToJoin = MoveTemp(InSessionToJoin);
+	
+	EnqueueSessionOperation(MoveTemp(Operation));
+}
+
+void USikSubsystem::ExecuteJoinSession(FOnlineSessionSearchResult& InSessionToJoin)
+{
+	LOG_INFO(TEXT("Called"));
+	
+	if (!SessionInterface.IsValid())
+	{
+		LOG_ERROR(TEXT("SessionInterface is INVALID"));
+		if (IsGameSessionOperation())
+		{
+			MultiplayerSessionsOnJoinSessionsComplete.Broadcast(EOnJoinSessionCompleteResult::UnknownError);
+		}
+		FinishSessionOperation(ESikSessionOperationResult::Failed);
+		return;
+	}
+	
+	if (!GetWorld() || GetWorld()->bIsTearingDown)
+	{
+		LOG_WARNING(TEXT("JoinSession aborted – world is tearing down"));
+		if (IsGameSessionOperation())
+		{
+			MultiplayerSessionsOnJoinSessionsComplete.Broadcast(EOnJoinSessionCompleteResult::UnknownError);
+		}
+		FinishSessionOperation(ESikSessionOperationResult::Failed);
+		return;
+	}
+
+	if (!ActiveSessionOperation.bSlotReservationRequested)
+	{
+		ActiveSessionOperation.bSlotReservationRequested = true;
+		if (RequestSlotReservation(InSessionToJoin))
+		{
+			return;
+		}
+	}
+
+	JoinSessionCompleteDelegateHandle = SessionInterface->AddOnJoinSessionCompleteDelegate_Handle(JoinSessionCompleteDelegate);
+
+	/** Dedicated servers are game servers, joined by their address rather than through a lobby */
+	if (!InSessionToJoin.Session.SessionSettings.bIsLANMatch && !InSessionToJoin.Session.SessionSettings.bIsDedicated)
+	{
+		InSessionToJoin.Session.SessionSettings.bUseLobbiesIfAvailable = true;
+		InSessionToJoin.Session.SessionSettings.bUsesPresence = true;
+	}
+	
+	const FUniqueNetIdPtr LocalUserId = GetLocalUserId();
+	if (!LocalUserId.IsValid() || !SessionInterface->JoinSession(*LocalUserId, ActiveSessionOperation.SessionName, InSessionToJoin))
+	{
+		LOG_ERROR(TEXT("Call to session interface join session function failed"));
+		
+		SessionInterface->ClearOnJoinSessionCompleteDelegate_Handle(JoinSessionCompleteDelegateHandle);
+		if (IsGameSessionOperation())
+		{
+			MultiplayerSessionsOnJoinSessionsComplete.Broadcast(EOnJoinSessionCompleteResult::UnknownError);
+		}
+		FinishSessionOperation(ESikSessionOperationResult::Failed);
+	}
+}
+
+void USikSubsystem::DestroySession(const FName InSessionName)
+{
+	LOG_INFO(TEXT("Called %s"), *InSessionName.ToString());
+	
+	if (InSessionName == NAME_GameSession)
+	{
+		ClearReconnectTarget();
+	}
+	
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Destroy;
+	Operation.SessionName = InSessionName;
+	
+	EnqueueSessionOperation(MoveTemp(Operation));
+}
+
+void USikSubsystem::ExecuteDestroySession()
+{
+	LOG_INFO(TEXT("Called"));
+	
+	if (!SessionInterface.IsValid())
+	{
+		LOG_ERROR(TEXT("SessionInterface is INVALID"));
+		if (IsGameSessionOperation())
+		{
+			MultiplayerSessionsOnDestroySessionComplete.Broadcast(false);
+		}
+		FinishSessionOperation(ESikSessionOperationResult::Failed);
+		return;
+	}
+
+	const FName SessionName = ActiveSessionOperation.SessionName;
+	if (!IsSessionInState(EOnlineSessionState::Pending, SessionName) &&
+		!IsSessionInState(EOnlineSessionState::InProgress, SessionName) &&
+		!IsSessionInState(EOnlineSessionState::Ended, SessionName))
+	{
+		LOG_ERROR(TEXT("DestroySession failed: no session to destroy"));
+		if (IsGameSessionOperation())
+		{
+			MultiplayerSessionsOnDestroySessionComplete.Broadcast(false);
+		}
+		FinishSessionOperation(ESikSessionOperationResult::Failed);
+		return;
+	}
+
+	DestroySessionCompleteDelegateHandle = SessionInterface->AddOnDestroySessionCompleteDelegate_Handle(DestroySessionCompleteDelegate);
+
+	if (!SessionInterface->DestroySession(SessionName))
+	{
+		LOG_ERROR(TEXT("Call to session interface destroy session function failed"));
+
+		SessionInterface->ClearOnDestroySessionCompleteDelegate_Handle(DestroySessionCompleteDelegateHandle);
+		if (IsGameSessionOperation())
+		{
+			MultiplayerSessionsOnDestroySessionComplete.Broadcast(false);
+		}
+		FinishSessionOperation(ESikSessionOperationResult::Failed);
+	}
+}
+
+void USikSubsystem::StartSession()
+{
+	LOG_INFO(TEXT("USikSubsystem::StartSession Called"));
+
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Start;
+	
+	EnqueueSessionOperation(MoveTemp(Operation));
+}
+
+void USikSubsystem::ExecuteStartSession()
+{
+	LOG_INFO(TEXT("Called"));
+
+	if (!SessionInterface.IsValid())
+	{
+		LOG_ERROR(TEXT("StartSession SessionInterface is INVALID"));
+		if (IsGameSessionOperation())
+		{
+			MultiplayerSessionsOnStartSessionComplete.Broadcast(false);
+		}
+		FinishSessionOperation(ESikSessionOperationResult::Failed);
+		return;
+	}
+	
+	if (!IsSessionInState(EOnlineSessionState::Pending, ActiveSessionOperation.SessionName))
+	{
+		LOG_ERROR(TEXT("StartSession called but session is NOT in Pending state"));
+		if (IsGameSessionOperation())
+		{
+			MultiplayerSessionsOnStartSessionComplete.Broadcast(false);
+		}
+		FinishSessionOperation(ESikSessionOperationResult::Failed);
+		return;
+	}
+
+	StartSessionCompleteDelegateHandle = SessionInterface->AddOnStartSessionCompleteDelegate_Handle(StartSessionCompleteDelegate);
+
+	if (!SessionInterface->StartSession(ActiveSessionOperation.SessionName))
+	{
+		LOG_ERROR(TEXT("Call to session interface start session function failed"));
+
+		SessionInterface->ClearOnStartSessionCompleteDelegate_Handle(StartSessionCompleteDelegateHandle);
+		if (IsGameSessionOperation())
+		{
+			MultiplayerSessionsOnStartSessionComplete.Broadcast(false);
+		}
+		FinishSessionOperation(ESikSessionOperationResult::Failed);
+	}
+}
+
+#pragma endregion Session Operations
+
+#pragma region Session Latency
+
+int32 USikSubsystem::GetSessionLatency(const FOnlineSessionSearchResult& InSearchResult) const
+{
+	const FSikHostLatency* HostLatency = HostLatencyCache.Find(GetSessionHostKey(InSearchResult));
+	return HostLatency ? HostLatency->PingInMs : -1;
+}
+
+void USikSubsystem::RankSessionsByLatency(TArray<FSikSessionHandle>& InOutSessions) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_SikRankSessions);
+	
+	/** Invalid handles rank with the unmeasured hosts */
+	Algo::StableSortBy(InOutSessions, [this](const FSikSessionHandle& Session)
+	{
+		const int32 PingInMs = Session.IsValid() ? GetSessionLatency(*Session) : -1;
+		return PingInMs < 0 ? MAX_int32 : PingInMs;
+	});
+}
+
+void USikSubsystem::ProbeSessionLatencies(const TArray<FOnlineSessionSearchResult>& InSearchResults)
+{
+	if (!LatencyProbe.IsValid())
+	{
+		return;
+	}
+	
+	const double Now = FPlatformTime::Seconds();
+	
+	for (const FOnlineSessionSearchResult& SearchResult : InSearchResults)
+	{
+		FString HostKey = GetSessionHostKey(SearchResult);
+		
+		if (const FSikHostLatency* HostLatency = HostLatencyCache.Find(HostKey); HostLatency && Now - HostLatency->MeasuredTime < LatencyCacheTTL)
+		{
+			continue;
+		}
+		
+		if (InFlightLatencyProbes.Contains(HostKey))
+		{
+			continue;
+		}
+		
+		bool bAlreadyQueued = false;
+		QueuedLatencyProbeHosts.Add(HostKey, &bAlreadyQueued);
+		if (bAlreadyQueued)
+		{
+			continue;
+		}
+		
+		FSikLatencyProbeRequest& Request = QueuedLatencyProbes.AddDefaulted_GetRef();
+		Request.HostKey = MoveTemp(HostKey);
+		Request.HostAddress = GetSessionEchoAddress(SearchResult);
+		Request.ReportedPingInMs = SearchResult.PingInMs;
+		SearchResult.Session.SessionSettings.Get(SETTING_PINGLOCATION, Request.PingLocation);
+	}
+	
+	PumpLatencyProbes();
+}
+
+void USikSubsystem::PumpLatencyProbes()
+{
+	/** Probes completing synchronously land here again, the outer call keeps pumping */
+	if (bPumpingLatencyProbes)
+	{
+		return;
+	}
+	
+	TGuardValue<bool> PumpingGuard(bPumpingLatencyProbes, true);
+	
+	/** Started probes are skipped with the head rather than removed, the array is only reset once drained */
+	while (LatencyProbe.IsValid() && QueuedLatencyProbes.IsValidIndex(QueuedLatencyProbesHead) && InFlightLatencyProbes.Num() < FMath::Max(1, MaxInFlightLatencyProbes))
+	{
+		const FSikLatencyProbeRequest Request = MoveTemp(QueuedLatencyProbes[QueuedLatencyProbesHead++]);
+		QueuedLatencyProbeHosts.Remove(Request.HostKey);
+		
+		InFlightLatencyProbes.Add(Request.HostKey);
+		LatencyProbe->Probe(Request, FSikOnLatencyProbeComplete::CreateUObject(this, &ThisClass::OnLatencyProbeCompleteCallback, Request.HostKey));
+	}
+	
+	if (QueuedLatencyProbesHead >= QueuedLatencyProbes.Num())
+	{
+		QueuedLatencyProbes.Reset();
+		QueuedLatencyProbesHead = 0;
+	}
+	
+	SET_DWORD_STAT(STAT_SikLatencyProbesInFlight, InFlightLatencyProbes.Num());
+	
+	if (bLatencyProbesCompleted && InFlightLatencyProbes.IsEmpty() && QueuedLatencyProbes.IsEmpty())
+	{
+		bLatencyProbesCompleted = false;
+		MultiplayerSessionsOnSessionLatenciesUpdated.Broadcast();
+	}
+}
+
+void USikSubsystem::OnLatencyProbeCompleteCallback(int32 PingInMs, FString HostKey)
+{
+	/** Cancelled probes may still report back, nothing waits for them anymore */
+	if (InFlightLatencyProbes.Remove(HostKey) == 0)
+	{
+		return;
+	}
+	
+	FSikHostLatency& HostLatency = HostLatencyCache.FindOrAdd(HostKey);
+	HostLatency.PingInMs = PingInMs;
+	HostLatency.MeasuredTime = FPlatformTime::Seconds();
+	
+	bLatencyProbesCompleted = true;
+	
+	PumpLatencyProbes();
+}
+
+void USikSubsystem::ApplyCachedLatency(FOnlineSessionSearchResult& InOutSearchResult) const
+{
+	if (const int32 PingInMs = GetSessionLatency(InOutSearchResult); PingInMs >= 0)
+	{
+		InOutSearchResult.PingInMs = PingInMs;
+	}
+}
+
+FString USikSubsystem::GetSessionHostKey(const FOnlineSessionSearchResult& InSearchResult)
+{
+	const FUniqueNetIdPtr& OwningUserId = InSearchResult.Session.OwningUserId;
+	return OwningUserId.IsValid() ? OwningUserId->ToString() : InSearchResult.GetSessionIdStr();
+}
+
+FString USikSubsystem::GetSessionEchoAddress(const FOnlineSessionSearchResult& InSearchResult) const
+{
+	int32 EchoPort = 0;
+	FString ConnectString;
+	if (LatencyProbeTransport != ESikLatencyProbeTransport::UdpEcho || !SessionInterface.IsValid() ||
+		!InSearchResult.Session.SessionSettings.Get(SETTING_LATENCYECHOPORT, EchoPort) || EchoPort <= 0 ||
+		!SessionInterface->GetResolvedConnectString(InSearchResult, NAME_GamePort, ConnectString))
+	{
+		return FString();
+	}
+	
+	/** Hosts relayed by the backend connect through "steam.<id>" and cannot be probed directly */
+	FString HostIp = ConnectString;
+	ConnectString.Split(TEXT(":"), &HostIp, nullptr, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
+	
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	const TSharedPtr<FInternetAddr> HostAddress = SocketSubsystem ? SocketSubsystem->GetAddressFromString(HostIp) : nullptr;
+	if (!HostAddress.IsValid() || !HostAddress->IsValid())
+	{
+		return FString();
+	}
+	
+	HostAddress->SetPort(EchoPort);
+	return HostAddress->ToString(true);
+}
+
+bool USikSubsystem::StartLatencyEchoServer()
+{
+	if (LatencyProbeTransport != ESikLatencyProbeTransport::UdpEcho)
+	{
+		return false;
+	}
+	
+	if (!LatencyEchoServer.IsValid())
+	{
+		LatencyEchoServer = MakeUnique<FSikUdpEchoServer>();
+	}
+	
+	return LatencyEchoServer->IsRunning() || LatencyEchoServer->Start(LatencyProbeEchoPort);
+}
+
+#pragma endregion Session Latency
+
+#pragma region Session Metrics
+
+FSikLatencyPercentiles USikSubsystem::GetSessionLatencyPercentiles(FName InSpan) const
+{
+	return SessionMetrics.GetPercentiles(InSpan);
+}
+
+FName USikSubsystem::GetSessionOperationSpan(ESikSessionOperation InOperation)
+{
+	switch (InOperation)
+	{
+	case ESikSessionOperation::Create:
+		return SIK_SPAN_CREATESESSION;
+	case ESikSessionOperation::Destroy:
+		return SIK_SPAN_DESTROYSESSION;
+	case ESikSessionOperation::Join:
+		return SIK_SPAN_JOINSESSION;
+	case ESikSessionOperation::Start:
+		return SIK_SPAN_STARTSESSION;
+	default:
+		return NAME_None;
+	}
+}
+
+void USikSubsystem::OnPostLoadMapWithWorld(UWorld* InLoadedWorld)
+{
+	if (!InLoadedWorld || InLoadedWorld->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+	
+	const bool bIsClient = InLoadedWorld->GetNetMode() == NM_Client;
+	FlightRecorder.Record(ESikFlightEventType::TravelFinished, bIsClient ? ESikFlightSubject::ClientTravel : ESikFlightSubject::ServerTravel);
+	
+	/** Transition map of seamless travel loads first, the preloads are kept until the destination is reached */
+	const bool bIsTransitionMap = InLoadedWorld->GetOutermost()->GetFName() == 
+		FName(*UGameMapsSettings::GetGameMapsSettings()->TransitionMap.GetLongPackageName());
+	if (!bIsTransitionMap)
+	{
+		ReleasePreloadedMaps();
+	}
+	
+	/** Leader is now in its game session's map, the server is up for the members to follow */
+	if (IsPartyLeader())
+	{
+		PublishPartyGameSession();
+	}
+	
+	/** Same for the host of a match, the other members are handed the code from now on */
+	if (!bIsClient && !bIsTransitionMap && MatchmakingClient.IsValid())
+	{
+		MatchmakingClient->OnLobbyLoaded();
+	}
+	
+	/** Dedicated server advertises its session from the lobby and follows the match to the match map */
+	if (bDedicatedServer && !bIsTransitionMap)
+	{
+		if (DedicatedServerStage == ESikDedicatedServerStage::Starting && !IsInDedicatedServerLobby())
+		{
+			DedicatedServerStage = ESikDedicatedServerStage::InMatch;
+		}
+		else if (DedicatedServerStage == ESikDedicatedServerStage::InMatch && IsInDedicatedServerLobby())
+		{
+			/** Game mode travelled back to the lobby on its own, the match is over */
+			ResetDedicatedServer();
+		}
+		else
+		{
+			HostDedicatedServerSession();
+		}
+	}
+	
+	if (!bIsClient && !bIsTransitionMap)
+	{
+		UpdateSlotReservationHost();
+	}
+	
+	/** The host's PostLogin is not visible to clients, the join flow ends once the client is in the session's map */
+	if (!bIsClient)
+	{
+		return;
+	}
+	
+	SessionMetrics.EndSpan(SIK_SPAN_CLIENTTRAVEL, true);
+	SessionMetrics.EndSpan(SIK_SPAN_JOINBYCODE, true);
+	
+	if (bReconnectAttemptInFlight)
+	{
+		FinishReconnect(true);
+	}
+}
+
+#pragma endregion Session Metrics
+
+#pragma region Flight Recorder
+
+FString USikSubsystem::DumpFlightRecorder(const FString& InReason)
+{
+	return FlightRecorder.Dump(InReason);
+}
+
+ESikFlightSubject USikSubsystem::GetSessionOperationSubject(ESikSessionOperation InOperation)
+{
+	switch (InOperation)
+	{
+	case ESikSessionOperation::Create:
+		return ESikFlightSubject::CreateSession;
+	case ESikSessionOperation::Destroy:
+		return ESikFlightSubject::DestroySession;
+	case ESikSessionOperation::Join:
+		return ESikFlightSubject::JoinSession;
+	case ESikSessionOperation::Start:
+		return ESikFlightSubject::StartSession;
+	default:
+		return ESikFlightSubject::None;
+	}
+}
+
+void USikSubsystem::DumpFlightRecorderOnFailure(const FString& InReason)
+{
+	if (!bDumpFlightRecorderOnFailure || FPlatformTime::Seconds() - LastFlightRecorderDumpTime < FlightRecorderMinDumpInterval)
+	{
+		return;
+	}
+	
+	LastFlightRecorderDumpTime = FPlatformTime::Seconds();
+	FlightRecorder.Dump(InReason);
+}
+
+void USikSubsystem::HandleTravelFailure(UWorld* World, ETravelFailure::Type FailureType, const FString& ErrorString)
+{
+	LOG_ERROR(TEXT("Travel failed : %s %s"), ETravelFailure::ToString(FailureType), *ErrorString);
+	
+	FlightRecorder.Record(ESikFlightEventType::TravelFailed, ESikFlightSubject::None, static_cast<uint8>(FailureType));
+	DumpFlightRecorderOnFailure(FString("TravelFailure"));
+	
+	SessionMetrics.EndSpan(SIK_SPAN_CLIENTTRAVEL, false);
+	SessionMetrics.EndSpan(SIK_SPAN_SERVERTRAVEL, false);
+	
+	/** No map load is coming to release them, the preloaded worlds would otherwise stay in memory until the player leaves */
+	ReleasePreloadedMaps();
+	
+	if (bReconnectAttemptInFlight)
+	{
+		bReconnectAttemptInFlight = false;
+		ScheduleReconnectAttempt();
+	}
+}
+
+#pragma endregion Flight Recorder
+
+#pragma region Map Preload
+
+void USikSubsystem::PreloadTravelMaps(const FString& InMapPath)
+{
+	if (!CanPreloadMaps())
+	{
+		return;
+	}
+	
+	PreloadMapPackage(InMapPath);
+	
+	if (bPreloadTransitionMap)
+	{
+		PreloadMapPackage(UGameMapsSettings::GetGameMapsSettings()->TransitionMap.GetLongPackageName());
+	}
+}
+
+void USikSubsystem::ReleasePreloadedMaps()
+{
+	if (!PreloadedMapWorlds.IsEmpty() || !PendingMapPreloads.IsEmpty())
+	{
+		LOG_INFO(TEXT("Releasing %d preloaded maps"), PreloadedMapWorlds.Num() + PendingMapPreloads.Num());
+	}
+	
+	PreloadedMapWorlds.Reset();
+	PendingMapPreloads.Reset();
+	FailedMapPreloads.Reset();
+}
+
+void USikSubsystem::ReleasePreloadedMap(const FString& InMapPath)
+{
+	const FName PackageName = GetMapPackageName(InMapPath);
+	if (PackageName.IsNone())
+	{
+		return;
+	}
+	
+	/** Transition map is shared by every travel, it stays until the destination is reached */
+	if (bPreloadTransitionMap && PackageName == FName(*UGameMapsSettings::GetGameMapsSettings()->TransitionMap.GetLongPackageName()))
+	{
+		return;
+	}
+	
+	if (UWorld* PreloadedWorld = GetPreloadedWorld(PackageName))
+	{
+		LOG_INFO(TEXT("Releasing preloaded map %s"), *PackageName.ToString());
+		PreloadedMapWorlds.Remove(PreloadedWorld);
+	}
+	
+	/** Load still in flight completes unreferenced, see OnMapPreloadComplete */
+	PendingMapPreloads.Remove(PackageName);
+	FailedMapPreloads.Remove(PackageName);
+}
+
+bool USikSubsystem::CanPreloadMaps() const
+{
+	/** PIE worlds load maps under a prefixed package name, a preload would never be used */
+	return bPreloadTravelMaps && !(GetWorld() && GetWorld()->IsPlayInEditor());
+}
+
+ESikMapPrefetchState USikSubsystem::GetMapPreloadState(const FString& InMapPath, float& OutProgress) const
+{
+	OutProgress = 0.f;
+	
+	if (!CanPreloadMaps())
+	{
+		return ESikMapPrefetchState::Skipped;
+	}
+	
+	const FName PackageName = GetMapPackageName(InMapPath);
+	if (PackageName.IsNone() || FailedMapPreloads.Contains(PackageName))
+	{
+		return ESikMapPrefetchState::Failed;
+	}
+	
+	if (PendingMapPreloads.Contains(PackageName))
+	{
+		/** Not every loader reports a percentage, -1 is read as not started yet */
+		OutProgress = FMath::Clamp(GetAsyncLoadPercentage(PackageName) / 100.f, 0.f, 1.f);
+		return ESikMapPrefetchState::Loading;
+	}
+	
+	if (GetPreloadedWorld(PackageName))
+	{
+		OutProgress = 1.f;
+		return ESikMapPrefetchState::Ready;
+	}
+	
+	return ESikMapPrefetchState::None;
+}
+
+FName USikSubsystem::GetMapPackageName(const FString& InMapPath)
+{
+	FString MapPath = InMapPath;
+	MapPath.Split(TEXT("?"), &MapPath, nullptr);
+	
+	const FString PackageName = FPackageName::ObjectPathToPackageName(MapPath);
+	return FPackageName::IsValidLongPackageName(PackageName) ? FName(*PackageName) : NAME_None;
+}
+
+void USikSubsystem::PreloadMapPackage(const FString& InMapPath)
+{
+	const FName PackageFName = GetMapPackageName(InMapPath);
+	if (PackageFName.IsNone())
+	{
+		LOG_WARNING(TEXT("Cannot preload %s, not a long package name"), *InMapPath);
+		return;
+	}
+	
+	if (PendingMapPreloads.Contains(PackageFName) || GetPreloadedWorld(PackageFName))
+	{
+		return;
+	}
+	
+	const FString PackageName = PackageFName.ToString();
+	FailedMapPreloads.Remove(PackageFName);
+	
+	/** A package left behind by an earlier travel may have lost its world to garbage collection, it is loaded again then */
+	if (UPackage* LoadedPackage = FindPackage(nullptr, *PackageName); LoadedPackage && LoadedPackage->IsFullyLoaded())
+	{
+		if (UWorld* LoadedWorld = FindPreloadedWorld(LoadedPackage))
+		{
+			PreloadedMapWorlds.Add(LoadedWorld);
+			return;
+		}
+	}
+	
+	LOG_INFO(TEXT("Preloading %s"), *PackageName);
+	
+	PendingMapPreloads.Add(PackageFName, FPlatformTime::Seconds());
+	LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate::CreateUObject(this, &ThisClass::OnMapPreloadComplete));
+}
+
+void USikSubsystem::OnMapPreloadComplete(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+{
+	/** Released while loading, the package is left to garbage collection */
+	double StartTime = 0.0;
+	if (!PendingMapPreloads.RemoveAndCopyValue(PackageName, StartTime))
+	{
+		return;
+	}
+	
+	UWorld* LoadedWorld = Result == EAsyncLoadingResult::Succeeded && LoadedPackage ? FindPreloadedWorld(LoadedPackage) : nullptr;
+	if (!LoadedWorld)
+	{
+		LOG_WARNING(TEXT("Failed to preload %s"), *PackageName.ToString());
+		FailedMapPreloads.Add(PackageName);
+		return;
+	}
+	
+	LOG_INFO(TEXT("Preloaded %s in %.0f ms"), *PackageName.ToString(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	
+	PreloadedMapWorlds.Add(LoadedWorld);
+}
+
+UWorld* USikSubsystem::FindPreloadedWorld(UPackage* InPackage)
+{
+	UWorld* World = UWorld::FindWorldInPackage(InPackage);
+	return World ? World : UWorld::FollowWorldRedirectorInPackage(InPackage);
+}
+
+UWorld* USikSubsystem::GetPreloadedWorld(const FName& InPackageName) const
+{
+	const TObjectPtr<UWorld>* PreloadedWorld = PreloadedMapWorlds.FindByPredicate([&InPackageName](const UWorld* World)
+	{
+		return World && World->GetOutermost()->GetFName() == InPackageName;
+	});
+	return PreloadedWorld ? PreloadedWorld->Get() : nullptr;
+}
+
+#pragma endregion Map Preload
+
+#pragma region Reconnect
+
+void USikSubsystem::CancelReconnect()
+{
+	if (IsReconnecting())
+	{
+		LOG_INFO(TEXT("Reconnect cancelled"));
+		FinishReconnect(false);
+	}
+}
+
+bool USikSubsystem::DeferDisconnect(UWorld* InWorld, UNetDriver* InNetDriver)
+{
+	/** Started by HandleNetworkFailure, bound after the engine's handler so it runs ahead of the engine's disconnect handling */
+	if (!IsReconnecting())
+	{
+		return false;
+	}
+	
+	/** A failed attempt leaves its pending connection behind, cancelled as the engine's handling would */
+	if (GEngine && InNetDriver)
+	{
+		GEngine->CancelPending(InNetDriver);
+	}
+	
+	LOG_INFO(TEXT("Reconnecting, staying in the current world"));
+	
+	bDisconnectDeferred = true;
+	return true;
+}
+
+bool USikSubsystem::TryStartReconnect(const UWorld* World, const ENetworkFailure::Type FailureType)
+{
+	/** Failed attempt, the engine reports the failed pending connection as a network failure */
+	if (bReconnectAttemptInFlight)
+	{
+		bReconnectAttemptInFlight = false;
+		ScheduleReconnectAttempt();
+		return true;
+	}
+	
+	if (IsReconnecting())
+	{
+		return true;
+	}
+	
+	/** Version or checksum mismatches fail the same way every time, only dropped connections are worth retrying */
+	const bool bIsTransient = FailureType == ENetworkFailure::ConnectionLost || FailureType == ENetworkFailure::ConnectionTimeout;
+	
+	if (!bReconnectOnNetworkFailure || !bIsTransient || !World || World->GetNetMode() != NM_Client ||
+		!LastJoinedSession.IsSet() || LastJoinedConnectString.IsEmpty() || ReconnectMaxAttempts <= 0)
+	{
+		return false;
+	}
+	
+	LOG_WARNING(TEXT("%s, reconnecting to %s"), ENetworkFailure::ToString(FailureType), *LastJoinedConnectString);
+	
+	SessionMetrics.BeginSpan(SIK_SPAN_RECONNECT);
+	FlightRecorder.Record(ESikFlightEventType::Issued, ESikFlightSubject::Reconnect, static_cast<uint8>(FailureType));
+	
+	/** Stale flows of the lost connection would otherwise end as successes once the reconnect lands */
+	SessionMetrics.CancelSpan(SIK_SPAN_CLIENTTRAVEL);
+	SessionMetrics.CancelSpan(SIK_SPAN_JOINBYCODE);
+	
+	MultiplayerSessionsOnReconnectStarted.Broadcast(ReconnectMaxAttempts);
+	
+	ScheduleReconnectAttempt();
+	
+	return true;
+}
+
+void USikSubsystem::ScheduleReconnectAttempt()
+{
+	UGameInstance* GameInstance = GetGameInstance();
+	if (!GameInstance || ReconnectAttempt >= ReconnectMaxAttempts)
+	{
+		LOG_ERROR(TEXT("Reconnect failed after %d attempt(s)"), ReconnectAttempt);
+		FinishReconnect(false);
+		return;
+	}
+	
+	const float BaseDelay = FMath::Min(ReconnectInitialDelay * FMath::Pow(2.f, ReconnectAttempt), ReconnectMaxDelay);
+	const float Delay = FMath::Max(BaseDelay * (1.f + FMath::FRandRange(-ReconnectJitterFraction, ReconnectJitterFraction)), 
+		KINDA_SMALL_NUMBER);
+	
+	++ReconnectAttempt;
+	
+	LOG_INFO(TEXT("Reconnect attempt %d / %d in %.2f s"), ReconnectAttempt, ReconnectMaxAttempts, Delay);
+	
+	GameInstance->GetTimerManager().SetTimer(ReconnectTimerHandle, 
+		FTimerDelegate::CreateUObject(this, &ThisClass::ExecuteReconnectAttempt), Delay, false);
+}
+
+void USikSubsystem::ExecuteReconnectAttempt()
+{
+	if (!SessionInterface.IsValid() || !LastJoinedSession.IsSet())
+	{
+		LOG_WARNING(TEXT("Session is gone, not reconnecting"));
+		FinishReconnect(false);
+		return;
+	}
+	
+	/** The backend dropped the session while disconnected, the join travels once it completes, see OnJoinSessionCompleteCallback */
+	if (!SessionInterface->GetNamedSession(NAME_GameSession))
+	{
+		if (!IsSessionOperationQueued(ESikSessionOperation::Join))
+		{
+			LOG_INFO(TEXT("Session is gone, joining it again"));
+			
+			FSikQueuedSessionOperation Operation;
+			Operation.Operation = ESikSessionOperation::Join;
+			Operation.SessionToJoin = LastJoinedSession.GetValue();
+			Operation.bReconnect = true;
+			
+			bReconnectAttemptInFlight = true;
+			EnqueueSessionOperation(MoveTemp(Operation));
+		}
+		else
+		{
+			ScheduleReconnectAttempt();
+		}
+		return;
+	}
+	
+	const UGameInstance* GameInstance = GetGameInstance();
+	APlayerController* PlayerController = GameInstance ? GameInstance->GetFirstLocalPlayerController() : nullptr;
+	if (!PlayerController)
+	{
+		ScheduleReconnectAttempt();
+		return;
+	}
+	
+	FlightRecorder.Record(ESikFlightEventType::TravelStarted, ESikFlightSubject::Reconnect, static_cast<uint8>(ReconnectAttempt));
+	
+	bReconnectAttemptInFlight = true;
+	PlayerController->ClientTravel(LastJoinedConnectString, ETravelType::TRAVEL_Absolute);
+}
+
+void USikSubsystem::FinishReconnect(const bool bWasSuccessful, const bool bLeaveSession)
+{
+	LOG_INFO(TEXT("Reconnect %s after %d attempt(s)"), bWasSuccessful ? TEXT("succeeded") : TEXT("failed"), ReconnectAttempt);
+	
+	if (const UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(ReconnectTimerHandle);
+	}
+	
+	FlightRecorder.Record(ESikFlightEventType::Finished, ESikFlightSubject::Reconnect, bWasSuccessful, ReconnectAttempt);
+	SessionMetrics.EndSpan(SIK_SPAN_RECONNECT, bWasSuccessful);
+	
+	ReconnectAttempt = 0;
+	bReconnectAttemptInFlight = false;
+	
+	const bool bLeaveWorld = bDisconnectDeferred;
+	bDisconnectDeferred = false;
+	
+	if (!bWasSuccessful && bLeaveSession)
+	{
+		HandleAppExit(false);
+		
+		/** The engine's disconnect handling held off by DeferDisconnect, only now the client leaves for the default map */
+		UWorld* World = GetWorld();
+		if (bLeaveWorld && GEngine && World)
+		{
+			LOG_WARNING(TEXT("Reconnect failed, leaving for the default map"));
+			GEngine->HandleDisconnect(World, World->GetNetDriver());
+		}
+	}
+	
+	MultiplayerSessionsOnReconnectComplete.Broadcast(bWasSuccessful);
+}
+
+void USikSubsystem::ClearReconnectTarget()
+{
+	LastJoinedSession.Reset();
+	LastJoinedConnectString.Reset();
+}
+
+#pragma endregion Reconnect
+
+#pragma region Party
+
+void USikSubsystem::CreateParty(const int32 InMaxMembers)
+{
+	LOG_INFO(TEXT("Called MaxMembers: %d"), InMaxMembers);
+	
+	if (bLanMode)
+	{
+		LOG_WARNING(TEXT("Parties rely on invites and presence, not available in LAN mode"));
+		return;
+	}
+	
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Create;
+	Operation.SessionName = NAME_PartySession;
+	Operation.MaxPartyMembers = FMath::Max(InMaxMembers, 2);
+	
+	EnqueueSessionOperation(MoveTemp(Operation));
+}
+
+void USikSubsystem::JoinParty(const FOnlineSessionSearchResult& InPartyToJoin)
+{
+	LOG_INFO(TEXT("Called"));
+	
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Join;
+	Operation.SessionName = NAME_PartySession;
+	Operation.SessionToJoin = InPartyToJoin;
+	
+	EnqueueSessionOperation(MoveTemp(Operation));
+}
+
+void USikSubsystem::LeaveParty()
+{
+	PartyGameSessionCode.Reset();
+	QueuedSessionCodeLookups.RemoveAll([](const FSikSessionCodeLookup& QueuedLookup) { return QueuedLookup.bFollowParty; });
+	
+	DestroySession(NAME_PartySession);
+}
+
+bool USikSubsystem::IsInParty() const
+{
+	return SessionInterface.IsValid() && SessionInterface->GetNamedSession(NAME_PartySession) != nullptr;
+}
+
+bool USikSubsystem::IsPartyLeader() const
+{
+	const FNamedOnlineSession* PartySession = SessionInterface.IsValid() ? SessionInterface->GetNamedSession(NAME_PartySession) : nullptr;
+	return PartySession && PartySession->bHosting;
+}
+
+void USikSubsystem::ExecuteCreateParty(const int32 InMaxMembers)
+{
+	if (!SessionInterface.IsValid())
+	{
+		LOG_ERROR(TEXT("CreateParty SessionInterface is INVALID"));
+		FinishSessionOperation(ESikSessionOperationResult::Failed);
+		return;
+	}
+	
+	CreateSessionCompleteDelegateHandle = SessionInterface->AddOnCreateSessionCompleteDelegate_Handle(CreateSessionCompleteDelegate);
+	
+	/** Not advertised, the session browser never lists parties, friends get in through invites and presence */
+	FOnlineSessionSettings PartySettings;
+	PartySettings.bIsLANMatch = false;
+	PartySettings.NumPublicConnections = InMaxMembers;
+	PartySettings.bAllowJoinInProgress = true;
+	PartySettings.bAllowJoinViaPresence = true;
+	PartySettings.bAllowInvites = true;
+	PartySettings.bShouldAdvertise = false;
+	PartySettings.bUsesPresence = true;
+	PartySettings.bUseLobbiesIfAvailable = true;
+	PartySettings.Set(SETTING_PARTY, true, EOnlineDataAdvertisementType::ViaOnlineService);
+	PartySettings.Set(SETTING_PARTY_GAMECODE, FString(), EOnlineDataAdvertisementType::ViaOnlineService);
+	
+	const FUniqueNetIdPtr LocalUserId = GetLocalUserId();
+	if (!LocalUserId.IsValid() || !SessionInterface->CreateSession(*LocalUserId, NAME_PartySession, PartySettings))
+	{
+		LOG_ERROR(TEXT("CreateParty failed to execute create session"));
+		
+		SessionInterface->ClearOnCreateSessionCompleteDelegate_Handle(CreateSessionCompleteDelegateHandle);
+		FinishSessionOperation(ESikSessionOperationResult::Failed);
+	}
+}
+
+void USikSubsystem::PublishPartyGameSession()
+{
+	const FNamedOnlineSession* PartySession = SessionInterface.IsValid() ? SessionInterface->GetNamedSession(NAME_PartySession) : nullptr;
+	if (!PartySession || !PartySession->bHosting)
+	{
+		return;
+	}
+	
+	/** No game session leaves the code empty, members stay where they are */
+	FString GameSessionCode;
+	if (SessionInterface->GetNamedSession(NAME_GameSession))
+	{
+		GetSessionSetting(SETTING_SESSIONKEY, GameSessionCode);
+	}
+	
+	if (GameSessionCode == PartyGameSessionCode)
+	{
+		return;
+	}
+	
+	LOG_INFO(TEXT("Party following game session %s"), GameSessionCode.IsEmpty() ? TEXT("none") : *GameSessionCode);
+	
+	PartyGameSessionCode = GameSessionCode;
+	
+	FOnlineSessionSettings UpdatedPartySettings = PartySession->SessionSettings;
+	UpdatedPartySettings.Set(SETTING_PARTY_GAMECODE, GameSessionCode, EOnlineDataAdvertisementType::ViaOnlineService);
+	SessionInterface->UpdateSession(NAME_PartySession, UpdatedPartySettings, true);
+}
+
+void USikSubsystem::OnSessionSettingsUpdated(FName SessionName, const FOnlineSessionSettings& UpdatedSettings)
+{
+	if (SessionName != NAME_PartySession || IsPartyLeader())
+	{
+		return;
+	}
+	
+	FString GameSessionCode;
+	UpdatedSettings.Get(SETTING_PARTY_GAMECODE, GameSessionCode);
+	if (GameSessionCode.IsEmpty() || GameSessionCode == PartyGameSessionCode)
+	{
+		return;
+	}
+	
+	PartyGameSessionCode = GameSessionCode;
+	
+	/** Already there, joined by code or invite before the leader's update arrived */
+	if (FString CurrentGameSessionCode; SessionInterface->GetNamedSession(NAME_GameSession) && 
+		GetSessionSetting(SETTING_SESSIONKEY, CurrentGameSessionCode) && CurrentGameSessionCode == GameSessionCode)
+	{
+		return;
+	}
+	
+	LOG_INFO(TEXT("Party leader moved to game session %s, following"), *GameSessionCode);
+	
+	FSikSessionCodeLookup Lookup;
+	Lookup.SessionCode = GameSessionCode;
+	Lookup.bFollowParty = true;
+	
+	EnqueueSessionCodeLookup(MoveTemp(Lookup));
+}
+
+void USikSubsystem::OnSessionUserInviteAccepted(const bool bWasSuccessful, const int32 ControllerId, FUniqueNetIdPtr UserId, 
+	const FOnlineSessionSearchResult& InviteResult)
+{
+	bool bIsParty = false;
+	if (!bWasSuccessful || !InviteResult.IsValid() || !InviteResult.Session.SessionSettings.Get(SETTING_PARTY, bIsParty) || !bIsParty)
+	{
+		return;
+	}
+	
+	LOG_INFO(TEXT("Party invite accepted, joining"));
+	
+	JoinParty(InviteResult);
+}
+
+void USikSubsystem::FollowPartyIntoGameSession(const FOnlineSessionSearchResult& InSessionResult, const bool bWasSuccessful)
+{
+	if (!bWasSuccessful || !InSessionResult.IsValid())
+	{
+		LOG_WARNING(TEXT("Could not find the party leader's game session %s"), *PartyGameSessionCode);
+		
+		/** Cleared so the next update of the same code is tried again */
+		PartyGameSessionCode.Reset();
+		return;
+	}
+	
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Join;
+	Operation.SessionToJoin = InSessionResult;
+	Operation.bFollowParty = true;
+	
+	EnqueueSessionOperation(MoveTemp(Operation));
+}
+
+#pragma endregion Party
+
+#pragma region LAN
+
+bool USikSubsystem::SetLanMode(const bool bInLanMode)
+{
+	if (bInLanMode == bLanMode)
+	{
+		return true;
+	}
+	
+	if (MockSession.IsValid())
+	{
+		LOG_WARNING(TEXT("Mock backend in use, LAN mode cannot be switched"));
+		return false;
+	}
+	
+	if (!CanSwitchSessionInterface())
+	{
+		LOG_WARNING(TEXT("Leave the session and wait for the running operations before switching LAN mode"));
+		return false;
+	}
+	
+	IOnlineSessionPtr TargetSessionInterface;
+	if (bInLanMode)
+	{
+		TargetSessionInterface = ResolveLanSessionInterface(LanSubsystemName);
+	}
+	else if (const IOnlineSubsystem* OnlineSubsystem = IOnlineSubsystem::Get())
+	{
+		TargetSessionInterface = OnlineSubsystem->GetSessionInterface();
+	}
+	
+	if (!TargetSessionInterface.IsValid())
+	{
+		LOG_ERROR(TEXT("No session interface to switch %s LAN mode with"), bInLanMode ? TEXT("to") : TEXT("from"));
+		return false;
+	}
+	
+	ResetSessionSearchState();
+	
+	LOG_INFO(TEXT("Switching to %s sessions"), bInLanMode ? *FString::Printf(TEXT("LAN (%s)"), *LanSubsystemName.ToString()) : TEXT("online"));
+	
+	SetSessionInterface(TargetSessionInterface);
+	bLanMode = bInLanMode;
+	
+	/** An open browser lists the new backend right away */
+	if (bSessionBrowserPolling)
+	{
+		PollSessionBrowser();
+	}
+	
+	return true;
+}
+
+TSharedPtr<FSikMockOnlineSession, ESPMode::ThreadSafe> USikSubsystem::UseMockBackend(const FSikMockBackendSettings& InSettings)
+{
+	if (!CanSwitchSessionInterface())
+	{
+		LOG_WARNING(TEXT("Leave the session and wait for the running operations before switching to the mock backend"));
+		return nullptr;
+	}
+	
+	ResetSessionSearchState();
+	
+	LOG_WARNING(TEXT("Switching to the mock session backend, seed %d"), InSettings.Seed);
+	
+	MockSession = MakeShared<FSikMockOnlineSession, ESPMode::ThreadSafe>(InSettings);
+	SetSessionInterface(MockSession);
+	bLanMode = false;
+	
+	if (bSessionBrowserPolling)
+	{
+		PollSessionBrowser();
+	}
+	
+	return MockSession;
+}
+
+bool USikSubsystem::CanSwitchSessionInterface() const
+{
+	const bool bHasSession = SessionInterface.IsValid() && 
+		(SessionInterface->GetNamedSession(NAME_GameSession) || SessionInterface->GetNamedSession(NAME_PartySession));
+	return !bHasSession && !bFindSessionByCodeInProgress && QueuedSessionCodeLookups.IsEmpty() && 
+		ActiveSessionOperation.Operation == ESikSessionOperation::None && SessionOperationQueue.IsEmpty();
+}
+
+void USikSubsystem::ResetSessionSearchState()
+{
+	/** Searches and cached results of one backend mean nothing to the other */
+	if (bFindSessionsInProgress)
+	{
+		CancelFindSessions();
+	}
+	ResetPendingSessionSearch();
+	CachedSessionSearch.Reset();
+	
+	/** Rate limit and backoff were earned on the other backend */
+	LastSessionSearchStartTime = 0.0;
+	SessionPollScheduler.Reset();
+	LastSessionBrowserFingerprint = 0;
+}
+
+IOnlineSessionPtr USikSubsystem::ResolveLanSessionInterface(FName& OutSubsystemName)
+{
+	/** Steam runs LAN beacons of its own, used while it is signed in so player ids stay Steam ids */
+	if (const IOnlineSubsystem* DefaultSubsystem = IOnlineSubsystem::Get(); DefaultSubsystem && DefaultSubsystem->GetSubsystemName() == STEAM_SUBSYSTEM)
+	{
+		const IOnlineIdentityPtr SteamIdentity = DefaultSubsystem->GetIdentityInterface();
+		if (SteamIdentity.IsValid() && SteamIdentity->GetLoginStatus(0) == ELoginStatus::LoggedIn && DefaultSubsystem->GetSessionInterface().IsValid())
+		{
+			OutSubsystemName = STEAM_SUBSYSTEM;
+			return DefaultSubsystem->GetSessionInterface();
+		}
+	}
+	
+	IOnlineSubsystem* NullSubsystem = IOnlineSubsystem::Get(NULL_SUBSYSTEM);
+	if (!NullSubsystem || !NullSubsystem->GetSessionInterface().IsValid())
+	{
+		LOG_ERROR(TEXT("Neither Steam nor the Null online subsystem can run LAN sessions"));
+		return nullptr;
+	}
+	
+	/** Null hosts and joins on behalf of a signed in local user, it signs in locally without any service */
+	if (const IOnlineIdentityPtr NullIdentity = NullSubsystem->GetIdentityInterface(); 
+		NullIdentity.IsValid() && NullIdentity->GetLoginStatus(0) != ELoginStatus::LoggedIn)
+	{
+		NullIdentity->AutoLogin(0);
+	}
+	
+	OutSubsystemName = NULL_SUBSYSTEM;
+	return NullSubsystem->GetSessionInterface();
+}
+
+void USikSubsystem::SetSessionInterface(const IOnlineSessionPtr& InSessionInterface)
+{
+	if (SessionInterface.IsValid())
+	{
+		SessionInterface->ClearOnSessionSettingsUpdatedDelegate_Handle(SessionSettingsUpdatedDelegateHandle);
+		SessionInterface->ClearOnSessionUserInviteAcceptedDelegate_Handle(SessionUserInviteAcceptedDelegateHandle);
+	}
+	
+	SessionInterface = InSessionInterface;
+	
+	if (SessionInterface.IsValid())
+	{
+		SessionSettingsUpdatedDelegateHandle = SessionInterface->AddOnSessionSettingsUpdatedDelegate_Handle(
+			FOnSessionSettingsUpdatedDelegate::CreateUObject(this, &ThisClass::OnSessionSettingsUpdated));
+		SessionUserInviteAcceptedDelegateHandle = SessionInterface->AddOnSessionUserInviteAcceptedDelegate_Handle(
+			FOnSessionUserInviteAcceptedDelegate::CreateUObject(this, &ThisClass::OnSessionUserInviteAccepted));
+	}
+}
+
+#pragma endregion LAN
+
+#pragma region Session Tasks
+
+FSikSessionTaskHandle USikSubsystem::CreateSessionAsync(const FSikCustomSessionSettings& InCustomSessionSettings, const float InTimeout)
+{
+	LOG_INFO(TEXT("Called"));
+	
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Create;
+	Operation.CreateSettings = InCustomSessionSettings;
+	
+	return EnqueueAwaitedSessionOperation(MoveTemp(Operation), InTimeout);
+}
+
+FSikSessionTaskHandle USikSubsystem::JoinSessionAsync(const FOnlineSessionSearchResult& InSessionToJoin, const float InTimeout)
+{
+	LOG_INFO(TEXT("Called"));
+	
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Join;
+	Operation.SessionToJoin = InSessionToJoin;
+	
+	return EnqueueAwaitedSessionOperation(MoveTemp(Operation), InTimeout);
+}
+
+FSikSessionTaskHandle USikSubsystem::StartSessionAsync(const float InTimeout)
+{
+	LOG_INFO(TEXT("Called"));
+	
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Start;
+	
+	return EnqueueAwaitedSessionOperation(MoveTemp(Operation), InTimeout);
+}
+
+FSikSessionTaskHandle USikSubsystem::FindSessionsAsync(const FSikSessionQuery& InQuery, const float InTimeout)
+{
+	const TSharedRef<FSikSessionTask> Task = MakeSessionTask(TEXT("FindSessions"), InTimeout);
+	
+	if (!SessionInterface.IsValid())
+	{
+		Task->Complete(ESikSessionOperationResult::Failed);
+		return FSikSessionTaskHandle(Task);
+	}
+	
+	/** FindSessions answers from the cache while joining, no search of this query is run for the task to wait on */
+	if (IsSessionOperationQueued(ESikSessionOperation::Join))
+	{
+		Task->Complete(ESikSessionOperationResult::Cancelled);
+		return FSikSessionTaskHandle(Task);
+	}
+	
+	if (const double CacheAge = GetCachedSearchResultsAge(InQuery); CacheAge >= 0.0 && CacheAge < SearchResultsCacheTTL)
+	{
+		FSikSessionTaskResult TaskResult;
+		TaskResult.Result = ESikSessionOperationResult::Succeeded;
+		TaskResult.SearchSnapshot = GetCachedSearchResults(InQuery);
+		Task->Complete(TaskResult);
+		return FSikSessionTaskHandle(Task);
+	}
+	
+	/** Searches are shared and deferred by FindSessions, the task is tied to the running search or the next one covering its query */
+	FSikAwaitedSessionSearch& AwaitedSearch = AwaitedSessionSearches.AddDefaulted_GetRef();
+	AwaitedSearch.Query = InQuery;
+	AwaitedSearch.Task = Task;
+	if (bFindSessionsInProgress && InFlightSessionSearchQuery.Covers(InQuery))
+	{
+		AwaitedSearch.SearchId = InFlightSessionSearchId;
+	}
+	
+	const TWeakObjectPtr<USikSubsystem> WeakThis(this);
+	const TWeakPtr<FSikSessionTask> WeakTask = Task;
+	Task->OnAbort = [WeakThis, WeakTask](ESikSessionOperationResult InResult)
+	{
+		USikSubsystem* Subsystem = WeakThis.Get();
+		const TSharedPtr<FSikSessionTask> PinnedTask = WeakTask.Pin();
+		if (!Subsystem || !PinnedTask.IsValid())
+		{
+			return;
+		}
+		
+		const int32 Index = Subsystem->AwaitedSessionSearches.IndexOfByPredicate([&PinnedTask](const FSikAwaitedSessionSearch& InAwaitedSearch)
+		{
+			return InAwaitedSearch.Task.HasSameObject(PinnedTask.Get());
+		});
+		if (Index == INDEX_NONE)
+		{
+			return;
+		}
+		
+		const uint32 SearchId = Subsystem->AwaitedSessionSearches[Index].SearchId;
+		Subsystem->AwaitedSessionSearches.RemoveAt(Index);
+		
+		/** Lost callback would leave the search flagged as running, holding off the browser and every later search */
+		if (InResult == ESikSessionOperationResult::TimedOut && SearchId != 0 && Subsystem->bFindSessionsInProgress && 
+			Subsystem->InFlightSessionSearchId == SearchId)
+		{
+			LOG_WARNING(TEXT("Session search timed out, cancelling it"));
+			Subsystem->CancelFindSessions();
+		}
+	};
+	
+	FindSessions(InQuery);
+	
+	return FSikSessionTaskHandle(Task);
+}
+
+FSikSessionTaskHandle USikSubsystem::FindSessionByCodeAsync(const FString& InSessionCode, const float InTimeout)
+{
+	const TSharedRef<FSikSessionTask> Task = MakeSessionTask(FString::Printf(TEXT("FindSessionByCode %s"), *InSessionCode), InTimeout);
+	
+	if (!SessionInterface.IsValid())
+	{
+		Task->Complete(ESikSessionOperationResult::Failed);
+		return FSikSessionTaskHandle(Task);
+	}
+	
+	const TWeakObjectPtr<USikSubsystem> WeakThis(this);
+	const TWeakPtr<FSikSessionTask> WeakTask = Task;
+	Task->OnAbort = [WeakThis, WeakTask](ESikSessionOperationResult InResult)
+	{
+		USikSubsystem* Subsystem = WeakThis.Get();
+		const TSharedPtr<FSikSessionTask> PinnedTask = WeakTask.Pin();
+		if (!Subsystem || !PinnedTask.IsValid())
+		{
+			return;
+		}
+		
+		/** Still waiting behind another lookup, dropped without ever running */
+		const int32 QueuedIndex = Subsystem->QueuedSessionCodeLookups.IndexOfByPredicate([&PinnedTask](const FSikSessionCodeLookup& QueuedLookup)
+		{
+			return QueuedLookup.Task.HasSameObject(PinnedTask.Get());
+		});
+		if (QueuedIndex != INDEX_NONE)
+		{
+			Subsystem->QueuedSessionCodeLookups.RemoveAt(QueuedIndex);
+			return;
+		}
+		
+		if (!Subsystem->ActiveSessionCodeLookup.Task.HasSameObject(PinnedTask.Get()))
+		{
+			return;
+		}
+		
+		/** Lookup runs on without the task, its result is dropped rather than broadcast to the UI */
+		Subsystem->ActiveSessionCodeLookup.Task.Reset();
+		
+		if (InResult == ESikSessionOperationResult::TimedOut && Subsystem->bFindSessionByCodeInProgress)
+		{
+			Subsystem->TimeOutFindSessionByCode();
+		}
+	};
+	
+	FSikSessionCodeLookup Lookup;
+	Lookup.SessionCode = InSessionCode;
+	Lookup.Task = Task;
+	Lookup.bAwaited = true;
+	
+	EnqueueSessionCodeLookup(MoveTemp(Lookup));
+	
+	return FSikSessionTaskHandle(Task);
+}
+
+bool USikSubsystem::TravelToJoinedSession()
+{
+	const UGameInstance* GameInstance = GetGameInstance();
+	APlayerController* PlayerController = GameInstance ? GameInstance->GetFirstLocalPlayerController() : nullptr;
+	
+	FString ConnectString;
+	if (!PlayerController || !GetResolvedConnectString(ConnectString))
+	{
+		LOG_ERROR(TEXT("Failed to find a local player or the address of the joined session"));
+		return false;
+	}
+	
+	LOG_INFO(TEXT("Travelling to %s"), *ConnectString);
+	
+	/** Closed once the session's map has loaded */
+	SessionMetrics.BeginSpan(SIK_SPAN_CLIENTTRAVEL);
+	FlightRecorder.Record(ESikFlightEventType::TravelStarted, ESikFlightSubject::ClientTravel);
+	
+	PlayerController->ClientTravel(ConnectString, ETravelType::TRAVEL_Absolute);
+	return true;
+}
+
+TSharedRef<FSikSessionTask> USikSubsystem::MakeSessionTask(const FString& InDescription, const float InTimeout)
+{
+	const TSharedRef<FSikSessionTask> Task = MakeShared<FSikSessionTask>(InDescription);
+	const TWeakPtr<FSikSessionTask> WeakTask = Task;
+	PendingSessionTasks.Add(Task);
+	
+	UGameInstance* GameInstance = GetGameInstance();
+	if (const float Timeout = InTimeout > 0.f ? InTimeout : SessionTaskTimeout; GameInstance && Timeout > 0.f)
+	{
+		GameInstance->GetTimerManager().SetTimer(Task->TimeoutTimerHandle, FTimerDelegate::CreateWeakLambda(this, [WeakTask]()
+		{
+			if (const TSharedPtr<FSikSessionTask> PinnedTask = WeakTask.Pin())
+			{
+				LOG_WARNING(TEXT("%s timed out"), *PinnedTask->GetDescription());
+				PinnedTask->Abort(ESikSessionOperationResult::TimedOut);
+			}
+		}), Timeout, false);
+	}
+	
+	const TWeakObjectPtr<USikSubsystem> WeakThis(this);
+	Task->AddContinuation([WeakThis, WeakTask](const FSikSessionTaskResult&)
+	{
+		USikSubsystem* Subsystem = WeakThis.Get();
+		const TSharedPtr<FSikSessionTask> PinnedTask = WeakTask.Pin();
+		if (!Subsystem || !PinnedTask.IsValid())
+		{
+			return;
+		}
+		
+		if (UGameInstance* OwningGameInstance = Subsystem->GetGameInstance())
+		{
+			OwningGameInstance->GetTimerManager().ClearTimer(PinnedTask->TimeoutTimerHandle);
+		}
+		
+		Subsystem->PendingSessionTasks.Remove(PinnedTask.ToSharedRef());
+	});
+	
+	return Task;
+}
+
+FSikSessionTaskHandle USikSubsystem::EnqueueAwaitedSessionOperation(FSikQueuedSessionOperation&& InOperation, const float InTimeout)
+{
+	const TSharedRef<FSikSessionTask> Task = MakeSessionTask(FString::Printf(TEXT("%s on %s"), 
+		*UEnum::GetValueAsString(InOperation.Operation), *InOperation.SessionName.ToString()), InTimeout);
+	
+	const TWeakObjectPtr<USikSubsystem> WeakThis(this);
+	const TWeakPtr<FSikSessionTask> WeakTask = Task;
+	Task->OnAbort = [WeakThis, WeakTask](ESikSessionOperationResult InResult)
+	{
+		const TSharedPtr<FSikSessionTask> PinnedTask = WeakTask.Pin();
+		if (USikSubsystem* Subsystem = WeakThis.Get(); Subsystem && PinnedTask.IsValid())
+		{
+			Subsystem->AbortSessionOperationTask(PinnedTask.ToSharedRef(), InResult);
+		}
+	};
+	
+	InOperation.Tasks.Add(Task);
+	InOperation.bAwaited = true;
+	
+	EnqueueSessionOperation(MoveTemp(InOperation));
+	
+	return FSikSessionTaskHandle(Task);
+}
+
+void USikSubsystem::AbortSessionOperationTask(const TSharedRef<FSikSessionTask>& InTask, ESikSessionOperationResult InResult)
+{
+	if (ActiveSessionOperation.Tasks.Contains(InTask))
+	{
+		if (InResult == ESikSessionOperationResult::TimedOut)
+		{
+			TimeOutActiveSessionOperation();
+			return;
+		}
+		
+		/** Backend calls cannot be taken back, the operation runs on without the task */
+		ActiveSessionOperation.Tasks.Remove(InTask);
+		return;
+	}
+	
+	for (int32 Index = 0; Index < SessionOperationQueue.Num(); ++Index)
+	{
+		FSikQueuedSessionOperation& QueuedOperation = SessionOperationQueue[Index];
+		if (QueuedOperation.Tasks.Remove(InTask) == 0)
+		{
+			continue;
+		}
+		
+		if (QueuedOperation.bAwaited && QueuedOperation.Tasks.IsEmpty())
+		{
+			const FSikQueuedSessionOperation DroppedOperation = MoveTemp(QueuedOperation);
+			SessionOperationQueue.RemoveAt(Index);
+			ReportSessionOperation(DroppedOperation, ESikSessionOperationResult::Cancelled);
+		}
+		return;
+	}
+}
+
+void USikSubsystem::TimeOutActiveSessionOperation()
+{
+	const FString OperationName = StaticEnum<ESikSessionOperation>()->GetNameStringByValue(
+		static_cast<int64>(ActiveSessionOperation.Operation));
+	
+	LOG_WARNING(TEXT("%s on %s timed out, abandoning it"), *OperationName, *ActiveSessionOperation.SessionName.ToString());
+	
+	AbandonActiveSessionOperation(ESikSessionOperationResult::TimedOut);
+	DumpFlightRecorderOnFailure(OperationName + TEXT("TimedOut"));
+}
+
+void USikSubsystem::AbandonActiveSessionOperation(const ESikSessionOperationResult InResult)
+{
+	const ESikSessionOperation Operation = ActiveSessionOperation.Operation;
+	
+	/** A late callback of the abandoned call must not finish the operation running after it */
+	if (SessionInterface.IsValid())
+	{
+		switch (Operation)
+		{
+		case ESikSessionOperation::Create:
+			SessionInterface->ClearOnCreateSessionCompleteDelegate_Handle(CreateSessionCompleteDelegateHandle);
+			break;
+		case ESikSessionOperation::Join:
+			SessionInterface->ClearOnJoinSessionCompleteDelegate_Handle(JoinSessionCompleteDelegateHandle);
+			DestroySlotReservationClient();
+			break;
+		case ESikSessionOperation::Destroy:
+			SessionInterface->ClearOnDestroySessionCompleteDelegate_Handle(DestroySessionCompleteDelegateHandle);
+			break;
+		case ESikSessionOperation::Start:
+			SessionInterface->ClearOnStartSessionCompleteDelegate_Handle(StartSessionCompleteDelegateHandle);
+			break;
+		default:
+			break;
+		}
+	}
+	
+	BroadcastSessionOperationFailure(ActiveSessionOperation);
+	FinishSessionOperation(InResult);
+}
+
+void USikSubsystem::BroadcastSessionOperationFailure(const FSikQueuedSessionOperation& InOperation)
+{
+	/** No travel follows a failed create or join, whoever requested it */
+	if (InOperation.SessionName == NAME_GameSession && 
+		(InOperation.Operation == ESikSessionOperation::Create || InOperation.Operation == ESikSessionOperation::Join))
+	{
+		ReleasePreloadedMaps();
+	}
+	
+	if (!IsGameSessionOperation(InOperation))
+	{
+		return;
+	}
+	
+	switch (InOperation.Operation)
+	{
+	case ESikSessionOperation::Create:
+		MultiplayerSessionsOnCreateSessionComplete.Broadcast(false);
+		break;
+	case ESikSessionOperation::Join:
+		MultiplayerSessionsOnJoinSessionsComplete.Broadcast(EOnJoinSessionCompleteResult::UnknownError);
+		break;
+	case ESikSessionOperation::Destroy:
+		MultiplayerSessionsOnDestroySessionComplete.Broadcast(false);
+		break;
+	case ESikSessionOperation::Start:
+		MultiplayerSessionsOnStartSessionComplete.Broadcast(false);
+		break;
+	default:
+		break;
+	}
+}
+
+void USikSubsystem::TimeOutFindSessionByCode()
+{
+	LOG_WARNING(TEXT("Lookup of session code %s timed out, abandoning it"), *SessionCodeToFind);
+	
+	bFindSessionByCodeInProgress = false;
+	bSessionKeyLookupPending = false;
+	
+	CancelSessionCodeSearch();
+	
+	CompleteFindSessionByCode(FOnlineSessionSearchResult(), false);
+}
+
+void USikSubsystem::CompleteAwaitedSessionSearches(const uint32 InSearchId, const FSikSessionSearchSnapshotRef& InSnapshot, 
+	const ESikSessionOperationResult InResult)
+{
+	if (InSearchId == 0)
+	{
+		return;
+	}
+	
+	/** Taken out first, a continuation may start the next search and await it */
+	TArray<TSharedPtr<FSikSessionTask>> TasksToComplete;
+	AwaitedSessionSearches.RemoveAll([InSearchId, &TasksToComplete](const FSikAwaitedSessionSearch& InAwaitedSearch)
+	{
+		if (InAwaitedSearch.SearchId != InSearchId)
+		{
+			return false;
+		}
+		
+		TasksToComplete.Add(InAwaitedSearch.Task.Pin());
+		return true;
+	});
+	
+	FSikSessionTaskResult TaskResult;
+	TaskResult.Result = InResult;
+	TaskResult.SearchSnapshot = InSnapshot;
+	for (const TSharedPtr<FSikSessionTask>& Task : TasksToComplete)
+	{
+		if (Task.IsValid())
+		{
+			Task->Complete(TaskResult);
+		}
+	}
+}
+
+void USikSubsystem::CancelSessionTasks()
+{
+	const TArray<TSharedRef<FSikSessionTask>> TasksToCancel = PendingSessionTasks;
+	for (const TSharedRef<FSikSessionTask>& Task : TasksToCancel)
+	{
+		Task->Abort(ESikSessionOperationResult::Cancelled);
+	}
+	
+	PendingSessionTasks.Reset();
+}
+
+#pragma endregion Session Tasks
+
+#pragma region Quick Match
+
+void USikSubsystem::QuickMatch(const FSikSessionQuery& InQuery, const FTimespan InDeadline)
+{
+	LOG_INFO(TEXT("Called Map: %s | GameMode: %s | Players: %s | Deadline: %.1fs"), *InQuery.MapName, *InQuery.GameMode, 
+		*InQuery.Players, InDeadline.GetTotalSeconds());
+	
+	if (bQuickMatching)
+	{
+		LOG_WARNING(TEXT("Quick match already running, ignoring"));
+		return;
+	}
+	
+	UGameInstance* GameInstance = GetGameInstance();
+	if (!SessionInterface.IsValid() || !GameInstance)
+	{
+		LOG_ERROR(TEXT("QuickMatch SessionInterface is INVALID"));
+		MultiplayerSessionsOnQuickMatchComplete.Broadcast(ESikMatchResult::Failed);
+		return;
+	}
+	
+	bQuickMatching = true;
+	bQuickMatchJoining = false;
+	QuickMatchQuery = InQuery;
+	QuickMatchQuery.bPublicOnly = true;
+	QuickMatchQuery.MinOpenSlots = FMath::Max(1, InQuery.MinOpenSlots);
+	QuickMatchQuery.MaxSearchResults = FMath::Clamp(InQuery.MaxSearchResults, 1, FMath::Max(1, MaxRetainedSearchResults));
+	QuickMatchCandidates.Reset();
+	QuickMatchTriedSessions.Reset();
+	
+	const float Deadline = FMath::Max(static_cast<float>(InDeadline.GetTotalSeconds()), UE_KINDA_SMALL_NUMBER);
+	QuickMatchDeadlineTime = FPlatformTime::Seconds() + Deadline;
+	
+	SessionMetrics.BeginSpan(SIK_SPAN_QUICKMATCH);
+	FlightRecorder.Record(ESikFlightEventType::Issued, ESikFlightSubject::QuickMatch);
+	
+	GameInstance->GetTimerManager().SetTimer(QuickMatchDeadlineTimerHandle, this, &ThisClass::OnQuickMatchDeadline, Deadline, false);
+	
+	SearchQuickMatchCandidates();
+}
+
+void USikSubsystem::CancelQuickMatch()
+{
+	if (!bQuickMatching)
+	{
+		return;
+	}
+	
+	LOG_INFO(TEXT("Called"));
+	
+	CancelMatchFlowStep(&ThisClass::QuickMatchStep);
+	
+	FinishQuickMatch(ESikMatchResult::Cancelled);
+}
+
+void USikSubsystem::SearchQuickMatchCandidates()
+{
+	const double TimeLeft = GetQuickMatchTimeLeft();
+	if (TimeLeft <= 0.0)
+	{
+		HostQuickMatch();
+		return;
+	}
+	
+	RunMatchFlowStep(&ThisClass::QuickMatchStep, FindSessionsAsync(QuickMatchQuery, static_cast<float>(TimeLeft)), 
+		&ThisClass::OnQuickMatchCandidatesFound);
+}
+
+void USikSubsystem::OnQuickMatchCandidatesFound(const FSikSessionTaskResult& InResult)
+{
+	if (!InResult.WasSuccessful())
+	{
+		LOG_WARNING(TEXT("Quick match search : %s"), *UEnum::GetValueAsString(InResult.Result));
+	}
+	
+	/** Backend already applied the query, checked again in case it ignored a term, like the session browser does */
+	FSikCustomSessionSettings QueryFilter;
+	QueryFilter.MapName = QuickMatchQuery.MapName;
+	QueryFilter.GameMode = QuickMatchQuery.GameMode;
+	QueryFilter.Players = QuickMatchQuery.Players;
+	const FSikSessionListFilter Filter(QueryFilter);
+	
+	const TArray<FOnlineSessionSearchResult> NoResults;
+	const TArray<FOnlineSessionSearchResult>& SearchResults = InResult.SearchSnapshot.IsValid() ? 
+		InResult.SearchSnapshot->GetResults() : NoResults;
+	
+	TArray<TPair<float, int32>> ScoredCandidates;
+	for (int32 Index = 0; Index < SearchResults.Num(); ++Index)
+	{
+		const FOnlineSessionSearchResult& SearchResult = SearchResults[Index];
+		FSikPackedSessionSettings SessionSettings;
+		if (SearchResult.Session.NumOpenPublicConnections < QuickMatchQuery.MinOpenSlots || 
+			!Filter.Matches(SearchResult, SessionSettings) || QuickMatchTriedSessions.Contains(SearchResult.GetSessionIdStr()))
+		{
+			continue;
+		}
+		
+		ScoredCandidates.Emplace(ScoreQuickMatchCandidate(SearchResult, SessionSettings), Index);
+	}
+	
+	/** Stable so equal scores keep the order the backend returned them in */
+	Algo::StableSort(ScoredCandidates, [](const TPair<float, int32>& A, const TPair<float, int32>& B)
+	{
+		return A.Key > B.Key;
+	});
+	
+	QuickMatchCandidates.Reset();
+	for (int32 Index = 0; Index < FMath::Min(ScoredCandidates.Num(), FMath::Max(1, QuickMatchMaxCandidates)); ++Index)
+	{
+		QuickMatchCandidates.Add(InResult.SearchSnapshot->GetHandle(ScoredCandidates[Index].Value));
+	}
+	
+	LOG_INFO(TEXT("Quick match has %d candidate(s) out of %d session(s)"), QuickMatchCandidates.Num(), SearchResults.Num());
+	FlightRecorder.Record(ESikFlightEventType::Callback, ESikFlightSubject::QuickMatch, InResult.WasSuccessful(), 
+		QuickMatchCandidates.Num());
+	
+	if (!QuickMatchCandidates.IsEmpty())
+	{
+		JoinNextQuickMatchCandidate();
+		return;
+	}
+	
+	/** Nothing fits yet, looks again until the deadline hosts */
+	UGameInstance* GameInstance = GetGameInstance();
+	if (!GameInstance || GetQuickMatchTimeLeft() <= 0.0)
+	{
+		HostQuickMatch();
+		return;
+	}
+	
+	GameInstance->GetTimerManager().SetTimer(QuickMatchRetryTimerHandle, this, &ThisClass::SearchQuickMatchCandidates, 
+		FMath::Max(QuickMatchRetryInterval, UE_KINDA_SMALL_NUMBER), false);
+}
+
+void USikSubsystem::JoinNextQuickMatchCandidate()
+{
+	if (QuickMatchCandidates.IsEmpty())
+	{
+		SearchQuickMatchCandidates();
+		return;
+	}
+	
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Join;
+	Operation.SessionToJoin = *QuickMatchCandidates[0];
+	Operation.bMatchFlow = true;
+	QuickMatchCandidates.RemoveAt(0);
+	
+	const FString SessionId = Operation.SessionToJoin.GetSessionIdStr();
+	QuickMatchTriedSessions.Add(SessionId);
+	
+	LOG_INFO(TEXT("Quick match joining %s, %d candidate(s) left"), *SessionId, QuickMatchCandidates.Num());
+	
+	bQuickMatchJoining = true;
+	RunMatchFlowStep(&ThisClass::QuickMatchStep, EnqueueAwaitedSessionOperation(MoveTemp(Operation), 0.f), 
+		&ThisClass::OnQuickMatchJoinComplete);
+}
+
+void USikSubsystem::OnQuickMatchJoinComplete(const FSikSessionTaskResult& InResult)
+{
+	bQuickMatchJoining = false;
+	
+	if (InResult.WasSuccessful())
+	{
+		FinishQuickMatch(ESikMatchResult::Joined);
+		return;
+	}
+	
+	/** A later create or join on the game session replaced this one, the player has moved on */
+	if (InResult.Result == ESikSessionOperationResult::Cancelled)
+	{
+		FinishQuickMatch(ESikMatchResult::Cancelled);
+		return;
+	}
+	
+	LOG_WARNING(TEXT("Quick match join failed : %s"), LexToString(InResult.JoinResult));
+	
+	/** Deadline passed while joining, there is no time left for the other candidates */
+	if (GetQuickMatchTimeLeft() <= 0.0)
+	{
+		HostQuickMatch();
+		return;
+	}
+	
+	JoinNextQuickMatchCandidate();
+}
+
+void USikSubsystem::HostQuickMatch()
+{
+	if (const UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(QuickMatchDeadlineTimerHandle);
+		GameInstance->GetTimerManager().ClearTimer(QuickMatchRetryTimerHandle);
+	}
+	
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Create;
+	Operation.bMatchFlow = true;
+	
+	/** Pinned fields of the query first, then the preferred settings, then the first entry of the schema tables */
+	FSikCustomSessionSettings& Settings = Operation.CreateSettings;
+	Settings = QuickMatchHostSettings;
+	Settings.Visibility = FString("Public");
+	if (QuickMatchQuery.MapName != SETTING_FILTER_ANY)
+	{
+		Settings.MapName = QuickMatchQuery.MapName;
+	}
+	
+	if (QuickMatchQuery.GameMode != SETTING_FILTER_ANY)
+	{
+		Settings.GameMode = QuickMatchQuery.GameMode;
+	}
+	
+	if (QuickMatchQuery.Players != SETTING_FILTER_ANY)
+	{
+		Settings.Players = QuickMatchQuery.Players;
+	}
+	FillUnsetSessionSettings(Settings);
+	
+	LOG_INFO(TEXT("Quick match hosting Map: %s | GameMode: %s | Players: %s"), *Settings.MapName, *Settings.GameMode, *Settings.Players);
+	
+	ClearReconnectTarget();
+	
+	RunMatchFlowStep(&ThisClass::QuickMatchStep, EnqueueAwaitedSessionOperation(MoveTemp(Operation), 0.f), 
+		&ThisClass::OnQuickMatchHostComplete);
+}
+
+void USikSubsystem::OnQuickMatchHostComplete(const FSikSessionTaskResult& InResult)
+{
+	if (InResult.WasSuccessful())
+	{
+		FinishQuickMatch(ESikMatchResult::Hosted);
+		return;
+	}
+	
+	FinishQuickMatch(InResult.Result == ESikSessionOperationResult::Cancelled ? 
+		ESikMatchResult::Cancelled : ESikMatchResult::Failed);
+}
+
+void USikSubsystem::OnQuickMatchDeadline()
+{
+	if (!bQuickMatching)
+	{
+		return;
+	}
+	
+	/** Join may still succeed, its outcome decides whether to host */
+	if (bQuickMatchJoining)
+	{
+		LOG_INFO(TEXT("Quick match deadline passed, waiting for the running join"));
+		return;
+	}
+	
+	LOG_INFO(TEXT("Quick match deadline passed, nothing fit"));
+	
+	CancelMatchFlowStep(&ThisClass::QuickMatchStep);
+	
+	HostQuickMatch();
+}
+
+float USikSubsystem::ScoreQuickMatchCandidate(const FOnlineSessionSearchResult& InSearchResult, 
+	const FSikPackedSessionSettings& InSettings) const
+{
+	/** Probed latency first, the ping the backend returned with the session otherwise */
+	int32 PingInMs = GetSessionLatency(InSearchResult);
+	if (PingInMs < 0 && InSearchResult.PingInMs >= 0 && InSearchResult.PingInMs < MAX_QUERY_PING)
+	{
+		PingInMs = InSearchResult.PingInMs;
+	}
+	const float PingScore = PingInMs < 0 ? 0.5f : 
+		1.f - FMath::Clamp(static_cast<float>(PingInMs) / FMath::Max(1, QuickMatchMaxPing), 0.f, 1.f);
+	
+	/** Fuller sessions start sooner, and leave the emptier ones to fill up */
+	const int32 MaxPlayers = InSearchResult.Session.SessionSettings.NumPublicConnections;
+	const int32 FilledSlots = MaxPlayers - InSearchResult.Session.NumOpenPublicConnections;
+	const float FillScore = MaxPlayers > 0 ? FMath::Clamp(static_cast<float>(FilledSlots) / MaxPlayers, 0.f, 1.f) : 0.f;
+	
+	/** Fields pinned by the query match already, the ones left at "Any" are compared with the preferred settings */
+	const FSikPackedSessionSettings Preferred = FSikSessionSchema::FromReadable(QuickMatchHostSettings);
+	int32 NumCompared = 0;
+	int32 NumMatched = 0;
+	auto CompareSetting = [&NumCompared, &NumMatched](const bool bCompare, const bool bMatches)
+	{
+		NumCompared += bCompare ? 1 : 0;
+		NumMatched += bCompare && bMatches ? 1 : 0;
+	};
+	CompareSetting(QuickMatchQuery.MapName == SETTING_FILTER_ANY && Preferred.MapId != 0, InSettings.MapId == Preferred.MapId);
+	CompareSetting(QuickMatchQuery.GameMode == SETTING_FILTER_ANY && Preferred.GameModeId != 0, 
+		InSettings.GameModeId == Preferred.GameModeId);
+	CompareSetting(QuickMatchQuery.Players == SETTING_FILTER_ANY && Preferred.Players != ESikPlayersConfig::Any, 
+		InSettings.Players == Preferred.Players);
+	const float SettingsScore = NumCompared > 0 ? static_cast<float>(NumMatched) / NumCompared : 1.f;
+	
+	const float TotalWeight = QuickMatchPingWeight + QuickMatchFillWeight + QuickMatchSettingsWeight;
+	if (TotalWeight <= 0.f)
+	{
+		return 0.f;
+	}
+	
+	return (QuickMatchPingWeight * PingScore + QuickMatchFillWeight * FillScore + QuickMatchSettingsWeight * SettingsScore) / TotalWeight;
+}
+
+void USikSubsystem::RunMatchFlowStep(FSikSessionTaskHandle USikSubsystem::* InStepSlot, const FSikSessionTaskHandle& InStep, 
+	void (USikSubsystem::*InOnComplete)(const FSikSessionTaskResult&))
+{
+	this->*InStepSlot = InStep;
+	
+	const TWeakObjectPtr<USikSubsystem> WeakThis(this);
+	const TWeakPtr<FSikSessionTask> WeakStepTask = InStep.Task;
+	InStep.OnComplete([WeakThis, WeakStepTask, InStepSlot, InOnComplete](const FSikSessionTaskResult& InResult)
+	{
+		USikSubsystem* Subsystem = WeakThis.Get();
+		
+		/** Steps dropped by a deadline or a cancel still complete, only the tracked one moves the flow on */
+		const TSharedPtr<FSikSessionTask> StepTask = WeakStepTask.Pin();
+		if (!Subsystem || !StepTask.IsValid() || (Subsystem->*InStepSlot).Task != StepTask)
+		{
+			return;
+		}
+		
+		Subsystem->*InStepSlot = FSikSessionTaskHandle();
+		(Subsystem->*InOnComplete)(InResult);
+	});
+}
+
+void USikSubsystem::CancelMatchFlowStep(FSikSessionTaskHandle USikSubsystem::* InStepSlot)
+{
+	/** Dropped before cancelling so the cancelled step does not move the flow on */
+	const FSikSessionTaskHandle CancelledStep = this->*InStepSlot;
+	this->*InStepSlot = FSikSessionTaskHandle();
+	CancelledStep.Cancel();
+}
+
+void USikSubsystem::FillUnsetSessionSettings(FSikCustomSessionSettings& InOutSettings) const
+{
+	if (InOutSettings.MapName.IsEmpty() && !SessionMapNames.IsEmpty())
+	{
+		InOutSettings.MapName = SessionMapNames[0];
+	}
+	
+	if (InOutSettings.GameMode.IsEmpty() && !SessionGameModes.IsEmpty())
+	{
+		InOutSettings.GameMode = SessionGameModes[0];
+	}
+	
+	if (InOutSettings.Players.IsEmpty())
+	{
+		InOutSettings.Players = FSikSessionSchema::GetPlayersName(ESikPlayersConfig::OneVsOne);
+	}
+}
+
+double USikSubsystem::GetQuickMatchTimeLeft() const
+{
+	return QuickMatchDeadlineTime - FPlatformTime::Seconds();
+}
+
+void USikSubsystem::FinishQuickMatch(const ESikMatchResult InResult)
+{
+	LOG_INFO(TEXT("Quick match : %s"), *UEnum::GetValueAsString(InResult));
+	
+	bQuickMatching = false;
+	bQuickMatchJoining = false;
+	QuickMatchStep = FSikSessionTaskHandle();
+	QuickMatchCandidates.Reset();
+	QuickMatchTriedSessions.Reset();
+	
+	if (const UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(QuickMatchDeadlineTimerHandle);
+		GameInstance->GetTimerManager().ClearTimer(QuickMatchRetryTimerHandle);
+	}
+	
+	if (InResult == ESikMatchResult::Cancelled)
+	{
+		SessionMetrics.CancelSpan(SIK_SPAN_QUICKMATCH);
+	}
+	else
+	{
+		SessionMetrics.EndSpan(SIK_SPAN_QUICKMATCH, InResult != ESikMatchResult::Failed);
+	}
+	FlightRecorder.Record(ESikFlightEventType::Finished, ESikFlightSubject::QuickMatch, static_cast<uint8>(InResult));
+	
+	MultiplayerSessionsOnQuickMatchComplete.Broadcast(InResult);
+	
+	if (InResult == ESikMatchResult::Failed)
+	{
+		DumpFlightRecorderOnFailure(TEXT("QuickMatchFailed"));
+	}
+}
+
+#pragma endregion Quick Match
+
+#pragma region Matchmaking
+
+void USikSubsystem::StartMatchmaking(const FString& InRegion, const int32 InSkill, const FSikCustomSessionSettings& InPreferences)
+{
+	if (!MatchmakingClient.IsValid())
+	{
+		LOG_ERROR(TEXT("StartMatchmaking called before the subsystem was initialized"));
+		MultiplayerSessionsOnMatchmakingComplete.Broadcast(ESikMatchResult::Failed);
+		return;
+	}
+	
+	MatchmakingClient->Start(InRegion, InSkill, InPreferences);
+}
+
+void USikSubsystem::CancelMatchmaking()
+{
+	if (MatchmakingClient.IsValid())
+	{
+		MatchmakingClient->Cancel();
+	}
+}
+
+#pragma endregion Matchmaking
+
+#pragma region Dedicated Server
+
+void USikSubsystem::ResetDedicatedServer()
+{
+	if (!bDedicatedServer || DedicatedServerStage == ESikDedicatedServerStage::Resetting)
+	{
+		return;
+	}
+	
+	LOG_INFO(TEXT("Resetting the dedicated server"));
+	
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(DedicatedServerRetryTimerHandle);
+	}
+	
+	CancelMatchFlowStep(&ThisClass::DedicatedServerStep);
+	
+	DedicatedServerStage = ESikDedicatedServerStage::Resetting;
+	DedicatedServerEmptySince = 0.0;
+	AdvertisedDedicatedServerLoad = -1;
+	
+	ClearReconnectTarget();
+	
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Destroy;
+	
+	RunMatchFlowStep(&ThisClass::DedicatedServerStep, EnqueueAwaitedSessionOperation(MoveTemp(Operation), 0.f), 
+		&ThisClass::OnDedicatedServerSessionDestroyed);
+}
+
+void USikSubsystem::HandleDedicatedServerLobbyPlayersChanged(const int32 InNumPlayers)
+{
+	if (!bDedicatedServer || DedicatedServerStage != ESikDedicatedServerStage::Lobby)
+	{
+		return;
+	}
+	
+	UpdateDedicatedServerLoad();
+	
+	int32 MaxPlayers = 0;
+	if (!GetMaxPlayers(MaxPlayers) || InNumPlayers < MaxPlayers)
+	{
+		return;
+	}
+	
+	LOG_INFO(TEXT("Lobby full with %d players, starting the match"), InNumPlayers);
+	
+	DedicatedServerStage = ESikDedicatedServerStage::Starting;
+	RunMatchFlowStep(&ThisClass::DedicatedServerStep, StartSessionAsync(), &ThisClass::OnDedicatedServerSessionStarted);
+}
+
+void USikSubsystem::HostDedicatedServerSession()
+{
+	if (DedicatedServerStage != ESikDedicatedServerStage::Idle)
+	{
+		return;
+	}
+	
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+	
+	if (!IsInDedicatedServerLobby())
+	{
+		if (DedicatedServerLobbyMapPath.IsEmpty())
+		{
+			LOG_ERROR(TEXT("DedicatedServerLobbyMapPath is not set, the session is advertised from %s"), *World->GetMapName());
+		}
+		else
+		{
+			LOG_INFO(TEXT("Travelling to the lobby %s before advertising the session"), *DedicatedServerLobbyMapPath);
+			World->ServerTravel(DedicatedServerLobbyMapPath);
+			return;
+		}
+	}
+	
+	const FSikCustomSessionSettings Settings = GetDedicatedServerSessionSettings();
+	LOG_INFO(TEXT("Advertising dedicated server Map: %s | GameMode: %s | Players: %s"), *Settings.MapName, *Settings.GameMode, 
+		*Settings.Players);
+	
+	DedicatedServerStage = ESikDedicatedServerStage::Creating;
+	RunMatchFlowStep(&ThisClass::DedicatedServerStep, CreateSessionAsync(Settings), &ThisClass::OnDedicatedServerSessionCreated);
+}
+
+void USikSubsystem::OnDedicatedServerSessionCreated(const FSikSessionTaskResult& InResult)
+{
+	if (!InResult.WasSuccessful())
+	{
+		LOG_ERROR(TEXT("Dedicated server session not created : %s, retrying in %.0fs"), *UEnum::GetValueAsString(InResult.Result), 
+			DedicatedServerRetryInterval);
+		
+		DedicatedServerStage = ESikDedicatedServerStage::Idle;
+		if (UGameInstance* GameInstance = GetGameInstance())
+		{
+			GameInstance->GetTimerManager().SetTimer(DedicatedServerRetryTimerHandle, this, &ThisClass::HostDedicatedServerSession, 
+				FMath::Max(DedicatedServerRetryInterval, 1.f), false);
+		}
+		return;
+	}
+	
+	FString SessionCode;
+	GetSessionSetting(SETTING_SESSIONKEY, SessionCode);
+	LOG_INFO(TEXT("Dedicated server advertised with code %s"), *SessionCode);
+	
+	DedicatedServerStage = ESikDedicatedServerStage::Lobby;
+	
+	/** Members load the match map while the lobby fills, as they would with a listen host picking the map */
+	const UWorld* World = GetWorld();
+	const FString* MatchMapPath = DedicatedServerMatchMapPaths.Find(GetDedicatedServerSessionSettings().MapName);
+	if (ASikLobbyGameState* LobbyGameState = World ? World->GetGameState<ASikLobbyGameState>() : nullptr; LobbyGameState && MatchMapPath)
+	{
+		LobbyGameState->SetPrefetchMapPath(*MatchMapPath);
+	}
+	
+	/** Players may have connected while the session was being created */
+	HandleDedicatedServerLobbyPlayersChanged(GetDedicatedServerNumPlayers());
+}
+
+void USikSubsystem::OnDedicatedServerSessionStarted(const FSikSessionTaskResult& InResult)
+{
+	if (!InResult.WasSuccessful())
+	{
+		LOG_WARNING(TEXT("Backend did not start the session : %s, starting the match anyway"), *UEnum::GetValueAsString(InResult.Result));
+	}
+	
+	const FString* MatchMapPath = DedicatedServerMatchMapPaths.Find(GetDedicatedServerSessionSettings().MapName);
+	UWorld* World = GetWorld();
+	if (!MatchMapPath || !World)
+	{
+		LOG_ERROR(TEXT("No DedicatedServerMatchMapPaths entry for %s, the match cannot start"), 
+			*GetDedicatedServerSessionSettings().MapName);
+		ResetDedicatedServer();
+		return;
+	}
+	
+	LOG_INFO(TEXT("ServerTravel to: %s"), **MatchMapPath);
+	
+	FlightRecorder.Record(ESikFlightEventType::TravelStarted, ESikFlightSubject::ServerTravel);
+	World->ServerTravel(*MatchMapPath);
+}
+
+void USikSubsystem::OnDedicatedServerSessionDestroyed(const FSikSessionTaskResult& InResult)
+{
+	/** A session left behind makes the create fail, which retries until it is gone */
+	if (!InResult.WasSuccessful())
+	{
+		LOG_WARNING(TEXT("Dedicated server session not destroyed : %s"), *UEnum::GetValueAsString(InResult.Result));
+	}
+	
+	DedicatedServerStage = ESikDedicatedServerStage::Idle;
+	HostDedicatedServerSession();
+}
+
+void USikSubsystem::UpdateDedicatedServerLoad()
+{
+	if (DedicatedServerStage != ESikDedicatedServerStage::Lobby && DedicatedServerStage != ESikDedicatedServerStage::InMatch)
+	{
+		return;
+	}
+	
+	const int32 NumPlayers = GetDedicatedServerNumPlayers();
+	
+	/** Everyone left the match, the server goes back to advertising an empty lobby */
+	if (DedicatedServerStage == ESikDedicatedServerStage::InMatch)
+	{
+		const double Now = FPlatformTime::Seconds();
+		DedicatedServerEmptySince = NumPlayers > 0 ? 0.0 : DedicatedServerEmptySince > 0.0 ? DedicatedServerEmptySince : Now;
+		if (DedicatedServerEmptySince > 0.0 && Now - DedicatedServerEmptySince >= DedicatedServerResetDelay)
+		{
+			ResetDedicatedServer();
+			return;
+		}
+	}
+	
+	const FNamedOnlineSession* Session = SessionInterface.IsValid() ? SessionInterface->GetNamedSession(NAME_GameSession) : nullptr;
+	const int32 Load = GetDedicatedServerLoad(NumPlayers);
+	if (!Session || (AdvertisedDedicatedServerLoad >= 0 && FMath::Abs(Load - AdvertisedDedicatedServerLoad) < DedicatedServerLoadStep &&
+		(Load == 100) == (AdvertisedDedicatedServerLoad == 100)))
+	{
+		return;
+	}
+	
+	LOG_INFO(TEXT("Advertising server load %d%% with %d player(s)"), Load, NumPlayers);
+	AdvertisedDedicatedServerLoad = Load;
+	
+	FOnlineSessionSettings UpdatedSessionSettings = Session->SessionSettings;
+	UpdatedSessionSettings.Set(SETTING_SERVERLOAD, Load, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	SessionInterface->UpdateSession(NAME_GameSession, UpdatedSessionSettings, true);
+}
+
+int32 USikSubsystem::GetDedicatedServerLoad(const int32 InNumPlayers) const
+{
+	int32 MaxPlayers = 0;
+	const float PlayerLoad = GetMaxPlayers(MaxPlayers) && MaxPlayers > 0 ? static_cast<float>(InNumPlayers) / MaxPlayers : 0.f;
+	
+	/** Game thread work of the last frame, the idle time the server sleeps at its tick rate is not counted */
+	const float FrameLoad = static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime)) / FMath::Max(DedicatedServerFrameBudgetMs, 1.f);
+	
+	return FMath::Clamp(FMath::RoundToInt32(FMath::Max(PlayerLoad, FrameLoad) * 100.f), 0, 100);
+}
+
+int32 USikSubsystem::GetDedicatedServerNumPlayers() const
+{
+	const UWorld* World = GetWorld();
+	const AGameModeBase* GameMode = World ? World->GetAuthGameMode() : nullptr;
+	return GameMode ? GameMode->GetNumPlayers() : 0;
+}
+
+bool USikSubsystem::IsInDedicatedServerLobby() const
+{
+	const UWorld* World = GetWorld();
+	return World && !DedicatedServerLobbyMapPath.IsEmpty() && 
+		World->GetOutermost()->GetFName() == FName(*FPackageName::ObjectPathToPackageName(DedicatedServerLobbyMapPath));
+}
+
+FSikCustomSessionSettings USikSubsystem::GetDedicatedServerSessionSettings() const
+{
+	FSikCustomSessionSettings Settings = DedicatedServerSessionSettings;
+	FParse::Value(FCommandLine::Get(), TEXT("SikMap="), Settings.MapName);
+	FParse::Value(FCommandLine::Get(), TEXT("SikGameMode="), Settings.GameMode);
+	FParse::Value(FCommandLine::Get(), TEXT("SikPlayers="), Settings.Players);
+	Settings.Visibility = FString("Public");
+	FillUnsetSessionSettings(Settings);
+	return Settings;
+}
+
+#pragma endregion Dedicated Server
+
+#pragma region Slot Reservations
+
+void USikSubsystem::HandleLobbyPlayerLogin(const FUniqueNetIdRepl& InUniqueId)
+{
+	if (APartyBeaconHost* ReservationHost = SlotReservationHost.Get())
+	{
+		ReserveSlotForLobbyPlayer(*ReservationHost, InUniqueId);
+	}
+}
+
+void USikSubsystem::HandleLobbyPlayerLogout(const FUniqueNetIdRepl& InUniqueId)
+{
+	if (APartyBeaconHost* ReservationHost = SlotReservationHost.Get(); ReservationHost && InUniqueId.IsValid())
+	{
+		ReservationHost->HandlePlayerLogout(InUniqueId);
+	}
+}
+
+bool USikSubsystem::RequestSlotReservation(const FOnlineSessionSearchResult& InSessionToJoin)
+{
+	/** Members of a party were reserved for by the leader they follow */
+	int32 BeaconPort = 0;
+	if (!bUseSlotReservations || ActiveSessionOperation.SessionName != NAME_GameSession || ActiveSessionOperation.bFollowParty ||
+		!InSessionToJoin.Session.SessionSettings.Get(SETTING_BEACONPORT, BeaconPort) || BeaconPort <= 0)
+	{
+		return false;
+	}
+	
+	UWorld* World = GetWorld();
+	const FUniqueNetIdPtr LocalUserId = GetLocalUserId();
+	if (!World || !LocalUserId.IsValid())
+	{
+		return false;
+	}
+	
+	DestroySlotReservationClient();
+	
+	APartyBeaconClient* ReservationClient = World->SpawnActor<APartyBeaconClient>(APartyBeaconClient::StaticClass());
+	if (!ReservationClient)
+	{
+		return false;
+	}
+	
+	const TArray<FPlayerReservation> Members = GetSlotReservationMembers();
+	LOG_INFO(TEXT("Reserving %d slot(s) through the beacon on port %d"), Members.Num(), BeaconPort);
+	
+	FlightRecorder.Record(ESikFlightEventType::Issued, ESikFlightSubject::SlotReservation, 0, Members.Num());
+	
+	SlotReservationClient = ReservationClient;
+	ReservationClient->OnReservationRequestComplete().BindUObject(this, &ThisClass::OnSlotReservationComplete);
+	ReservationClient->OnHostConnectionFailure().BindUObject(this, &ThisClass::OnSlotReservationConnectionFailure);
+	
+	/** A failure reported from within the request has already moved the join on */
+	if (!ReservationClient->RequestReservation(InSessionToJoin, FUniqueNetIdRepl(LocalUserId), Members) && SlotReservationClient.IsValid())
+	{
+		LOG_WARNING(TEXT("Could not connect to the beacon of the host, joining without a reservation"));
+		DestroySlotReservationClient();
+		return false;
+	}
+	
+	return true;
+}
+
+void USikSubsystem::OnSlotReservationComplete(const EPartyReservationResult::Type InResult)
+{
+	DestroySlotReservationClient();
+	
+	LOG_INFO(TEXT("Slot reservation : %s"), EPartyReservationResult::ToString(InResult));
+	
+	const bool bReserved = InResult == EPartyReservationResult::ReservationAccepted || InResult == EPartyReservationResult::ReservationDuplicate;
+	FlightRecorder.Record(ESikFlightEventType::Callback, ESikFlightSubject::SlotReservation, bReserved);
+	
+	if (ActiveSessionOperation.Operation != ESikSessionOperation::Join)
+	{
+		return;
+	}
+	
+	if (bReserved)
+	{
+		ExecuteJoinSession(ActiveSessionOperation.SessionToJoin);
+		return;
+	}
+	
+	EOnJoinSessionCompleteResult::Type JoinResult = EOnJoinSessionCompleteResult::UnknownError;
+	switch (InResult)
+	{
+	case EPartyReservationResult::PartyLimitReached:
+	case EPartyReservationResult::IncorrectPlayerCount:
+	case EPartyReservationResult::ReservationDenied:
+		JoinResult = EOnJoinSessionCompleteResult::SessionIsFull;
+		break;
+	case EPartyReservationResult::BadSessionId:
+		JoinResult = EOnJoinSessionCompleteResult::SessionDoesNotExist;
+		break;
+	default:
+		break;
+	}
+	
+	/** Same outcome as a join the backend turned down, without the join ever being made */
+	OnJoinSessionCompleteCallback(ActiveSessionOperation.SessionName, JoinResult);
+}
+
+void USikSubsystem::OnSlotReservationConnectionFailure()
+{
+	DestroySlotReservationClient();
+	
+	LOG_WARNING(TEXT("Beacon of the host not reachable, joining without a reservation"));
+	
+	FlightRecorder.Record(ESikFlightEventType::Callback, ESikFlightSubject::SlotReservation, false);
+	
+	if (ActiveSessionOperation.Operation == ESikSessionOperation::Join)
+	{
+		ExecuteJoinSession(ActiveSessionOperation.SessionToJoin);
+	}
+}
+
+void USikSubsystem::DestroySlotReservationClient()
+{
+	/** Unbound first, a late reply must not move on a join that was abandoned or is no longer the active one */
+	if (APartyBeaconClient* ReservationClient = SlotReservationClient.Get())
+	{
+		ReservationClient->OnReservationRequestComplete().Unbind();
+		ReservationClient->OnHostConnectionFailure().Unbind();
+		ReservationClient->DestroyBeacon();
+	}
+	
+	SlotReservationClient.Reset();
+}
+
+TArray<FPlayerReservation> USikSubsystem::GetSlotReservationMembers() const
+{
+	TArray<FPlayerReservation> Members;
+	
+	FPlayerReservation& Leader = Members.AddDefaulted_GetRef();
+	Leader.UniqueId = FUniqueNetIdRepl(GetLocalUserId());
+	
+	const FNamedOnlineSession* PartySession = IsPartyLeader() ? SessionInterface->GetNamedSession(NAME_PartySession) : nullptr;
+	if (!PartySession)
+	{
+		return Members;
+	}
+	
+	for (const FUniqueNetIdRef& PartyMember : PartySession->RegisteredPlayers)
+	{
+		const FUniqueNetIdRepl MemberId(PartyMember);
+		if (MemberId != Leader.UniqueId)
+		{
+			Members.AddDefaulted_GetRef().UniqueId = MemberId;
+		}
+	}
+	
+	return Members;
+}
+
+void USikSubsystem::UpdateSlotReservationHost()
+{
+	UWorld* World = GetWorld();
+	const FNamedOnlineSession* Session = SessionInterface.IsValid() ? SessionInterface->GetNamedSession(NAME_GameSession) : nullptr;
+	const bool bHostingLobby = bUseSlotReservations && World && Session && Session->bHosting && 
+		(World->GetNetMode() == NM_ListenServer || World->GetNetMode() == NM_DedicatedServer) && 
+		Cast<ASikLobbyGameMode>(World->GetAuthGameMode());
+	
+	/** Once the match is on, joiners in progress go straight to the backend */
+	if (!bHostingLobby)
+	{
+		StopSlotReservationHost();
+		AdvertiseSlotReservationPort(0);
+		return;
+	}
+	
+	if (SlotReservationListener.IsValid() && SlotReservationListener->GetWorld() == World)
+	{
+		return;
+	}
+	
+	StopSlotReservationHost();
+	
+	/** Host of a listen server holds a slot of its own without reserving it */
+	int32 MaxPlayers = 0;
+	GetMaxPlayers(MaxPlayers);
+	const int32 NumSlots = MaxPlayers - (World->GetNetMode() == NM_ListenServer ? 1 : 0);
+	if (NumSlots <= 0)
+	{
+		return;
+	}
+	
+	AOnlineBeaconHost* Listener = World->SpawnActor<AOnlineBeaconHost>(AOnlineBeaconHost::StaticClass());
+	APartyBeaconHost* ReservationHost = World->SpawnActor<APartyBeaconHost>(APartyBeaconHost::StaticClass());
+	if (!Listener || !ReservationHost || !Listener->InitHost() || !ReservationHost->InitHostBeacon(1, NumSlots, NumSlots, NAME_GameSession))
+	{
+		LOG_ERROR(TEXT("Could not open the reservation beacon, clients join without reserving"));
+		
+		if (ReservationHost)
+		{
+			ReservationHost->Destroy();
+		}
+		if (Listener)
+		{
+			Listener->DestroyBeacon();
+		}
+		AdvertiseSlotReservationPort(0);
+		return;
+	}
+	
+	/** Players already in the lobby hold their slots before the first request is answered */
+	if (const AGameStateBase* GameState = World->GetGameState())
+	{
+		for (const APlayerState* PlayerState : GameState->PlayerArray)
+		{
+			const APlayerController* PlayerController = PlayerState ? PlayerState->GetPlayerController() : nullptr;
+			if (PlayerState && !(PlayerController && PlayerController->IsLocalController()))
+			{
+				ReserveSlotForLobbyPlayer(*ReservationHost, PlayerState->GetUniqueId());
+			}
+		}
+	}
+	
+	Listener->RegisterHost(ReservationHost);
+	Listener->PauseBeaconRequests(false);
+	
+	SlotReservationListener = Listener;
+	SlotReservationHost = ReservationHost;
+	
+	LOG_INFO(TEXT("Reservation beacon open on port %d with %d slot(s)"), Listener->GetListenPort(), NumSlots);
+	
+	AdvertiseSlotReservationPort(Listener->GetListenPort());
+}
+
+void USikSubsystem::ReserveSlotForLobbyPlayer(APartyBeaconHost& InReservationHost, const FUniqueNetIdRepl& InUniqueId)
+{
+	if (!InUniqueId.IsValid() || InReservationHost.PlayerHasReservation(*InUniqueId))
+	{
+		return;
+	}
+	
+	FPartyReservation Reservation;
+	Reservation.PartyLeader = InUniqueId;
+	Reservation.PartyMembers.AddDefaulted_GetRef().UniqueId = InUniqueId;
+	
+	if (const EPartyReservationResult::Type Result = InReservationHost.AddPartyReservation(Reservation); 
+		Result != EPartyReservationResult::ReservationAccepted)
+	{
+		LOG_WARNING(TEXT("Could not reserve a slot for %s, who joined without one : %s"), *InUniqueId.ToString(), 
+			EPartyReservationResult::ToString(Result));
+	}
+}
+
+void USikSubsystem::StopSlotReservationHost()
+{
+	if (AOnlineBeaconHost* Listener = SlotReservationListener.Get())
+	{
+		if (APartyBeaconHost* ReservationHost = SlotReservationHost.Get())
+		{
+			Listener->UnregisterHost(ReservationHost->GetBeaconType());
+			ReservationHost->Destroy();
+		}
+		Listener->DestroyBeacon();
+	}
+	
+	SlotReservationListener.Reset();
+	SlotReservationHost.Reset();
+}
+
+void USikSubsystem::AdvertiseSlotReservationPort(const int32 InPort)
+{
+	const FNamedOnlineSession* Session = SessionInterface.IsValid() ? SessionInterface->GetNamedSession(NAME_GameSession) : nullptr;
+	if (!Session || !Session->bHosting)
+	{
+		return;
+	}
+	
+	int32 AdvertisedPort = 0;
+	Session->SessionSettings.Get(SETTING_BEACONPORT, AdvertisedPort);
+	if (AdvertisedPort == InPort)
+	{
+		return;
+	}
+	
+	FOnlineSessionSettings UpdatedSessionSettings = Session->SessionSettings;
+	if (InPort > 0)
+	{
+		UpdatedSessionSettings.Set(SETTING_BEACONPORT, InPort, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	}
+	else
+	{
+		UpdatedSessionSettings.Remove(SETTING_BEACONPORT);
+	}
+	SessionInterface->UpdateSession(NAME_GameSession, UpdatedSessionSettings, true);
+}
+
+#pragma endregion Slot Reservations
+
+#pragma region Session Operation Queue
+
+void USikSubsystem::EnqueueSessionOperation(FSikQueuedSessionOperation&& InOperation)
+{
+	const ESikSessionOperation Operation = InOperation.Operation;
+	const FName SessionName = InOperation.SessionName;
+	
+	switch (Operation)
+	{
+	case ESikSessionOperation::Create:
+	case ESikSessionOperation::Join:
+		/** Latest host or join intent on the same session wins, the ones still waiting are merged into it */
+		for (int32 Index = SessionOperationQueue.Num() - 1; Index >= 0; --Index)
+		{
+			const FSikQueuedSessionOperation& QueuedOperation = SessionOperationQueue[Index];
+			if ((QueuedOperation.Operation != ESikSessionOperation::Create && QueuedOperation.Operation != ESikSessionOperation::Join) ||
+				QueuedOperation.SessionName != SessionName)
+			{
+				continue;
+			}
+			
+			FSikQueuedSessionOperation DroppedOperation = QueuedOperation;
+			SessionOperationQueue.RemoveAt(Index);
+			
+			/** Tasks awaiting a merged request await the one it was merged into */
+			if (DroppedOperation.Operation == Operation)
+			{
+				InOperation.Tasks.Append(MoveTemp(DroppedOperation.Tasks));
+				DroppedOperation.Tasks.Reset();
+			}
+			
+			ReportSessionOperation(DroppedOperation, DroppedOperation.Operation == Operation ? 
+				ESikSessionOperationResult::Coalesced : ESikSessionOperationResult::Cancelled);
+			
+			/** The player picked another session while the reconnect was waiting to join the lost one */
+			if (DroppedOperation.bReconnect && IsReconnecting())
+			{
+				FinishReconnect(false, false);
+			}
+		}
+		break;
+		
+	case ESikSessionOperation::Destroy:
+	case ESikSessionOperation::Start:
+		if (FSikQueuedSessionOperation* QueuedOperation = FindSessionOperation(Operation, SessionName))
+		{
+			QueuedOperation->Tasks.Append(MoveTemp(InOperation.Tasks));
+			InOperation.Tasks.Reset();
+			
+			ReportSessionOperation(InOperation, ESikSessionOperationResult::Coalesced);
+			return;
+		}
+		break;
+		
+	default:
+		return;
+	}
+	
+	/** Backend runs one search at a time and the list is stale once the player leaves the menu, drop searches for the join */
+	if (Operation == ESikSessionOperation::Join && SessionName == NAME_GameSession)
+	{
+		StopSessionBrowserPolling();
+		ResetPendingSessionSearch();
+		
+		if (bFindSessionsInProgress)
+		{
+			CancelFindSessions();
+		}
+	}
+	
+	LOG_INFO(TEXT("Queued %s on %s, %d operation(s) waiting"), *UEnum::GetValueAsString(Operation), *SessionName.ToString(), 
+		SessionOperationQueue.Num());
+	
+	SessionOperationQueue.Add(MoveTemp(InOperation));
+	ProcessNextSessionOperation();
+}
+
+void USikSubsystem::ProcessNextSessionOperation()
+{
+	if (ActiveSessionOperation.Operation != ESikSessionOperation::None || SessionOperationQueue.IsEmpty())
+	{
+		return;
+	}
+	
+	ActiveSessionOperation = SessionOperationQueue[0];
+	SessionOperationQueue.RemoveAt(0);
+	
+	const FName SessionName = ActiveSessionOperation.SessionName;
+	
+	LOG_INFO(TEXT("Running %s on %s"), *UEnum::GetValueAsString(ActiveSessionOperation.Operation), *SessionName.ToString());
+	
+	/** Creating or joining needs the session name free, the session in the way is destroyed first, other sessions are left alone */
+	if ((ActiveSessionOperation.Operation == ESikSessionOperation::Create || ActiveSessionOperation.Operation == ESikSessionOperation::Join) &&
+		!ActiveSessionOperation.bDestroyedExistingSession && SessionInterface.IsValid() && SessionInterface->GetNamedSession(SessionName))
+	{
+		LOG_WARNING(TEXT("%s already exists, destroying it first"), *SessionName.ToString());
+		
+		ActiveSessionOperation.bDestroyedExistingSession = true;
+		SessionOperationQueue.Insert(MoveTemp(ActiveSessionOperation), 0);
+		
+		ActiveSessionOperation = FSikQueuedSessionOperation();
+		ActiveSessionOperation.Operation = ESikSessionOperation::Destroy;
+		ActiveSessionOperation.SessionName = SessionName;
+	}
+	
+	INC_DWORD_STAT(STAT_SikSessionOperationsStarted);
+	SessionMetrics.BeginSpan(GetSessionOperationSpan(ActiveSessionOperation.Operation));
+	FlightRecorder.Record(ESikFlightEventType::Issued, GetSessionOperationSubject(ActiveSessionOperation.Operation));
+	
+	switch (ActiveSessionOperation.Operation)
+	{
+	case ESikSessionOperation::Create:
+		ExecuteCreateSession(ActiveSessionOperation.CreateSettings);
+		break;
+	case ESikSessionOperation::Join:
+		ExecuteJoinSession(ActiveSessionOperation.SessionToJoin);
+		break;
+	case ESikSessionOperation::Destroy:
+		ExecuteDestroySession();
+		break;
+	case ESikSessionOperation::Start:
+		ExecuteStartSession();
+		break;
+	default:
+		ActiveSessionOperation = FSikQueuedSessionOperation();
+		break;
+	}
+}
+
+void USikSubsystem::FinishSessionOperation(ESikSessionOperationResult InResult)
+{
+	if (ActiveSessionOperation.Operation == ESikSessionOperation::None)
+	{
+		return;
+	}
+	
+	const FSikQueuedSessionOperation FinishedOperation = MoveTemp(ActiveSessionOperation);
+	ActiveSessionOperation = FSikQueuedSessionOperation();
+	
+	SessionMetrics.EndSpan(GetSessionOperationSpan(FinishedOperation.Operation), InResult == ESikSessionOperationResult::Succeeded);
+	FlightRecorder.Record(ESikFlightEventType::Finished, GetSessionOperationSubject(FinishedOperation.Operation), static_cast<uint8>(InResult));
+	if (InResult == ESikSessionOperationResult::Failed || InResult == ESikSessionOperationResult::TimedOut)
+	{
+		INC_DWORD_STAT(STAT_SikSessionOperationsFailed);
+	}
+	
+	ReportSessionOperation(FinishedOperation, InResult);
+	
+	/** The create or join the destroy was making room for cannot run while the session is still in the way */
+	if (FinishedOperation.Operation == ESikSessionOperation::Destroy && InResult != ESikSessionOperationResult::Succeeded &&
+		!SessionOperationQueue.IsEmpty() && SessionOperationQueue[0].bDestroyedExistingSession && 
+		SessionOperationQueue[0].SessionName == FinishedOperation.SessionName)
+	{
+		const FSikQueuedSessionOperation DependentOperation = SessionOperationQueue[0];
+		SessionOperationQueue.RemoveAt(0);
+		
+		LOG_WARNING(TEXT("%s on %s dropped, the existing session could not be destroyed"), 
+			*UEnum::GetValueAsString(DependentOperation.Operation), *DependentOperation.SessionName.ToString());
+		
+		INC_DWORD_STAT(STAT_SikSessionOperationsFailed);
+		BroadcastSessionOperationFailure(DependentOperation);
+		ReportSessionOperation(DependentOperation, ESikSessionOperationResult::Failed);
+	}
+	
+	ProcessNextSessionOperation();
+}
+
+void USikSubsystem::ReportSessionOperation(const FSikQueuedSessionOperation& InOperation, ESikSessionOperationResult InResult)
+{
+	LOG_INFO(TEXT("%s on %s : %s"), *UEnum::GetValueAsString(InOperation.Operation), *InOperation.SessionName.ToString(), 
+		*UEnum::GetValueAsString(InResult));
+	
+	if (InOperation.SessionName == NAME_GameSession)
+	{
+		MultiplayerSessionsOnSessionOperationComplete.Broadcast(InOperation.Operation, InResult);
+	}
+	
+	MultiplayerSessionsOnNamedSessionOperationComplete.Broadcast(InOperation.SessionName, InOperation.Operation, InResult);
+	
+	FSikSessionTaskResult TaskResult;
+	TaskResult.Result = InResult;
+	TaskResult.JoinResult = InOperation.JoinResult;
+	for (const TSharedRef<FSikSessionTask>& Task : InOperation.Tasks)
+	{
+		Task->Complete(TaskResult);
+	}
+}
+
+void USikSubsystem::CancelSessionOperations()
+{
+	TArray<FSikQueuedSessionOperation> CancelledOperations = MoveTemp(SessionOperationQueue);
+	SessionOperationQueue.Reset();
+	
+	for (const FSikQueuedSessionOperation& CancelledOperation : CancelledOperations)
+	{
+		ReportSessionOperation(CancelledOperation, ESikSessionOperationResult::Cancelled);
+	}
+}
+
+FSikQueuedSessionOperation* USikSubsystem::FindSessionOperation(ESikSessionOperation InOperation, FName InSessionName)
+{
+	if (ActiveSessionOperation.Operation == InOperation && ActiveSessionOperation.SessionName == InSessionName)
+	{
+		return &ActiveSessionOperation;
+	}
+	
+	return SessionOperationQueue.FindByPredicate([InOperation, InSessionName](const FSikQueuedSessionOperation& QueuedOperation)
+	{
+		return QueuedOperation.Operation == InOperation && QueuedOperation.SessionName == InSessionName;
+	});
+}
+
+bool USikSubsystem::IsSessionOperationQueued(ESikSessionOperation InOperation, FName InSessionName) const
+{
+	if (ActiveSessionOperation.Operation == InOperation && ActiveSessionOperation.SessionName == InSessionName)
+	{
+		return true;
+	}
+	
+	return SessionOperationQueue.ContainsByPredicate([InOperation, InSessionName](const FSikQueuedSessionOperation& QueuedOperation)
+	{
+		return QueuedOperation.Operation == InOperation && QueuedOperation.SessionName == InSessionName;
+	});
+}
+
+#pragma endregion Session Operation Queue
+
+#pragma region Session Operations On Completion Delegates Callbacks
+	
+void USikSubsystem::OnCreateSessionCompleteCallback(FName SessionName, bool bWasSuccessful)
+{
+	LOG_INFO(TEXT("Created session : %s"), bWasSuccessful ? TEXT("success") : TEXT("failed"));
+	
+	FlightRecorder.Record(ESikFlightEventType::Callback, ESikFlightSubject::CreateSession, bWasSuccessful);
+
+	/** Only the running create is finished, a create of another session must not complete the operation at the head */
+	if (ActiveSessionOperation.Operation != ESikSessionOperation::Create || ActiveSessionOperation.SessionName != SessionName)
+	{
+		LOG_WARNING(TEXT("Create of %s was not issued by the queue, ignoring it"), *SessionName.ToString());
+		return;
+	}
+
+	if (SessionInterface)
+	{
+		SessionInterface->ClearOnCreateSessionCompleteDelegate_Handle(CreateSessionCompleteDelegateHandle); 
+	}
+
+	/** Party has no code to advertise and no map to travel to */
+	if (SessionName == NAME_GameSession)
+	{
+		if (bWasSuccessful)
+		{
+			AdvertiseSessionCode(SessionName);
+			
+			/** A dedicated server creates from the lobby, a listen host opens its beacon once it has travelled there */
+			UpdateSlotReservationHost();
+		}
+		else
+		{
+			ReleasePreloadedMaps();
+			LatencyEchoServer.Reset();
+		}
+	}
+
+	if (IsGameSessionOperation())
+	{
+		MultiplayerSessionsOnCreateSessionComplete.Broadcast(bWasSuccessful);
+	}
+	FinishSessionOperation(bWasSuccessful ? ESikSessionOperationResult::Succeeded : ESikSessionOperationResult::Failed);
+}
+
+void USikSubsystem::OnFindSessionsCompleteCallback(bool bWasSuccessful)
+{
+	/** 
+	 * The backend completes the search it was given, the pass we issued is still running if its search is in progress
+	 * That completion belongs to a cancelled or expired pass and must not advance the current chain
+	 */
+	if (!bFindSessionsInProgress || (LastCreatedSessionSearch.IsValid() && LastCreatedSessionSearch->SearchState == EOnlineAsyncTaskState::InProgress))
+	{
+		LOG_WARNING(TEXT("Completion of a stale search pass, ignoring it"));
+		return;
+	}
+	
+	CompleteSessionSearchPass(bWasSuccessful);
+}
+
+void USikSubsystem::CompleteSessionSearchPass(bool bWasSuccessful)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SikFindSessionsComplete);
+	
+	LOG_INFO(TEXT("Found sessions : %s"), bWasSuccessful ? TEXT("success") : TEXT("failed"));
+	
+	if (SessionInterface)
+	{
+		SessionInterface->ClearOnFindSessionsCompleteDelegate_Handle(FindSessionsCompleteDelegateHandle);
+	}
+	
+	/** Results of each pass wait for the remaining ones, the merged list is broadcast once, successful if any pass was */
+	bSessionSearchPassSucceeded |= bWasSuccessful;
+	if (LastCreatedSessionSearch.IsValid())
+	{
+		MarkDedicatedSearchResults(*LastCreatedSessionSearch);
+		SessionSearchPassResults.Append(MoveTemp(LastCreatedSessionSearch->SearchResults));
+		LastCreatedSessionSearch->SearchResults.Reset();
+	}
+	
+	if (SessionInterface && StartSessionSearchPass())
+	{
+		return;
+	}
+	
+	if (LastCreatedSessionSearch.IsValid())
+	{
+		LastCreatedSessionSearch->SearchResults = MoveTemp(SessionSearchPassResults);
+	}
+	SessionSearchPassResults.Reset();
+	bWasSuccessful = bSessionSearchPassSucceeded;
+
+	ClearSessionSearchBudgetTimer();
+	bFindSessionsInProgress = false;
+	SessionMetrics.EndSpan(SIK_SPAN_FINDSESSIONS, bWasSuccessful);
+	FlightRecorder.Record(ESikFlightEventType::Callback, ESikFlightSubject::FindSessions, bWasSuccessful, 
+		LastCreatedSessionSearch.IsValid() ? LastCreatedSessionSearch->SearchResults.Num() : 0);
+	const FSikSessionQuery CompletedQuery = InFlightSessionSearchQuery;
+	const uint32 CompletedSearchId = InFlightSessionSearchId;
+
+	FSikSessionSearchSnapshotPtr SearchSnapshot;
+	if (!LastCreatedSessionSearch.IsValid())
+	{
+		LOG_ERROR(TEXT("LastCreatedSessionSearch is Invalid"));
+		MultiplayerSessionsOnFindSessionsComplete.Broadcast(MakeShared<FSikSessionSearchSnapshot>(), bWasSuccessful);
+	}
+	else
+	{
+		/** Backends are free to ignore MaxSearchResults, never retain or broadcast more than was asked for */
+		TArray<FOnlineSessionSearchResult>& SearchResults = LastCreatedSessionSearch->SearchResults;
+		if (const int32 ResultLimit = FMath::Max(1, LastCreatedSessionSearch->MaxSearchResults); SearchResults.Num() > ResultLimit)
+		{
+			LOG_WARNING(TEXT("Backend returned %d sessions, keeping the first %d"), SearchResults.Num(), ResultLimit);
+			SearchResults.SetNum(ResultLimit);
+		}
+		
+		/** Moved out of the search, listeners and widgets share the snapshot from here on */
+		const FSikSessionSearchSnapshotRef NewSnapshot = MakeSessionSearchSnapshot(MoveTemp(SearchResults));
+		SearchSnapshot = NewSnapshot;
+		
+		if (bWasSuccessful)
+		{
+			CachedSessionSearch = NewSnapshot;
+			CachedSessionSearchQuery = InFlightSessionSearchQuery;
+			CachedSessionSearchTime = FPlatformTime::Seconds();
+			
+			ProbeSessionLatencies(NewSnapshot->GetResults());
+		}
+		
+		SET_DWORD_STAT(STAT_SikSessionSearchResults, NewSnapshot->GetResults().Num());
+		
+		if (NewSnapshot->GetResults().IsEmpty())
+		{
+			LOG_WARNING(TEXT("Search result is empty no session found"));
+		}
+
+		MultiplayerSessionsOnFindSessionsComplete.Broadcast(NewSnapshot, bWasSuccessful);
+	}
+	
+	CompleteAwaitedSessionSearches(CompletedSearchId, 
+		SearchSnapshot.IsValid() ? SearchSnapshot.ToSharedRef() : MakeShared<const FSikSessionSearchSnapshot>(), 
+		bWasSuccessful ? ESikSessionOperationResult::Succeeded : ESikSessionOperationResult::Failed);
+	
+	ScheduleNextSessionBrowserPoll(CompletedQuery, bWasSuccessful, SearchSnapshot.IsValid() ? &SearchSnapshot->GetResults() : nullptr);
+	
+	/** Code lookup waited for this search, it gets the freshly cached results before issuing its own query */
+	if (bSessionKeyLookupPending)
+	{
+		bSessionKeyLookupPending = false;
+		FindSessionBySessionKey(SessionCodeToFind);
+		return;
 	}
+	
+	RunPendingSessionSearch();
 }
 
-void USikSubsystem::StartSession()
+void USikSubsystem::OnFindSessionByCodeCompleteCallback(bool bWasSuccessful)
 {
-	LOG_INFO(TEXT("USikSubsystem::StartSession Called"));
-
-	if (!SessionInterface.IsValid())
-	{
-		LOG_ERROR(TEXT("StartSession SessionInterface is INVALID"));
-		MultiplayerSessionsOnStartSessionComplete.Broadcast(false);
-		return;
-	}
+	LOG_INFO(TEXT("Session code lookup : %s"), bWasSuccessful ? TEXT("success") : TEXT("failed"));
 	
-	if (!IsSessionInState(EOnlineSessionState::Pending))
+	if (SessionInterface)
 	{
-		LOG_ERROR(TEXT("StartSession called but session is NOT in Pending state"));
-		MultiplayerSessionsOnStartSessionComplete.Broadcast(false);
-		return;
+		SessionInterface->ClearOnFindSessionsCompleteDelegate_Handle(FindSessionByCodeCompleteDelegateHandle);
 	}
 
-	StartSessionCompleteDelegateHandle = SessionInterface->AddOnStartSessionCompleteDelegate_Handle(StartSessionCompleteDelegate);
-
-	if (!SessionInterface->StartSession(NAME_GameSession))
+	/** Backend already filtered on the key, compare again in case it ignored the query term */
+	if (bWasSuccessful && LastSessionCodeSearch.IsValid())
 	{
-		LOG_ERROR(TEXT("Call to session interface start session function failed"));
-
-		SessionInterface->ClearOnStartSessionCompleteDelegate_Handle(StartSessionCompleteDelegateHandle);
-		MultiplayerSessionsOnStartSessionComplete.Broadcast(false);
+		MarkDedicatedSearchResults(*LastSessionCodeSearch);
+		
+		for (const FOnlineSessionSearchResult& SearchResult : LastSessionCodeSearch->SearchResults)
+		{
+			FString ResultSessionCode;
+			if (SearchResult.Session.SessionSettings.Get(SETTING_SESSIONKEY, ResultSessionCode) && ResultSessionCode == SessionCodeToFind)
+			{
+				LOG_INFO(TEXT("Found session with code %s"), *SessionCodeToFind);
+				
+				bFindSessionByCodeInProgress = false;
+				SessionCodeSearchPasses.Reset();
+				
+				FOnlineSessionSearchResult FoundResult = SearchResult;
+				ApplyCachedLatency(FoundResult);
+				CompleteFindSessionByCode(FoundResult, true);
+				return;
+			}
+		}
 	}
-}
-
-#pragma endregion Session Operations
-
-#pragma region Session Operations On Completion Delegates Callbacks
 	
-void USikSubsystem::OnCreateSessionCompleteCallback(FName SessionName, bool bWasSuccessful)
-{
-	LOG_INFO(TEXT("Created session : %s"), bWasSuccessful ? TEXT("success") : TEXT("failed"));
-
-	if (SessionInterface)
+	/** A failed pass does not rule out the next one, the session may be a game server instead of a lobby */
+	if (SessionInterface && StartSessionCodeSearchPass())
 	{
-		SessionInterface->ClearOnCreateSessionCompleteDelegate_Handle(CreateSessionCompleteDelegateHandle); 
+		return;
 	}
-
-	MultiplayerSessionsOnCreateSessionComplete.Broadcast(bWasSuccessful);	
+	
+	bFindSessionByCodeInProgress = false;
+	
+	LOG_WARNING(TEXT("No session found with code %s"), *SessionCodeToFind);
+	CompleteFindSessionByCode(FOnlineSessionSearchResult(), false);
 }
 
-void USikSubsystem::OnFindSessionsCompleteCallback(bool bWasSuccessful)
+void USikSubsystem::OnFindSessionByIdCompleteCallback(int32 LocalUserNum, bool bWasSuccessful, 
+	const FOnlineSessionSearchResult& SearchResult, const uint32 InLookupId)
 {
-	LOG_INFO(TEXT("Found sessions : %s"), bWasSuccessful ? TEXT("success") : TEXT("failed"));
-
-	bFindSessionsInProgress = false;
+	LOG_INFO(TEXT("Session id lookup : %s"), bWasSuccessful ? TEXT("success") : TEXT("failed"));
 	
-	if (SessionInterface)
-	{
-		SessionInterface->ClearOnFindSessionsCompleteDelegate_Handle(FindSessionsCompleteDelegateHandle);
-	}
-
-	if (!LastCreatedSessionSearch.IsValid())
+	FlightRecorder.Record(ESikFlightEventType::Callback, ESikFlightSubject::FindSessionById, bWasSuccessful);
+	
+	if (!bFindSessionByCodeInProgress || InLookupId != ActiveSessionCodeLookup.LookupId)
 	{
-		LOG_ERROR(TEXT("LastCreatedSessionSearch is Invalid"));
-		MultiplayerSessionsOnFindSessionsComplete.Broadcast(TArray<FOnlineSessionSearchResult>(), bWasSuccessful);
+		LOG_WARNING(TEXT("Session id lookup was cancelled, ignoring result"));
 		return;
 	}
-		
-	if (LastCreatedSessionSearch->SearchResults.IsEmpty())
+	
+	if (!bWasSuccessful || !SearchResult.IsValid())
 	{
-		LOG_WARNING(TEXT("Search result is empty no session found"));
-		MultiplayerSessionsOnFindSessionsComplete.Broadcast(TArray<FOnlineSessionSearchResult>(), bWasSuccessful);
+		FindSessionBySessionKey(SessionCodeToFind);
 		return;
 	}
-
-	MultiplayerSessionsOnFindSessionsComplete.Broadcast(LastCreatedSessionSearch->SearchResults, bWasSuccessful);
+	
+	bFindSessionByCodeInProgress = false;
+	
+	FOnlineSessionSearchResult FoundResult = SearchResult;
+	ApplyCachedLatency(FoundResult);
+	CompleteFindSessionByCode(FoundResult, true);
 }
 
 void USikSubsystem::OnJoinSessionCompleteCallback(FName SessionName, EOnJoinSessionCompleteResult::Type Result)
@@ -334,56 +4236,150 @@ void USikSubsystem::OnJoinSessionCompleteCallback(FName SessionName, EOnJoinSess
 		break;
 	}
 	
-	if (Result != EOnJoinSessionCompleteResult::Success)
+	FlightRecorder.Record(ESikFlightEventType::Callback, ESikFlightSubject::JoinSession, static_cast<uint8>(Result));
+	
+	/** Only the running join is finished, a join of another session must not complete the operation at the head */
+	if (ActiveSessionOperation.Operation != ESikSessionOperation::Join || ActiveSessionOperation.SessionName != SessionName)
+	{
+		LOG_WARNING(TEXT("Join of %s was not issued by the queue, ignoring it"), *SessionName.ToString());
+		return;
+	}
+	
+	if (SessionInterface)
+	{
+		SessionInterface->ClearOnJoinSessionCompleteDelegate_Handle(JoinSessionCompleteDelegateHandle);
+	}
+	
+	/** Cleanup runs ahead of anything already queued so the next create or join finds the session name free */
+	if (Result != EOnJoinSessionCompleteResult::Success && SessionInterface && SessionInterface->GetNamedSession(SessionName))
 	{
 		LOG_WARNING(TEXT("Join failed, forcing local session cleanup"));
 
-		if (SessionInterface && SessionInterface->GetNamedSession(NAME_GameSession))
-		{
-			SessionInterface->DestroySession(NAME_GameSession);
-		}
+		FSikQueuedSessionOperation CleanupOperation;
+		CleanupOperation.Operation = ESikSessionOperation::Destroy;
+		CleanupOperation.SessionName = SessionName;
+		SessionOperationQueue.Insert(MoveTemp(CleanupOperation), 0);
+	}
+
+	const bool bIsGameSession = SessionName == NAME_GameSession;
+	const bool bFollowParty = ActiveSessionOperation.bFollowParty;
+	const bool bReconnectJoin = ActiveSessionOperation.bReconnect;
+	
+	if (Result == EOnJoinSessionCompleteResult::Success && bIsGameSession)
+	{
+		LastJoinedSession = ActiveSessionOperation.SessionToJoin;
+		LastJoinedConnectString.Reset();
+		GetResolvedConnectString(LastJoinedConnectString);
+	}
 
+	if (IsGameSessionOperation())
+	{
 		MultiplayerSessionsOnJoinSessionsComplete.Broadcast(Result);
+	}
+	ActiveSessionOperation.JoinResult = Result;
+	FinishSessionOperation(Result == EOnJoinSessionCompleteResult::Success ? 
+		ESikSessionOperationResult::Succeeded : ESikSessionOperationResult::Failed);
+	
+	if (Result != EOnJoinSessionCompleteResult::Success)
+	{
+		if (bIsGameSession)
+		{
+			ReleasePreloadedMaps();
+		}
+		DumpFlightRecorderOnFailure(FString::Printf(TEXT("Join%s"), LexToString(Result)));
+		
+		if (bReconnectJoin && bReconnectAttemptInFlight)
+		{
+			bReconnectAttemptInFlight = false;
+			ScheduleReconnectAttempt();
+		}
 		return;
 	}
 	
-	if (SessionInterface)
+	/** The reconnect ends once the session's map has loaded, or moves on to its next attempt if the travel cannot start */
+	if (bReconnectJoin)
 	{
-		SessionInterface->ClearOnJoinSessionCompleteDelegate_Handle(JoinSessionCompleteDelegateHandle);
+		if (!TravelToJoinedSession() && bReconnectAttemptInFlight)
+		{
+			bReconnectAttemptInFlight = false;
+			ScheduleReconnectAttempt();
+		}
+		return;
+	}
+	
+	/** The UI did not ask for this join, travelling to the leader's game is up to the subsystem */
+	if (bFollowParty)
+	{
+		LOG_INFO(TEXT("Following the party to its game session"));
+		TravelToJoinedSession();
 	}
-
-	MultiplayerSessionsOnJoinSessionsComplete.Broadcast(Result);
 }
 
 void USikSubsystem::OnDestroySessionCompleteCallback(FName SessionName, bool bWasSuccessful)
 {
 	LOG_INFO(TEXT("Destroy session : %s"), bWasSuccessful ? TEXT("success") : TEXT("failed"));
+	
+	FlightRecorder.Record(ESikFlightEventType::Callback, ESikFlightSubject::DestroySession, bWasSuccessful);
+
+	/** Only the running destroy is finished, a destroy of another session must not complete the operation at the head */
+	if (ActiveSessionOperation.Operation != ESikSessionOperation::Destroy || ActiveSessionOperation.SessionName != SessionName)
+	{
+		LOG_WARNING(TEXT("Destroy of %s was not issued by the queue, ignoring it"), *SessionName.ToString());
+		return;
+	}
 
 	if (SessionInterface.IsValid())
 	{
 		SessionInterface->ClearOnDestroySessionCompleteDelegate_Handle(DestroySessionCompleteDelegateHandle);
 	}
 
-	if (bWasSuccessful && bCreateSessionOnDestroy)
+	/** 
+	 * Torn down before the queue moves on, FinishSessionOperation may run the create waiting behind this destroy,
+	 * which starts its own echo server and reservation host and would lose them to a teardown after it
+	 */
+	if (SessionName == NAME_GameSession)
+	{
+		StopSlotReservationHost();
+		LatencyEchoServer.Reset();
+		
+		/** Members stop following a game session the leader has left */
+		if (IsPartyLeader())
+		{
+			PublishPartyGameSession();
+		}
+	}
+
+	if (IsGameSessionOperation())
 	{
-		bCreateSessionOnDestroy = false;
-		CreateSession(SessionSettingsForTheSessionToCreateAfterDestruction);
+		MultiplayerSessionsOnDestroySessionComplete.Broadcast(bWasSuccessful);
 	}
-	
-	MultiplayerSessionsOnDestroySessionComplete.Broadcast(bWasSuccessful);
+	FinishSessionOperation(bWasSuccessful ? ESikSessionOperationResult::Succeeded : ESikSessionOperationResult::Failed);
 }
 
 void USikSubsystem::OnStartSessionCompleteCallback(FName SessionName, bool bWasSuccessful)
 {
 	LOG_INFO(TEXT("Start session : %s | Success: %s"),
 		*SessionName.ToString(), bWasSuccessful ? TEXT("true") : TEXT("false"));
+	
+	FlightRecorder.Record(ESikFlightEventType::Callback, ESikFlightSubject::StartSession, bWasSuccessful);
+
+	/** Only the running start is finished, a start of another session must not complete the operation at the head */
+	if (ActiveSessionOperation.Operation != ESikSessionOperation::Start || ActiveSessionOperation.SessionName != SessionName)
+	{
+		LOG_WARNING(TEXT("Start of %s was not issued by the queue, ignoring it"), *SessionName.ToString());
+		return;
+	}
 
 	if (SessionInterface.IsValid())
 	{
 		SessionInterface->ClearOnStartSessionCompleteDelegate_Handle(StartSessionCompleteDelegateHandle);
 	}
 
-	MultiplayerSessionsOnStartSessionComplete.Broadcast(bWasSuccessful);
+	if (IsGameSessionOperation())
+	{
+		MultiplayerSessionsOnStartSessionComplete.Broadcast(bWasSuccessful);
+	}
+	FinishSessionOperation(bWasSuccessful ? ESikSessionOperationResult::Succeeded : ESikSessionOperationResult::Failed);
 }
 
 #pragma endregion Session Operations On Completion Delegates Callbacks
@@ -395,53 +4391,259 @@ void USikSubsystem::HandleNetworkFailure(UWorld* World, UNetDriver* NetDriver, E
 {
 	LOG_INFO(TEXT("Called"));
 	
-	HandleAppExit();
+	FlightRecorder.Record(ESikFlightEventType::NetworkFailure, ESikFlightSubject::None, static_cast<uint8>(FailureType));
+	DumpFlightRecorderOnFailure(FString("NetworkFailure"));
+	
+	if (TryStartReconnect(World, FailureType))
+	{
+		return;
+	}
+	
+	HandleAppExit(false);
 }
 
-void USikSubsystem::HandleAppExit()
+void USikSubsystem::HandleAppExit(const bool bLeaveParty)
 {	
 	LOG_INFO(TEXT("Called"));
 
-	if (SessionInterface.IsValid() && SessionInterface->GetNamedSession(NAME_GameSession))
+	/** Before the queue is cancelled, the quick match would otherwise move on to its next candidate */
+	CancelQuickMatch();
+	CancelMatchmaking();
+	
+	bSessionKeyLookupPending = false;
+	ActiveSessionCodeLookup = FSikSessionCodeLookup();
+	QueuedSessionCodeLookups.Reset();
+	
+	if (const UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(ReconnectTimerHandle);
+	}
+	ReconnectAttempt = 0;
+	bReconnectAttemptInFlight = false;
+	bDisconnectDeferred = false;
+	ClearReconnectTarget();
+	
+	StopSessionBrowserPolling();
+	
+	ReleasePreloadedMaps();
+	
+	CancelSessionOperations();
+	
+	/** The destroy below must not wait for the running call, abandoned like a timed out one, a running destroy is kept */
+	if (ActiveSessionOperation.Operation != ESikSessionOperation::None &&
+		(ActiveSessionOperation.Operation != ESikSessionOperation::Destroy || ActiveSessionOperation.SessionName != NAME_GameSession))
+	{
+		AbandonActiveSessionOperation(ESikSessionOperationResult::Cancelled);
+	}
+	StopSlotReservationHost();
+	
+	QueuedLatencyProbes.Reset();
+	QueuedLatencyProbesHead = 0;
+	QueuedLatencyProbeHosts.Reset();
+	InFlightLatencyProbes.Reset();
+	if (LatencyProbe.IsValid())
+	{
+		LatencyProbe->CancelAll();
+	}
+	
+	/** Whatever was in flight is not going to complete, counted as failed so aborted flows show up in the numbers */
+	SessionMetrics.FailOpenSpans();
+
+	if (SessionInterface.IsValid() && SessionInterface->GetNamedSession(NAME_GameSession) && 
+		!IsSessionOperationQueued(ESikSessionOperation::Destroy))
 	{
 		LOG_WARNING(TEXT("Active session detected during shutdown. Destroying..."));
 		DestroySession();
 	}
 	
+	if (bLeaveParty && IsInParty())
+	{
+		LOG_WARNING(TEXT("Active party detected during shutdown. Leaving..."));
+		LeaveParty();
+	}
+	
 	if (bFindSessionsInProgress)
 	{
 		CancelFindSessions();
 	}
+	
+	CancelSessionCodeSearch();
+	
+	bFindSessionByCodeInProgress = false;
+	ResetPendingSessionSearch();
 }
 
-FString USikSubsystem::GenerateSessionUniqueCode()
+FString USikSubsystem::GenerateSessionUniqueCode() const
 {
-	LOG_INFO(TEXT("Called"));
+	const FString Code = SupportsSessionLookupById() ? FSikSessionCode::GenerateRandomCode() : FSikSessionCode::GenerateShortCode();
+
+	LOG_INFO(TEXT("%s"), *Code);
 	
-	const FGuid NewGuid = FGuid::NewGuid();
-	const uint64 Part1 = (static_cast<uint64>(NewGuid.A) << 32) | static_cast<uint64>(NewGuid.B);
-	const uint64 Part2 = (static_cast<uint64>(NewGuid.C) << 32) | static_cast<uint64>(NewGuid.D);
-	uint64 GuidValue = Part1 ^ Part2;
+	return Code;
+}
 
-	const FString AllowedChars = TEXT("BCDFGHJKLMNPQRSTVWXZ");
-	const uint64 Base = AllowedChars.Len();
+FSikSessionSearchSnapshotPtr USikSubsystem::GetCachedSearchResults(const FSikSessionQuery& InQuery) const
+{
+	if (GetCachedSearchResultsAge(InQuery) < 0.0)
+	{
+		return nullptr;
+	}
+	
+	return CachedSessionSearch;
+}
 
-	FString Code;
-	Code.Reserve(SETTING_SESSION_CODELENGTH);
+FSikSessionSearchSnapshotRef USikSubsystem::MakeSessionSearchSnapshot(TArray<FOnlineSessionSearchResult>&& InResults)
+{
+	/** Skips 0 on wrap around, it marks snapshots not coming from any search */
+	SessionSearchGeneration = SessionSearchGeneration == MAX_uint32 ? 1 : SessionSearchGeneration + 1;
+	return MakeShared<FSikSessionSearchSnapshot>(SessionSearchGeneration, MoveTemp(InResults));
+}
 
-	for (int32 i = 0; i < SETTING_SESSION_CODELENGTH; i++)
+double USikSubsystem::GetCachedSearchResultsAge(const FSikSessionQuery& InQuery) const
+{
+	if (!CachedSessionSearch.IsValid() || !(CachedSessionSearchQuery == InQuery))
+	{
+		return -1.0;
+	}
+	
+	/** Search that asked for fewer results is a miss, unless the backend had fewer to give than it asked for */
+	if (!CachedSessionSearchQuery.Covers(InQuery) && CachedSessionSearch->GetResults().Num() >= CachedSessionSearchQuery.MaxSearchResults)
 	{
-		const int32 CharIndex = GuidValue % Base;
-		Code.AppendChar(AllowedChars[CharIndex]);
-		GuidValue /= Base;
+		return -1.0;
 	}
+	
+	return FPlatformTime::Seconds() - CachedSessionSearchTime;
+}
 
-	LOG_INFO(TEXT("%s"), *Code);
+FSikSessionHandle USikSubsystem::FindCachedSessionByCode(const FString& InSessionCode) const
+{
+	if (!CachedSessionSearch.IsValid() || FPlatformTime::Seconds() - CachedSessionSearchTime >= SearchResultsCacheTTL)
+	{
+		return FSikSessionHandle();
+	}
 	
-	return Code;
+	return CachedSessionSearch->FindBySessionKey(InSessionCode);
+}
+
+void USikSubsystem::ScheduleSessionSearchRefresh(const FSikSessionQuery& InQuery, float InDelay)
+{
+	UGameInstance* GameInstance = GetGameInstance();
+	if (!GameInstance)
+	{
+		return;
+	}
+	
+	FTimerManager& TimerManager = GameInstance->GetTimerManager();
+	if (TimerManager.IsTimerActive(SessionSearchRefreshTimerHandle) && ScheduledSessionSearchQuery.Covers(InQuery))
+	{
+		return;
+	}
+	
+	ScheduledSessionSearchQuery = InQuery;
+	TimerManager.SetTimer(SessionSearchRefreshTimerHandle, FTimerDelegate::CreateWeakLambda(this, [this]()
+	{
+		FindSessions(ScheduledSessionSearchQuery);
+	}), FMath::Max(InDelay, KINDA_SMALL_NUMBER), false);
+}
+
+void USikSubsystem::AdvertiseSessionCode(FName SessionName)
+{
+	if (!SessionInterface.IsValid())
+	{
+		LOG_ERROR(TEXT("SessionInterface is INVALID"));
+		return;
+	}
+
+	const FNamedOnlineSession* Session = SessionInterface->GetNamedSession(SessionName);
+	if (!Session || !Session->SessionInfo.IsValid())
+	{
+		LOG_WARNING(TEXT("No session info to derive the session code from"));
+		return;
+	}
+
+	/** The code would only be typed into the session key search, which finds the short one as well */
+	if (!SupportsSessionLookupById())
+	{
+		LOG_INFO(TEXT("Backend has no lookup by id, keeping the short session code"));
+		return;
+	}
+
+	FString SessionCode;
+	if (!FSikSessionCode::EncodeSessionId(Session->SessionInfo->GetSessionId().ToString(), SessionCode))
+	{
+		LOG_INFO(TEXT("Session id cannot be encoded, keeping the random session code"));
+		return;
+	}
+
+	LOG_INFO(TEXT("Advertising session code %s"), *SessionCode);
+
+	FOnlineSessionSettings UpdatedSessionSettings = Session->SessionSettings;
+	UpdatedSessionSettings.Set(SETTING_SESSIONKEY, SessionCode, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	SessionInterface->UpdateSession(SessionName, UpdatedSessionSettings, true);
+}
+
+bool USikSubsystem::SupportsSessionLookupById() const
+{
+	/** LAN session ids are not lobby ids, and OnlineSubsystemSteam stubs FindSessionById out */
+	if (MockSession.IsValid())
+	{
+		return true;
+	}
+	
+	const IOnlineSubsystem* DefaultSubsystem = IOnlineSubsystem::Get();
+	return !bLanMode && DefaultSubsystem && DefaultSubsystem->GetSubsystemName() != STEAM_SUBSYSTEM;
+}
+
+FUniqueNetIdPtr USikSubsystem::GetLocalUserId() const
+{
+	/** LAN on Null has ids of its own, the local player holds the one of the platform */
+	if (bLanMode && LanSubsystemName == NULL_SUBSYSTEM)
+	{
+		const IOnlineSubsystem* NullSubsystem = IOnlineSubsystem::Get(NULL_SUBSYSTEM);
+		const IOnlineIdentityPtr NullIdentity = NullSubsystem ? NullSubsystem->GetIdentityInterface() : nullptr;
+		if (FUniqueNetIdPtr LocalUserId = NullIdentity.IsValid() ? NullIdentity->GetUniquePlayerId(0) : nullptr; LocalUserId.IsValid())
+		{
+			return LocalUserId;
+		}
+	}
+	
+	if (const UWorld* World = GetWorld())
+	{
+		if (const ULocalPlayer* LocalPlayer = World->GetFirstLocalPlayerFromController())
+		{
+			if (FUniqueNetIdPtr LocalUserId = LocalPlayer->GetPreferredUniqueNetId().GetUniqueNetId(); LocalUserId.IsValid())
+			{
+				return LocalUserId;
+			}
+		}
+	}
+	
+	if (MockSession.IsValid())
+	{
+		return MockSession->GetLocalUserId();
+	}
+	
+	LOG_ERROR(TEXT("No local user id, is a local player signed in?"));
+	return nullptr;
+}
+
+bool USikSubsystem::ShouldUseMockBackend() const
+{
+	return bUseMockBackend || FParse::Param(FCommandLine::Get(), TEXT("SikMockBackend"));
+}
+
+bool USikSubsystem::GetResolvedConnectString(FString& OutConnectString, const FName InSessionName) const
+{
+	if (!SessionInterface.IsValid())
+	{
+		LOG_ERROR(TEXT("SessionInterface is INVALID"));
+		return false;
+	}
+	
+	return SessionInterface->GetResolvedConnectString(InSessionName, OutConnectString);
 }
 
-bool USikSubsystem::IsSessionInState(EOnlineSessionState::Type State) const
+bool USikSubsystem::IsSessionInState(EOnlineSessionState::Type State, const FName InSessionName) const
 {
 	if (!SessionInterface.IsValid())
 	{
@@ -449,7 +4651,9 @@ bool USikSubsystem::IsSessionInState(EOnlineSessionState::Type State) const
 		return false;
 	}
 
-	const FNamedOnlineSession* Session = SessionInterface->GetNamedSession(NAME_GameSession);
+	const FNamedOnlineSession* Session = SessionInterface->GetNamedSession(InSessionName);
+	FlightRecorder.RecordSessionState(Session ? static_cast<uint8>(Session->SessionState) : FSikFlightRecorder::NoSessionState);
+	
 	if (!Session)
 	{
 		LOG_WARNING(TEXT("No active session found"));
@@ -463,7 +4667,7 @@ bool USikSubsystem::IsSessionInState(EOnlineSessionState::Type State) const
 	
 #pragma region Getter
 	
-bool USikSubsystem::GetMaxPlayers(int32& OutMaxPlayers) const
+bool USikSubsystem::GetMaxPlayers(int32& OutMaxPlayers, const FName InSessionName) const
 {
 	OutMaxPlayers = 0;
 
@@ -473,7 +4677,7 @@ bool USikSubsystem::GetMaxPlayers(int32& OutMaxPlayers) const
 		return false;
 	}
 
-	const FNamedOnlineSession* Session = SessionInterface->GetNamedSession(NAME_GameSession);
+	const FNamedOnlineSession* Session = SessionInterface->GetNamedSession(InSessionName);
 	if (!Session)
 	{
 		LOG_WARNING(TEXT("No active session found"));
@@ -487,7 +4691,7 @@ bool USikSubsystem::GetMaxPlayers(int32& OutMaxPlayers) const
 	return true;
 }
 
-bool USikSubsystem::GetSessionSetting(const FName InSettingName, FString& OutSessionSetting) const
+bool USikSubsystem::GetSessionSetting(const FName InSettingName, FString& OutSessionSetting, const FName InSessionName) const
 {
 	OutSessionSetting.Reset();
 
@@ -497,7 +4701,7 @@ bool USikSubsystem::GetSessionSetting(const FName InSettingName, FString& OutSes
 		return false;
 	}
 
-	const FNamedOnlineSession* Session = SessionInterface->GetNamedSession(NAME_GameSession);
+	const FNamedOnlineSession* Session = SessionInterface->GetNamedSession(InSessionName);
 	if (!Session)
 	{
 		LOG_WARNING(TEXT("No active session found"));
@@ -515,4 +4719,50 @@ bool USikSubsystem::GetSessionSetting(const FName InSettingName, FString& OutSes
 	return true;
 }
 
+bool USikSubsystem::GetSessionSchemaSettings(FSikPackedSessionSettings& OutSettings, const FName InSessionName) const
+{
+	OutSettings = FSikPackedSessionSettings();
+
+	if (!SessionInterface.IsValid())
+	{
+		LOG_ERROR(TEXT("SessionInterface is INVALID"));
+		return false;
+	}
+
+	const FNamedOnlineSession* Session = SessionInterface->GetNamedSession(InSessionName);
+	if (!Session)
+	{
+		LOG_WARNING(TEXT("No active session found"));
+		return false;
+	}
+
+	int32 PackedSettings = 0;
+	if (!Session->SessionSettings.Get(SETTING_SESSIONSCHEMA, PackedSettings) || 
+		!FSikPackedSessionSettings::Unpack(PackedSettings, OutSettings))
+	{
+		LOG_WARNING(TEXT("Failed to read the packed settings of the session"));
+		return false;
+	}
+
+	return true;
+}
+
+FSikMatchmakerSettings USikSubsystem::GetMatchmakerSettings() const
+{
+	FSikMatchmakerSettings Settings;
+	Settings.BatchInterval = MatchmakerBatchInterval;
+	Settings.SkillWindow = MatchmakerSkillWindow;
+	Settings.SkillWindowGrowth = MatchmakerSkillWindowGrowth;
+	Settings.MaxSkillWindow = MatchmakerMaxSkillWindow;
+	Settings.TicketTimeout = MatchmakerTicketTimeout;
+	Settings.HostReportTimeout = MatchmakerHostReportTimeout;
+	return Settings;
+}
+
+int32 USikSubsystem::GetMatchmakerPort() const
+{
+	FString Port;
+	return MatchmakerAddress.Split(TEXT(":"), nullptr, &Port, ESearchCase::IgnoreCase, ESearchDir::FromEnd) ? FCString::Atoi(*Port) : 0;
+}
+
 #pragma endregion Getter
@@ -0,0 +1,272 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikFlightRecorder.h"
+
+#include "Async/Async.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Interfaces/OnlineSessionInterface.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Subsystem/SikSubsystem.h"
+#include "System/SikLogger.h"
+
+namespace SikFlightRecorder
+{
+	/** "SIKF" */
+	constexpr uint32 Magic = 0x464B4953;
+	constexpr uint32 Version = 1;
+
+	/** Events kept until SetCapacity is called */
+	constexpr int32 DefaultCapacity = 4096;
+
+	const TCHAR* LexToString(ESikFlightEventType InType)
+	{
+		switch (InType)
+		{
+		case ESikFlightEventType::Issued: return TEXT("Issued");
+		case ESikFlightEventType::Callback: return TEXT("Callback");
+		case ESikFlightEventType::Finished: return TEXT("Finished");
+		case ESikFlightEventType::SessionState: return TEXT("SessionState");
+		case ESikFlightEventType::TravelStarted: return TEXT("TravelStarted");
+		case ESikFlightEventType::TravelFinished: return TEXT("TravelFinished");
+		case ESikFlightEventType::TravelFailed: return TEXT("TravelFailed");
+		case ESikFlightEventType::NetworkFailure: return TEXT("NetworkFailure");
+		case ESikFlightEventType::Dumped: return TEXT("Dumped");
+		default: return TEXT("Unknown");
+		}
+	}
+
+	const TCHAR* LexToString(ESikFlightSubject InSubject)
+	{
+		switch (InSubject)
+		{
+		case ESikFlightSubject::None: return TEXT("");
+		case ESikFlightSubject::CreateSession: return TEXT("CreateSession");
+		case ESikFlightSubject::FindSessions: return TEXT("FindSessions");
+		case ESikFlightSubject::CancelFindSessions: return TEXT("CancelFindSessions");
+		case ESikFlightSubject::FindSessionByCode: return TEXT("FindSessionByCode");
+		case ESikFlightSubject::FindSessionById: return TEXT("FindSessionById");
+		case ESikFlightSubject::FindSessionBySessionKey: return TEXT("FindSessionBySessionKey");
+		case ESikFlightSubject::JoinSession: return TEXT("JoinSession");
+		case ESikFlightSubject::DestroySession: return TEXT("DestroySession");
+		case ESikFlightSubject::StartSession: return TEXT("StartSession");
+		case ESikFlightSubject::ServerTravel: return TEXT("ServerTravel");
+		case ESikFlightSubject::ClientTravel: return TEXT("ClientTravel");
+		case ESikFlightSubject::Reconnect: return TEXT("Reconnect");
+		case ESikFlightSubject::QuickMatch: return TEXT("QuickMatch");
+		case ESikFlightSubject::Matchmaking: return TEXT("Matchmaking");
+		case ESikFlightSubject::SlotReservation: return TEXT("SlotReservation");
+		default: return TEXT("Unknown");
+		}
+	}
+
+	/** @returns the Code and Value of the event in words */
+	FString DescribeDetail(const FSikFlightEvent& InEvent)
+	{
+		FString Detail;
+		
+		switch (InEvent.Type)
+		{
+		case ESikFlightEventType::Callback:
+			if (InEvent.Subject == ESikFlightSubject::JoinSession)
+			{
+				Detail = ::LexToString(static_cast<EOnJoinSessionCompleteResult::Type>(InEvent.Code));
+			}
+			else if (InEvent.Subject == ESikFlightSubject::Matchmaking)
+			{
+				Detail = InEvent.Code == static_cast<uint8>(ESikMatchmakingTicketState::Host) ? TEXT("Host") : TEXT("Join");
+			}
+			else
+			{
+				Detail = InEvent.Code ? TEXT("Succeeded") : TEXT("Failed");
+			}
+			break;
+		case ESikFlightEventType::Finished:
+			Detail = InEvent.Subject == ESikFlightSubject::QuickMatch || InEvent.Subject == ESikFlightSubject::Matchmaking ? 
+				UEnum::GetValueAsString(static_cast<ESikMatchResult>(InEvent.Code)) : 
+				UEnum::GetValueAsString(static_cast<ESikSessionOperationResult>(InEvent.Code));
+			break;
+		case ESikFlightEventType::SessionState:
+			Detail = InEvent.Code == FSikFlightRecorder::NoSessionState ? 
+				FString(TEXT("NoSession")) : FString(EOnlineSessionState::ToString(static_cast<EOnlineSessionState::Type>(InEvent.Code)));
+			break;
+		case ESikFlightEventType::TravelFailed:
+			Detail = ETravelFailure::ToString(static_cast<ETravelFailure::Type>(InEvent.Code));
+			break;
+		case ESikFlightEventType::NetworkFailure:
+			Detail = ENetworkFailure::ToString(static_cast<ENetworkFailure::Type>(InEvent.Code));
+			break;
+		default:
+			break;
+		}
+		
+		if (InEvent.Value != 0)
+		{
+			Detail += FString::Printf(TEXT(" (%d)"), InEvent.Value);
+		}
+		
+		return Detail;
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FSikFlightEvent& Event)
+{
+	Ar << Event.Cycles;
+	Ar << reinterpret_cast<uint8&>(Event.Type);
+	Ar << reinterpret_cast<uint8&>(Event.Subject);
+	Ar << Event.Code;
+	Ar << Event.Value;
+	
+	return Ar;
+}
+
+FSikFlightRecorder::FSikFlightRecorder()
+{
+	SetCapacity(SikFlightRecorder::DefaultCapacity);
+}
+
+void FSikFlightRecorder::SetCapacity(int32 InCapacity)
+{
+	Events.Reset();
+	Events.SetNumZeroed(FMath::Max(16, InCapacity));
+	NextEvent = 0;
+	NumRecorded = 0;
+}
+
+FString FSikFlightRecorder::Dump(const FString& InReason)
+{
+	TArray<uint8> Data;
+	Serialize(InReason, Data);
+	
+	Record(ESikFlightEventType::Dumped, ESikFlightSubject::None);
+	
+	const FString FilePath = GetDumpDirectory() / FString::Printf(TEXT("SikFlight-%s-%s.sikfr"), 
+		*FPaths::MakeValidFileName(InReason), *FDateTime::Now().ToString());
+	
+	/** Writing to disk is left to the thread pool, only the copy above runs on the game thread */
+	Async(EAsyncExecution::ThreadPool, [Data = MoveTemp(Data), FilePath]()
+	{
+		if (!FFileHelper::SaveArrayToFile(Data, *FilePath))
+		{
+			LOG_ERROR(TEXT("Failed to write flight recorder dump %s"), *FilePath);
+		}
+	});
+	
+	LOG_WARNING(TEXT("Flight recorder dumped to %s"), *FilePath);
+	
+	return FilePath;
+}
+
+void FSikFlightRecorder::Serialize(const FString& InReason, TArray<uint8>& OutData) const
+{
+	const bool bWrapped = NumRecorded > static_cast<uint64>(Events.Num());
+	int32 NumEvents = bWrapped ? Events.Num() : NextEvent;
+	const int32 FirstEvent = bWrapped ? NextEvent : 0;
+	
+	uint32 Magic = SikFlightRecorder::Magic;
+	uint32 Version = SikFlightRecorder::Version;
+	FString Reason = InReason;
+	double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+	uint64 DumpCycles = FPlatformTime::Cycles64();
+	int64 DumpUtcTicks = FDateTime::UtcNow().GetTicks();
+	
+	OutData.Reset();
+	FMemoryWriter Writer(OutData);
+	Writer << Magic << Version << Reason << SecondsPerCycle << DumpCycles << DumpUtcTicks << NumEvents;
+	
+	for (int32 Index = 0; Index < NumEvents; ++Index)
+	{
+		FSikFlightEvent Event = Events[(FirstEvent + Index) % Events.Num()];
+		Writer << Event;
+	}
+}
+
+bool FSikFlightRecorder::Decode(const TArray<uint8>& InData, TArray<FString>& OutTimeline)
+{
+	FMemoryReader Reader(InData);
+	
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	Reader << Magic << Version;
+	
+	if (Reader.IsError() || Magic != SikFlightRecorder::Magic || Version != SikFlightRecorder::Version)
+	{
+		return false;
+	}
+	
+	FString Reason;
+	double SecondsPerCycle = 0.0;
+	uint64 DumpCycles = 0;
+	int64 DumpUtcTicks = 0;
+	int32 NumEvents = 0;
+	Reader << Reason << SecondsPerCycle << DumpCycles << DumpUtcTicks << NumEvents;
+	
+	if (Reader.IsError() || NumEvents < 0)
+	{
+		return false;
+	}
+	
+	const FDateTime DumpTime(DumpUtcTicks);
+	OutTimeline.Add(FString::Printf(TEXT("Flight recorder dump '%s' taken %s UTC, %d events"), 
+		*Reason, *DumpTime.ToString(TEXT("%Y-%m-%d %H:%M:%S.%s")), NumEvents));
+	
+	uint64 FirstCycles = 0;
+	uint64 PreviousCycles = 0;
+	
+	for (int32 Index = 0; Index < NumEvents; ++Index)
+	{
+		FSikFlightEvent Event;
+		Reader << Event;
+		
+		if (Reader.IsError())
+		{
+			OutTimeline.Add(TEXT("Dump is truncated"));
+			return false;
+		}
+		
+		if (Index == 0)
+		{
+			FirstCycles = PreviousCycles = Event.Cycles;
+		}
+		
+		/** Events are placed on the wall clock through the cycle counter and wall time sampled together at the dump */
+		const double SecondsBeforeDump = static_cast<double>(DumpCycles - Event.Cycles) * SecondsPerCycle;
+		const FDateTime EventTime = DumpTime - FTimespan::FromSeconds(SecondsBeforeDump);
+		
+		OutTimeline.Add(FString::Printf(TEXT("%s  %10.3f ms  %+9.3f ms  %-14s %-24s %s"), 
+			*EventTime.ToString(TEXT("%H:%M:%S.%s")),
+			static_cast<double>(Event.Cycles - FirstCycles) * SecondsPerCycle * 1000.0,
+			static_cast<double>(Event.Cycles - PreviousCycles) * SecondsPerCycle * 1000.0,
+			SikFlightRecorder::LexToString(Event.Type), SikFlightRecorder::LexToString(Event.Subject), 
+			*SikFlightRecorder::DescribeDetail(Event)));
+		
+		PreviousCycles = Event.Cycles;
+	}
+	
+	return true;
+}
+
+FString FSikFlightRecorder::GetDumpDirectory()
+{
+	return FPaths::ProjectSavedDir() / TEXT("FlightRecorder");
+}
+
+static FAutoConsoleCommandWithWorldAndArgs SikFlightRecorderDumpCommand(
+	TEXT("Sik.FlightRecorder.Dump"),
+	TEXT("Writes the session flight recorder to Saved/FlightRecorder. Usage: Sik.FlightRecorder.Dump [Reason]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		USikSubsystem* SikSubsystem = World && World->GetGameInstance() ? World->GetGameInstance()->GetSubsystem<USikSubsystem>() : nullptr;
+		if (!SikSubsystem)
+		{
+			LOG_ERROR(TEXT("Sik.FlightRecorder.Dump needs a world with a game instance"));
+			return;
+		}
+		
+		SikSubsystem->DumpFlightRecorder(Args.Num() > 0 ? Args[0] : FString("Requested"));
+	}));
@@ -0,0 +1,63 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikFlightRecorderCommandlet.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "System/SikFlightRecorder.h"
+#include "System/SikLogger.h"
+
+USikFlightRecorderCommandlet::USikFlightRecorderCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 USikFlightRecorderCommandlet::Main(const FString& Params)
+{
+	FString FilePath;
+	if (!FParse::Value(*Params, TEXT("File="), FilePath))
+	{
+		TArray<FString> DumpFiles;
+		IFileManager::Get().FindFiles(DumpFiles, *(FSikFlightRecorder::GetDumpDirectory() / TEXT("*.sikfr")), true, false);
+		
+		FDateTime NewestTime = FDateTime::MinValue();
+		for (const FString& DumpFile : DumpFiles)
+		{
+			const FString DumpPath = FSikFlightRecorder::GetDumpDirectory() / DumpFile;
+			if (const FDateTime DumpTime = IFileManager::Get().GetTimeStamp(*DumpPath); DumpTime > NewestTime)
+			{
+				NewestTime = DumpTime;
+				FilePath = DumpPath;
+			}
+		}
+	}
+	
+	TArray<uint8> Data;
+	if (FilePath.IsEmpty() || !FFileHelper::LoadFileToArray(Data, *FilePath))
+	{
+		LOG_ERROR(TEXT("No flight recorder dump to decode, pass -File=<dump> or dump one with Sik.FlightRecorder.Dump"));
+		return 1;
+	}
+	
+	TArray<FString> Timeline;
+	const bool bDecoded = FSikFlightRecorder::Decode(Data, Timeline);
+	if (!bDecoded)
+	{
+		LOG_ERROR(TEXT("%s is not a flight recorder dump or was written by another version"), *FilePath);
+	}
+	
+	/** Printed as Display so the timeline reaches the console without -stdout */
+	UE_LOG(SteamIntegrationKitLog, Display, TEXT("%s"), *FilePath);
+	for (const FString& Line : Timeline)
+	{
+		UE_LOG(SteamIntegrationKitLog, Display, TEXT("%s"), *Line);
+	}
+	
+	SikLog::Flush();
+	
+	return bDecoded ? 0 : 1;
+}
@@ -0,0 +1,396 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikLatencyProbe.h"
+
+#include "Common/UdpSocketBuilder.h"
+#include "Common/UdpSocketReceiver.h"
+#include "IPAddress.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "System/SikLogger.h"
+
+#if WITH_SIK_STEAMWORKS
+THIRD_PARTY_INCLUDES_START
+#include "steam/steam_api.h"
+THIRD_PARTY_INCLUDES_END
+#endif
+
+namespace SikLatencyProbe
+{
+	/** Marks the datagrams as ours, anything else reaching the socket is ignored */
+	constexpr uint32 PacketMagic = 0x53494B50;
+
+	/** Magic followed by the sequence number */
+	constexpr int32 PacketSize = 8;
+
+	/** Largest datagram read at once, bigger ones are not ours */
+	constexpr int32 MaxPacketSize = 64;
+
+	/** Echoes an address gets per second, a client sends one probe per host and search */
+	constexpr int32 MaxRepliesPerSecond = 8;
+
+	/** Addresses tracked at once, further senders are dropped until a window expires */
+	constexpr int32 MaxTrackedSenders = 1024;
+
+	/** Echoes waiting for the game thread, more than the probes USikSubsystem keeps in flight */
+	constexpr uint32 MaxReceivedEchoes = 256;
+
+	/** Milliseconds the receiver thread waits on the socket before checking whether it is stopping */
+	constexpr int32 ReceiverWaitMs = 100;
+
+	/** @returns the ping the backend reported for the host, else the one estimated from its ping location, negative if neither is known */
+	int32 GetReportedPing(const FSikLatencyProbeRequest& InRequest)
+	{
+		if (InRequest.ReportedPingInMs >= 0 && InRequest.ReportedPingInMs < MAX_QUERY_PING)
+		{
+			return InRequest.ReportedPingInMs;
+		}
+		
+		return InRequest.PingLocation.IsEmpty() ? -1 : FSikSteamPingLocation::EstimatePingInMs(InRequest.PingLocation);
+	}
+
+	void DestroySocket(FSocket*& Socket)
+	{
+		if (!Socket)
+		{
+			return;
+		}
+
+		Socket->Close();
+		if (ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM))
+		{
+			SocketSubsystem->DestroySocket(Socket);
+		}
+		Socket = nullptr;
+	}
+}
+
+#pragma region Steam Ping Location
+
+void FSikSteamPingLocation::InitRelayNetworkAccess()
+{
+#if WITH_SIK_STEAMWORKS
+	/** Null until SteamAPI_Init ran, which the Steam online subsystem does on startup */
+	if (ISteamNetworkingUtils* NetworkingUtils = SteamNetworkingUtils())
+	{
+		NetworkingUtils->InitRelayNetworkAccess();
+	}
+#endif
+}
+
+FString FSikSteamPingLocation::GetLocalPingLocation()
+{
+#if WITH_SIK_STEAMWORKS
+	ISteamNetworkingUtils* NetworkingUtils = SteamNetworkingUtils();
+	SteamNetworkPingLocation_t PingLocation;
+	if (!NetworkingUtils || NetworkingUtils->GetLocalPingLocation(PingLocation) < 0.f)
+	{
+		return FString();
+	}
+	
+	ANSICHAR PingLocationString[k_cchMaxSteamNetworkingPingLocationString];
+	NetworkingUtils->ConvertPingLocationToString(PingLocation, PingLocationString, UE_ARRAY_COUNT(PingLocationString));
+	return FString(ANSI_TO_TCHAR(PingLocationString));
+#else
+	return FString();
+#endif
+}
+
+int32 FSikSteamPingLocation::EstimatePingInMs(const FString& InPingLocation)
+{
+#if WITH_SIK_STEAMWORKS
+	ISteamNetworkingUtils* NetworkingUtils = SteamNetworkingUtils();
+	SteamNetworkPingLocation_t PingLocation;
+	if (!NetworkingUtils || !NetworkingUtils->ParsePingLocationString(TCHAR_TO_ANSI(*InPingLocation), PingLocation))
+	{
+		return -1;
+	}
+	
+	return NetworkingUtils->EstimatePingTimeFromLocalHost(PingLocation);
+#else
+	return -1;
+#endif
+}
+
+#pragma endregion Steam Ping Location
+
+#pragma region Backend Probe
+
+void FSikBackendLatencyProbe::Probe(const FSikLatencyProbeRequest& InRequest, FSikOnLatencyProbeComplete OnComplete)
+{
+	OnComplete.ExecuteIfBound(SikLatencyProbe::GetReportedPing(InRequest));
+}
+
+#pragma endregion Backend Probe
+
+#pragma region UDP Echo Probe
+
+FSikUdpEchoLatencyProbe::FSikUdpEchoLatencyProbe(float InTimeoutSeconds)
+	: ReceivedEchoes(SikLatencyProbe::MaxReceivedEchoes)
+	, TimeoutSeconds(InTimeoutSeconds)
+{
+	Socket = FUdpSocketBuilder(TEXT("SikLatencyProbe")).AsNonBlocking().AsReusable().Build();
+	if (!Socket)
+	{
+		LOG_ERROR(TEXT("Failed to create the UDP latency probe socket, hosts get the ping reported by the backend"));
+		return;
+	}
+
+	Receiver = MakeUnique<FUdpSocketReceiver>(Socket, FTimespan::FromMilliseconds(SikLatencyProbe::ReceiverWaitMs),
+		TEXT("SikLatencyProbeReceiver"));
+	Receiver->OnDataReceived().BindRaw(this, &FSikUdpEchoLatencyProbe::OnEchoReceived);
+	Receiver->Start();
+}
+
+FSikUdpEchoLatencyProbe::~FSikUdpEchoLatencyProbe()
+{
+	CancelAll();
+
+	/** Joins the receiver thread, it must not touch the socket or the queue once they are gone */
+	if (Receiver.IsValid())
+	{
+		Receiver->Stop();
+		Receiver.Reset();
+	}
+
+	SikLatencyProbe::DestroySocket(Socket);
+}
+
+void FSikUdpEchoLatencyProbe::Probe(const FSikLatencyProbeRequest& InRequest, FSikOnLatencyProbeComplete OnComplete)
+{
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	const TSharedPtr<FInternetAddr> HostAddress = SocketSubsystem && !InRequest.HostAddress.IsEmpty() ? 
+		SocketSubsystem->GetAddressFromString(InRequest.HostAddress) : nullptr;
+	if (!Socket || !HostAddress.IsValid() || !HostAddress->IsValid())
+	{
+		OnComplete.ExecuteIfBound(SikLatencyProbe::GetReportedPing(InRequest));
+		return;
+	}
+
+	const uint32 Sequence = NextSequence++;
+
+	uint8 Packet[SikLatencyProbe::PacketSize];
+	FMemory::Memcpy(Packet, &SikLatencyProbe::PacketMagic, sizeof(uint32));
+	FMemory::Memcpy(Packet + sizeof(uint32), &Sequence, sizeof(uint32));
+
+	const double SentTime = FPlatformTime::Seconds();
+
+	int32 BytesSent = 0;
+	if (!Socket->SendTo(Packet, SikLatencyProbe::PacketSize, BytesSent, *HostAddress) || BytesSent != SikLatencyProbe::PacketSize)
+	{
+		LOG_WARNING(TEXT("Failed to send latency probe to %s for %s"), *InRequest.HostAddress, *InRequest.HostKey);
+		OnComplete.ExecuteIfBound(-1);
+		return;
+	}
+
+	FInFlightProbe& InFlightProbe = InFlightProbes.Add(Sequence);
+	InFlightProbe.SentTime = SentTime;
+	InFlightProbe.OnComplete = MoveTemp(OnComplete);
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSikUdpEchoLatencyProbe::Tick));
+	}
+}
+
+void FSikUdpEchoLatencyProbe::CancelAll()
+{
+	InFlightProbes.Reset();
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+bool FSikUdpEchoLatencyProbe::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	/** Completions are collected first, they may start new probes and change InFlightProbes */
+	TArray<TPair<FSikOnLatencyProbeComplete, int32>> Completions;
+
+	/** Timed by the receiver thread on arrival, how late this tick runs does not add to the round trip */
+	FReceivedEcho Echo;
+	while (ReceivedEchoes.Pop(Echo))
+	{
+		FInFlightProbe InFlightProbe;
+		if (InFlightProbes.RemoveAndCopyValue(Echo.Sequence, InFlightProbe))
+		{
+			Completions.Emplace(MoveTemp(InFlightProbe.OnComplete), FMath::RoundToInt32((Echo.ReceivedTime - InFlightProbe.SentTime) * 1000.0));
+		}
+	}
+
+	for (auto It = InFlightProbes.CreateIterator(); It; ++It)
+	{
+		if (Now - It->Value.SentTime >= TimeoutSeconds)
+		{
+			Completions.Emplace(MoveTemp(It->Value.OnComplete), -1);
+			It.RemoveCurrent();
+		}
+	}
+
+	const bool bKeepTicking = !InFlightProbes.IsEmpty();
+	if (!bKeepTicking)
+	{
+		TickerHandle.Reset();
+	}
+
+	for (TPair<FSikOnLatencyProbeComplete, int32>& Completion : Completions)
+	{
+		Completion.Key.ExecuteIfBound(Completion.Value);
+	}
+
+	/** A completion may have queued a probe and registered a new ticker, this one is removed by returning false */
+	return bKeepTicking;
+}
+
+void FSikUdpEchoLatencyProbe::OnEchoReceived(const FArrayReaderPtr& InData, const FIPv4Endpoint& InSender)
+{
+	const double ReceivedTime = FPlatformTime::Seconds();
+
+	if (!InData.IsValid() || InData->Num() != SikLatencyProbe::PacketSize)
+	{
+		return;
+	}
+
+	uint32 Magic = 0;
+	FMemory::Memcpy(&Magic, InData->GetData(), sizeof(uint32));
+	if (Magic != SikLatencyProbe::PacketMagic)
+	{
+		return;
+	}
+
+	FReceivedEcho ReceivedEcho;
+	FMemory::Memcpy(&ReceivedEcho.Sequence, InData->GetData() + sizeof(uint32), sizeof(uint32));
+	ReceivedEcho.ReceivedTime = ReceivedTime;
+
+	/** A full queue drops the echo, its probe times out like one whose echo was lost */
+	ReceivedEchoes.Push(MoveTemp(ReceivedEcho));
+}
+
+#pragma endregion UDP Echo Probe
+
+#pragma region UDP Echo Server
+
+FSikUdpEchoServer::~FSikUdpEchoServer()
+{
+	Stop();
+}
+
+bool FSikUdpEchoServer::Start(int32 InPort)
+{
+	Stop();
+
+	Socket = FUdpSocketBuilder(TEXT("SikUdpEchoServer")).AsNonBlocking().AsReusable()
+		.BoundToAddress(FIPv4Address::Any).BoundToPort(InPort).Build();
+	if (!Socket)
+	{
+		LOG_ERROR(TEXT("Failed to bind the UDP echo server to port %d"), InPort);
+		return false;
+	}
+
+	LOG_INFO(TEXT("UDP echo server listening on port %d"), InPort);
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSikUdpEchoServer::Tick));
+	return true;
+}
+
+void FSikUdpEchoServer::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	SikLatencyProbe::DestroySocket(Socket);
+	SenderWindows.Reset();
+}
+
+bool FSikUdpEchoServer::Tick(float DeltaTime)
+{
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (!Socket || !SocketSubsystem)
+	{
+		return true;
+	}
+
+	const TSharedRef<FInternetAddr> Sender = SocketSubsystem->CreateInternetAddr();
+	const double Now = FPlatformTime::Seconds();
+
+	uint8 Buffer[SikLatencyProbe::MaxPacketSize];
+	uint32 PendingDataSize = 0;
+	while (Socket->HasPendingData(PendingDataSize))
+	{
+		int32 BytesRead = 0;
+		if (!Socket->RecvFrom(Buffer, SikLatencyProbe::MaxPacketSize, BytesRead, *Sender))
+		{
+			break;
+		}
+
+		/** Only probes are echoed, the reply is never bigger than what was sent */
+		if (BytesRead != SikLatencyProbe::PacketSize)
+		{
+			continue;
+		}
+
+		uint32 Magic = 0;
+		FMemory::Memcpy(&Magic, Buffer, sizeof(uint32));
+		if (Magic != SikLatencyProbe::PacketMagic || !ConsumeReplyBudget(*Sender, Now))
+		{
+			continue;
+		}
+
+		int32 BytesSent = 0;
+		Socket->SendTo(Buffer, BytesRead, BytesSent, *Sender);
+	}
+
+	return true;
+}
+
+bool FSikUdpEchoServer::ConsumeReplyBudget(const FInternetAddr& InSender, const double InNow)
+{
+	const FString SenderKey = InSender.ToString(false);
+
+	FSenderWindow* Window = SenderWindows.Find(SenderKey);
+	if (!Window)
+	{
+		/** Spoofed sources must not grow the map without bound, expired windows make room first */
+		if (SenderWindows.Num() >= SikLatencyProbe::MaxTrackedSenders)
+		{
+			for (auto It = SenderWindows.CreateIterator(); It; ++It)
+			{
+				if (InNow - It->Value.StartTime >= 1.0)
+				{
+					It.RemoveCurrent();
+				}
+			}
+
+			if (SenderWindows.Num() >= SikLatencyProbe::MaxTrackedSenders)
+			{
+				return false;
+			}
+		}
+
+		Window = &SenderWindows.Add(SenderKey);
+		Window->StartTime = InNow;
+	}
+
+	if (InNow - Window->StartTime >= 1.0)
+	{
+		Window->StartTime = InNow;
+		Window->Replies = 0;
+	}
+
+	if (Window->Replies >= SikLatencyProbe::MaxRepliesPerSecond)
+	{
+		return false;
+	}
+
+	++Window->Replies;
+	return true;
+}
+
+#pragma endregion UDP Echo Server
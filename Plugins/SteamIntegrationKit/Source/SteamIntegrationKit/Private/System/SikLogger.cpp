@@ -0,0 +1,335 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikLogger.h"
+
+#include "Engine/Engine.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeLock.h"
+#include "System/SikRingBuffer.h"
+
+DEFINE_LOG_CATEGORY(SteamIntegrationKitLog);
+
+namespace SikLog
+{
+	/** Longest message in characters, longer ones are cut */
+	constexpr int32 MaxMessageLength = 256;
+
+	/** Messages the queue holds, a full queue drops info and warnings until the sink catches up, each slot holds a whole message */
+	constexpr uint32 QueueCapacity = 1024;
+
+	/** Milliseconds the sink sleeps between drains unless woken up by a filling queue */
+	constexpr uint32 DrainIntervalMs = 50;
+
+#if !UE_BUILD_SHIPPING
+	static TAutoConsoleVariable<int32> CVarOnScreenVerbosity(
+		TEXT("Sik.Log.OnScreen"),
+		2,
+		TEXT("Messages printed on screen. 0: none, 1: errors, 2: warnings and errors, 3: everything"));
+
+	static TAutoConsoleVariable<int32> CVarOnScreenPerSecond(
+		TEXT("Sik.Log.OnScreenPerSecond"),
+		4,
+		TEXT("Max number of messages printed on screen per second, the rest only reach the log"));
+#endif
+
+	struct FRecord
+	{
+		ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+
+		/** Points to the __FUNCTION__ literal, never freed */
+		const ANSICHAR* FunctionName = nullptr;
+
+		TCHAR Text[MaxMessageLength];
+	};
+
+#if !UE_BUILD_SHIPPING
+	bool ShouldPrintOnScreen(ELogVerbosity::Type Verbosity);
+	void PrintOnScreen(ELogVerbosity::Type Verbosity, const ANSICHAR* FunctionName, const TCHAR* UserMessage);
+#endif
+
+	/** Fills the record, formatting the message into its buffer, runs while the slot is claimed so it never allocates */
+	void FormatRecord(FRecord& OutRecord, const ELogVerbosity::Type Verbosity, const ANSICHAR* FunctionName, 
+		const TFunctionRef<void(TCHAR*, int32)>& FormatMessage)
+	{
+		OutRecord.Verbosity = Verbosity;
+		OutRecord.FunctionName = FunctionName;
+		FormatMessage(OutRecord.Text, MaxMessageLength);
+		OutRecord.Text[MaxMessageLength - 1] = TEXT('\0');
+	}
+
+	/** Writes the record to the log, on whichever thread drains it */
+	void Write(const FRecord& Record)
+	{
+		switch (Record.Verbosity)
+		{
+			case ELogVerbosity::Error:
+				UE_LOG(SteamIntegrationKitLog, Error, TEXT("[%s] %s"), ANSI_TO_TCHAR(Record.FunctionName), Record.Text);
+				break;
+
+			case ELogVerbosity::Warning:
+				UE_LOG(SteamIntegrationKitLog, Warning, TEXT("[%s] %s"), ANSI_TO_TCHAR(Record.FunctionName), Record.Text);
+				break;
+
+			case ELogVerbosity::Display:
+			case ELogVerbosity::Log:
+			default:
+				UE_LOG(SteamIntegrationKitLog, Log, TEXT("[%s] %s"), ANSI_TO_TCHAR(Record.FunctionName), Record.Text);
+				break;
+		}
+	}
+
+	/**
+	 * Background thread writing the queued messages to the log
+	 * Callers only format their message into a slot of the queue, the prefixing and the output devices run here
+	 ******************************************************************************************/
+	class FSink final : public FRunnable
+	{
+	public:
+		static FSink& Get()
+		{
+			static FSink Sink;
+			return Sink;
+		}
+
+		void Start()
+		{
+			if (Thread || !FPlatformProcess::SupportsMultithreading())
+			{
+				return;
+			}
+
+			/** Kept for the lifetime of the process, callers racing Stop may still trigger it */
+			if (!WakeEvent)
+			{
+				WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+			}
+
+			bStopping = false;
+			Thread = FRunnableThread::Create(this, TEXT("SikLogSink"), 0, TPri_BelowNormal);
+			bRunning = Thread != nullptr;
+		}
+
+		void Stop()
+		{
+			if (!Thread)
+			{
+				return;
+			}
+
+			/** Callers write in place from here on, the ones that still saw the sink running finish their push first */
+			bRunning = false;
+			while (NumProducers.load() > 0)
+			{
+				FPlatformProcess::Yield();
+			}
+
+			bStopping = true;
+			WakeEvent->Trigger();
+
+			Thread->WaitForCompletion();
+			delete Thread;
+			Thread = nullptr;
+
+			Drain();
+		}
+
+		void Enqueue(const ELogVerbosity::Type Verbosity, const ANSICHAR* FunctionName, const TFunctionRef<void(TCHAR*, int32)>& FormatMessage)
+		{
+			/** Counted before bRunning is read, so Stop either waits for this producer or this producer sees the sink stopped */
+			NumProducers.fetch_add(1);
+			ON_SCOPE_EXIT
+			{
+				NumProducers.fetch_sub(1);
+			};
+
+#if !UE_BUILD_SHIPPING
+			/** Printing allocates and goes through the engine, it runs on a copy of the text once the slot is released */
+			const bool bPrintOnScreen = ShouldPrintOnScreen(Verbosity);
+			TCHAR ScreenText[MaxMessageLength];
+#endif
+
+			if (bRunning.load())
+			{
+				const bool bPushed = Queue.PushInPlace([&](FRecord& OutRecord)
+				{
+					FormatRecord(OutRecord, Verbosity, FunctionName, FormatMessage);
+#if !UE_BUILD_SHIPPING
+					if (bPrintOnScreen)
+					{
+						FMemory::Memcpy(ScreenText, OutRecord.Text, sizeof(ScreenText));
+					}
+#endif
+				});
+
+				if (bPushed)
+				{
+					if (Queue.NumApprox() > Queue.GetCapacity() / 2)
+					{
+						WakeEvent->Trigger();
+					}
+
+#if !UE_BUILD_SHIPPING
+					if (bPrintOnScreen)
+					{
+						PrintOnScreen(Verbosity, FunctionName, ScreenText);
+					}
+#endif
+					return;
+				}
+
+				/** Errors are never dropped, they are written in place below and may land ahead of queued messages */
+				if (Verbosity > ELogVerbosity::Error)
+				{
+					NumDropped.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+			}
+
+			FRecord Record;
+			FormatRecord(Record, Verbosity, FunctionName, FormatMessage);
+			Write(Record);
+
+#if !UE_BUILD_SHIPPING
+			if (bPrintOnScreen)
+			{
+				PrintOnScreen(Verbosity, FunctionName, Record.Text);
+			}
+#endif
+		}
+
+		/** Pops and writes every queued message, the lock keeps the queue down to a single consumer */
+		void Drain()
+		{
+			FScopeLock DrainLock(&DrainCriticalSection);
+
+			if (const uint32 Dropped = NumDropped.exchange(0, std::memory_order_relaxed))
+			{
+				UE_LOG(SteamIntegrationKitLog, Warning, TEXT("[SikLog] Dropped %u messages, the queue was full"), Dropped);
+			}
+
+			/** Written straight from the slot, the record is never copied out */
+			while (Queue.PopInPlace(&Write))
+			{
+			}
+		}
+
+		virtual uint32 Run() override
+		{
+			while (!bStopping)
+			{
+				WakeEvent->Wait(DrainIntervalMs);
+				Drain();
+			}
+
+			return 0;
+		}
+
+	private:
+		FSink() : Queue(QueueCapacity) {}
+
+		TSikMpscRingBuffer<FRecord> Queue;
+
+		FRunnableThread* Thread = nullptr;
+		FEvent* WakeEvent = nullptr;
+		FCriticalSection DrainCriticalSection;
+
+		std::atomic<bool> bRunning { false };
+		std::atomic<bool> bStopping { false };
+		std::atomic<uint32> NumDropped { 0 };
+
+		/** Callers between their check of bRunning and the end of their push */
+		std::atomic<int32> NumProducers { 0 };
+	};
+
+#if !UE_BUILD_SHIPPING
+	/** @returns true if messages of the verbosity are printed on screen, only ever from the game thread */
+	bool ShouldPrintOnScreen(const ELogVerbosity::Type Verbosity)
+	{
+		if (!IsInGameThread())
+		{
+			return false;
+		}
+
+		const int32 OnScreenVerbosity = CVarOnScreenVerbosity.GetValueOnGameThread();
+		return (Verbosity <= ELogVerbosity::Error && OnScreenVerbosity >= 1) ||
+			(Verbosity == ELogVerbosity::Warning && OnScreenVerbosity >= 2) || OnScreenVerbosity >= 3;
+	}
+
+	/** Prints the message on screen if the rate allows it, called after the message is queued once ShouldPrintOnScreen agreed */
+	void PrintOnScreen(const ELogVerbosity::Type Verbosity, const ANSICHAR* FunctionName, const TCHAR* UserMessage)
+	{
+		if (!GEngine)
+		{
+			return;
+		}
+
+		static double WindowStartTime = 0.0;
+		static int32 PrintedInWindow = 0;
+		static int32 Suppressed = 0;
+
+		const double Now = FPlatformTime::Seconds();
+		if (Now - WindowStartTime >= 1.0)
+		{
+			WindowStartTime = Now;
+			PrintedInWindow = 0;
+		}
+
+		if (PrintedInWindow >= CVarOnScreenPerSecond.GetValueOnGameThread())
+		{
+			++Suppressed;
+			return;
+		}
+
+		++PrintedInWindow;
+
+		const FColor ScreenColor = Verbosity <= ELogVerbosity::Error ? FColor::Red :
+			Verbosity == ELogVerbosity::Warning ? FColor::Yellow : FColor::Cyan;
+
+		FString ScreenMessage = FString::Printf(TEXT("[%s] %s"), ANSI_TO_TCHAR(FunctionName), UserMessage);
+		if (Suppressed > 0)
+		{
+			ScreenMessage += FString::Printf(TEXT(" (+%d more in the log)"), Suppressed);
+			Suppressed = 0;
+		}
+
+		GEngine->AddOnScreenDebugMessage(INDEX_NONE, 8.f, ScreenColor, ScreenMessage);
+	}
+#endif
+
+	/** Flushes before the crash reporter collects the log */
+	FDelegateHandle SystemErrorHandle;
+
+	void Enqueue(const ELogVerbosity::Type Verbosity, const ANSICHAR* FunctionName, TFunctionRef<void(TCHAR*, int32)> FormatMessage)
+	{
+		FSink::Get().Enqueue(Verbosity, FunctionName, FormatMessage);
+	}
+
+	void Flush()
+	{
+		FSink::Get().Drain();
+	}
+
+	void StartSink()
+	{
+		FSink::Get().Start();
+
+		if (!SystemErrorHandle.IsValid())
+		{
+			SystemErrorHandle = FCoreDelegates::OnHandleSystemError.AddStatic(&SikLog::Flush);
+		}
+	}
+
+	void StopSink()
+	{
+		FCoreDelegates::OnHandleSystemError.Remove(SystemErrorHandle);
+		SystemErrorHandle.Reset();
+
+		FSink::Get().Stop();
+	}
+}
@@ -0,0 +1,796 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikMatchmaker.h"
+
+#include "Common/UdpSocketBuilder.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "System/SikLogger.h"
+#include "System/SikSessionMetrics.h"
+
+namespace SikMatchmaker
+{
+	/** Marks the datagrams as ours, anything else reaching the socket is ignored */
+	constexpr uint32 PacketMagic = 0x53494B4D;
+
+	/** Bumped whenever a message layout changes, datagrams of another version are ignored */
+	constexpr uint8 ProtocolVersion = 1;
+
+	/** Largest datagram read at once, bigger ones are not ours */
+	constexpr int32 MaxPacketSize = 512;
+
+	/** Longest region or session code sent, in UTF-8 bytes */
+	constexpr int32 MaxStringLength = 64;
+
+	enum class EMessageType : uint8
+	{
+		Enqueue,
+		Poll,
+		ReportHosted,
+		Cancel,
+		Status
+	};
+
+	void DestroySocket(FSocket*& Socket)
+	{
+		if (!Socket)
+		{
+			return;
+		}
+
+		Socket->Close();
+		if (ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM))
+		{
+			SocketSubsystem->DestroySocket(Socket);
+		}
+		Socket = nullptr;
+	}
+
+	/** Magic, version and message type, @returns false on load if the datagram is not ours */
+	bool SerializeHeader(FArchive& Ar, EMessageType& Type)
+	{
+		uint32 Magic = PacketMagic;
+		uint8 Version = ProtocolVersion;
+		uint8 RawType = static_cast<uint8>(Type);
+		Ar << Magic << Version << RawType;
+
+		Type = static_cast<EMessageType>(RawType);
+		return !Ar.IsError() && Magic == PacketMagic && Version == ProtocolVersion && RawType <= static_cast<uint8>(EMessageType::Status);
+	}
+
+	/** Length prefixed UTF-8, clamped to MaxStringLength */
+	void SerializeString(FArchive& Ar, FString& Value)
+	{
+		if (Ar.IsLoading())
+		{
+			uint8 Length = 0;
+			Ar << Length;
+
+			ANSICHAR Bytes[MaxStringLength];
+			if (Length > MaxStringLength)
+			{
+				Ar.SetError();
+				return;
+			}
+			Ar.Serialize(Bytes, Length);
+
+			Value = Ar.IsError() ? FString() : FString(FUTF8ToTCHAR(Bytes, Length));
+			return;
+		}
+
+		const FTCHARToUTF8 Utf8(*Value);
+		uint8 Length = static_cast<uint8>(FMath::Min(Utf8.Length(), MaxStringLength));
+		Ar << Length;
+		Ar.Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Length);
+	}
+
+	/** Settings travel packed, @returns false on load if packed with another schema version */
+	bool SerializeSettings(FArchive& Ar, FSikPackedSessionSettings& Settings)
+	{
+		int32 Packed = Ar.IsLoading() ? 0 : Settings.Pack();
+		Ar << Packed;
+
+		return !Ar.IsError() && (!Ar.IsLoading() || FSikPackedSessionSettings::Unpack(Packed, Settings));
+	}
+
+	bool SerializeTicket(FArchive& Ar, FSikMatchmakingTicket& Ticket)
+	{
+		Ar << Ticket.TicketId;
+		SerializeString(Ar, Ticket.Region);
+		Ar << Ticket.Skill;
+		return SerializeSettings(Ar, Ticket.Preferences);
+	}
+
+	bool SerializeStatus(FArchive& Ar, FSikMatchmakingStatus& Status)
+	{
+		uint8 State = static_cast<uint8>(Status.State);
+		Ar << Status.TicketId << State;
+		Status.State = static_cast<ESikMatchmakingTicketState>(State);
+
+		Ar << Status.Assignment.MatchId << Status.Assignment.NumPlayers;
+		SerializeString(Ar, Status.Assignment.SessionCode);
+		return SerializeSettings(Ar, Status.Assignment.Settings) && State <= static_cast<uint8>(ESikMatchmakingTicketState::Reported);
+	}
+
+	/** Merges one id of two preferences, 0 accepts every value, @returns false if both are set and differ */
+	bool MergeId(uint8& Merged, uint8 Other)
+	{
+		if (Merged == 0)
+		{
+			Merged = Other;
+			return true;
+		}
+		return Other == 0 || Other == Merged;
+	}
+}
+
+#pragma region Matchmaker
+
+FSikMatchmaker::FSikMatchmaker(const FSikMatchmakerSettings& InSettings)
+	: Settings(InSettings)
+{
+}
+
+FSikMatchmakingStatus FSikMatchmaker::Enqueue(const FSikMatchmakingTicket& InTicket, double InNow)
+{
+	if (!InTicket.TicketId.IsValid())
+	{
+		return FSikMatchmakingStatus();
+	}
+
+	if (FTicketEntry* Entry = Tickets.Find(InTicket.TicketId))
+	{
+		Entry->LastSeenTime = InNow;
+		return MakeStatus(InTicket.TicketId);
+	}
+
+	FTicketEntry& Entry = Tickets.Add(InTicket.TicketId);
+	Entry.Ticket = InTicket;
+	Entry.EnqueueTime = InNow;
+	Entry.LastSeenTime = InNow;
+
+	return MakeStatus(InTicket.TicketId);
+}
+
+FSikMatchmakingStatus FSikMatchmaker::Poll(const FGuid& InTicketId, double InNow)
+{
+	if (FTicketEntry* Entry = Tickets.Find(InTicketId))
+	{
+		Entry->LastSeenTime = InNow;
+	}
+
+	return MakeStatus(InTicketId);
+}
+
+FSikMatchmakingStatus FSikMatchmaker::ReportHosted(const FGuid& InTicketId, const FString& InSessionCode, double InNow)
+{
+	FTicketEntry* Entry = Tickets.Find(InTicketId);
+	if (!Entry || (Entry->State != ESikMatchmakingTicketState::Host && Entry->State != ESikMatchmakingTicketState::Reported))
+	{
+		return MakeStatus(InTicketId);
+	}
+
+	Entry->LastSeenTime = InNow;
+
+	/** Reports are repeated until answered, only the first one hands out the code */
+	FMatch* Match = Matches.Find(Entry->MatchId);
+	if (Match && Entry->State == ESikMatchmakingTicketState::Host)
+	{
+		Entry->State = ESikMatchmakingTicketState::Reported;
+		Match->Assignment.SessionCode = InSessionCode;
+
+		for (const FGuid& MemberTicketId : Match->MemberTicketIds)
+		{
+			FTicketEntry* Member = Tickets.Find(MemberTicketId);
+			if (Member && Member->State == ESikMatchmakingTicketState::Matched)
+			{
+				Member->State = ESikMatchmakingTicketState::Join;
+			}
+		}
+	}
+
+	return MakeStatus(InTicketId);
+}
+
+void FSikMatchmaker::Cancel(const FGuid& InTicketId)
+{
+	FTicketEntry Entry;
+	if (!Tickets.RemoveAndCopyValue(InTicketId, Entry) || !Entry.MatchId.IsValid())
+	{
+		return;
+	}
+
+	/** Without its host the match never gets a session, the others wait for another one */
+	if (Entry.State == ESikMatchmakingTicketState::Host)
+	{
+		DissolveMatch(Entry.MatchId);
+		return;
+	}
+
+	/** Anyone else leaving only leaves a free slot in the session */
+	if (FMatch* Match = Matches.Find(Entry.MatchId))
+	{
+		Match->MemberTicketIds.Remove(InTicketId);
+		if (Match->MemberTicketIds.IsEmpty())
+		{
+			Matches.Remove(Entry.MatchId);
+		}
+	}
+}
+
+void FSikMatchmaker::Tick(double InNow)
+{
+	TArray<FGuid> ExpiredTicketIds;
+	for (const TPair<FGuid, FTicketEntry>& Pair : Tickets)
+	{
+		if (InNow - Pair.Value.LastSeenTime > Settings.TicketTimeout)
+		{
+			ExpiredTicketIds.Add(Pair.Key);
+		}
+	}
+
+	/** A host that never reports is dropped, which puts the others back in the queue */
+	for (const TPair<FGuid, FMatch>& Pair : Matches)
+	{
+		if (Pair.Value.Assignment.SessionCode.IsEmpty() && InNow - Pair.Value.CreatedTime > Settings.HostReportTimeout)
+		{
+			ExpiredTicketIds.AddUnique(Pair.Value.HostTicketId);
+		}
+	}
+
+	for (const FGuid& TicketId : ExpiredTicketIds)
+	{
+		Cancel(TicketId);
+	}
+
+	if (InNow >= NextBatchTime)
+	{
+		NextBatchTime = InNow + Settings.BatchInterval;
+		FormMatches(InNow);
+	}
+}
+
+void FSikMatchmaker::FormMatches(double InNow)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SikFormMatches);
+
+	TMap<FString, TArray<FTicketEntry*>> Buckets;
+	for (TPair<FGuid, FTicketEntry>& Pair : Tickets)
+	{
+		if (Pair.Value.State == ESikMatchmakingTicketState::Waiting)
+		{
+			Buckets.FindOrAdd(Pair.Value.Ticket.Region).Add(&Pair.Value);
+		}
+	}
+
+	for (TPair<FString, TArray<FTicketEntry*>>& Bucket : Buckets)
+	{
+		Bucket.Value.Sort([](const FTicketEntry& A, const FTicketEntry& B)
+		{
+			return A.Ticket.Skill != B.Ticket.Skill ? A.Ticket.Skill < B.Ticket.Skill : A.EnqueueTime < B.EnqueueTime;
+		});
+
+		/** Bigger matches first, they need the tickets accepting any players configuration the most */
+		for (const ESikPlayersConfig Players : { ESikPlayersConfig::FourVsFour, ESikPlayersConfig::TwoVsTwo, ESikPlayersConfig::OneVsOne })
+		{
+			FormMatchesInBucket(Bucket.Value, Players, InNow);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_SikMatchmakingTicketsWaiting, GetNumWaitingTickets());
+}
+
+int32 FSikMatchmaker::GetNumWaitingTickets() const
+{
+	int32 NumWaiting = 0;
+	for (const TPair<FGuid, FTicketEntry>& Pair : Tickets)
+	{
+		NumWaiting += Pair.Value.State == ESikMatchmakingTicketState::Waiting ? 1 : 0;
+	}
+	return NumWaiting;
+}
+
+FSikMatchmakingStatus FSikMatchmaker::MakeStatus(const FGuid& InTicketId) const
+{
+	FSikMatchmakingStatus Status;
+	Status.TicketId = InTicketId;
+
+	const FTicketEntry* Entry = Tickets.Find(InTicketId);
+	if (!Entry)
+	{
+		return Status;
+	}
+
+	Status.State = Entry->State;
+	if (const FMatch* Match = Matches.Find(Entry->MatchId))
+	{
+		Status.Assignment = Match->Assignment;
+	}
+	return Status;
+}
+
+void FSikMatchmaker::FormMatchesInBucket(TArray<FTicketEntry*>& InCandidates, ESikPlayersConfig InPlayers, double InNow)
+{
+	FSikPackedSessionSettings MatchSettings;
+	MatchSettings.Players = InPlayers;
+	const int32 NumPlayers = MatchSettings.GetNumPublicConnections();
+
+	auto AcceptsPlayers = [InPlayers](const FTicketEntry* Entry)
+	{
+		return Entry->State == ESikMatchmakingTicketState::Waiting &&
+			(Entry->Ticket.Preferences.Players == ESikPlayersConfig::Any || Entry->Ticket.Preferences.Players == InPlayers);
+	};
+
+	TArray<FTicketEntry*> Group;
+	for (int32 FirstIndex = 0; FirstIndex < InCandidates.Num(); ++FirstIndex)
+	{
+		FTicketEntry* First = InCandidates[FirstIndex];
+		if (!AcceptsPlayers(First))
+		{
+			continue;
+		}
+
+		Group.Reset();
+		Group.Add(First);
+
+		FSikPackedSessionSettings Merged = First->Ticket.Preferences;
+		int32 SkillWindow = GetSkillWindow(*First, InNow);
+
+		/** Candidates are sorted by skill, the spread only grows from here */
+		for (int32 Index = FirstIndex + 1; Index < InCandidates.Num() && Group.Num() < NumPlayers; ++Index)
+		{
+			FTicketEntry* Candidate = InCandidates[Index];
+			const int32 SkillSpread = Candidate->Ticket.Skill - First->Ticket.Skill;
+			if (SkillSpread > SkillWindow)
+			{
+				break;
+			}
+
+			const int32 CandidateSkillWindow = GetSkillWindow(*Candidate, InNow);
+			if (!AcceptsPlayers(Candidate) || SkillSpread > CandidateSkillWindow)
+			{
+				continue;
+			}
+
+			FSikPackedSessionSettings CandidateMerged = Merged;
+			if (!SikMatchmaker::MergeId(CandidateMerged.MapId, Candidate->Ticket.Preferences.MapId) ||
+				!SikMatchmaker::MergeId(CandidateMerged.GameModeId, Candidate->Ticket.Preferences.GameModeId))
+			{
+				continue;
+			}
+
+			Merged = CandidateMerged;
+			SkillWindow = FMath::Min(SkillWindow, CandidateSkillWindow);
+			Group.Add(Candidate);
+		}
+
+		if (Group.Num() < NumPlayers)
+		{
+			continue;
+		}
+
+		FMatch Match;
+		Match.Assignment.MatchId = FGuid::NewGuid();
+		Match.Assignment.Settings = Merged;
+		Match.Assignment.Settings.Players = InPlayers;
+		Match.Assignment.Settings.Visibility = ESikSessionVisibility::Private;
+		Match.Assignment.NumPlayers = NumPlayers;
+		Match.CreatedTime = InNow;
+
+		FTicketEntry* Host = First;
+		for (FTicketEntry* Member : Group)
+		{
+			Member->State = ESikMatchmakingTicketState::Matched;
+			Member->MatchId = Match.Assignment.MatchId;
+			Match.MemberTicketIds.Add(Member->Ticket.TicketId);
+
+			Host = Member->EnqueueTime < Host->EnqueueTime ? Member : Host;
+		}
+
+		Host->State = ESikMatchmakingTicketState::Host;
+		Match.HostTicketId = Host->Ticket.TicketId;
+
+		Matches.Add(Match.Assignment.MatchId, MoveTemp(Match));
+	}
+}
+
+int32 FSikMatchmaker::GetSkillWindow(const FTicketEntry& InEntry, double InNow) const
+{
+	const double WaitTime = FMath::Max(0.0, InNow - InEntry.EnqueueTime);
+	return FMath::Min(Settings.MaxSkillWindow, Settings.SkillWindow + FMath::FloorToInt32(WaitTime * Settings.SkillWindowGrowth));
+}
+
+void FSikMatchmaker::DissolveMatch(const FGuid& InMatchId)
+{
+	FMatch Match;
+	if (!Matches.RemoveAndCopyValue(InMatchId, Match))
+	{
+		return;
+	}
+
+	/** Enqueue times are kept, the members have waited the longest by now and get the widest windows */
+	for (const FGuid& MemberTicketId : Match.MemberTicketIds)
+	{
+		if (FTicketEntry* Member = Tickets.Find(MemberTicketId))
+		{
+			Member->State = ESikMatchmakingTicketState::Waiting;
+			Member->MatchId.Invalidate();
+		}
+	}
+}
+
+#pragma endregion Matchmaker
+
+#pragma region Local Connection
+
+FSikLocalMatchmakerConnection::FSikLocalMatchmakerConnection(const TSharedRef<FSikMatchmaker>& InMatchmaker, bool bInTickMatchmaker)
+	: Matchmaker(InMatchmaker)
+{
+	if (bInTickMatchmaker)
+	{
+		/** Removed in the destructor, before the connection lets go of the matchmaker */
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([InMatchmaker](float)
+		{
+			InMatchmaker->Tick(FPlatformTime::Seconds());
+			return true;
+		}));
+	}
+}
+
+FSikLocalMatchmakerConnection::~FSikLocalMatchmakerConnection()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+void FSikLocalMatchmakerConnection::Enqueue(const FSikMatchmakingTicket& InTicket)
+{
+	OnStatus.ExecuteIfBound(Matchmaker->Enqueue(InTicket, FPlatformTime::Seconds()));
+}
+
+void FSikLocalMatchmakerConnection::Poll(const FGuid& InTicketId)
+{
+	OnStatus.ExecuteIfBound(Matchmaker->Poll(InTicketId, FPlatformTime::Seconds()));
+}
+
+void FSikLocalMatchmakerConnection::ReportHosted(const FGuid& InTicketId, const FString& InSessionCode)
+{
+	OnStatus.ExecuteIfBound(Matchmaker->ReportHosted(InTicketId, InSessionCode, FPlatformTime::Seconds()));
+}
+
+void FSikLocalMatchmakerConnection::Cancel(const FGuid& InTicketId)
+{
+	Matchmaker->Cancel(InTicketId);
+}
+
+#pragma endregion Local Connection
+
+#pragma region UDP Connection
+
+FSikUdpMatchmakerConnection::FSikUdpMatchmakerConnection(const FString& InServerAddress)
+{
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (!SocketSubsystem)
+	{
+		LOG_ERROR(TEXT("No socket subsystem, matchmaking requests will not be sent"));
+		return;
+	}
+
+	ServerAddress = SocketSubsystem->GetAddressFromString(InServerAddress);
+	if (!ServerAddress.IsValid() || !ServerAddress->IsValid())
+	{
+		LOG_ERROR(TEXT("Invalid matchmaker address %s, matchmaking requests will not be sent"), *InServerAddress);
+		ServerAddress.Reset();
+		return;
+	}
+
+	Socket = FUdpSocketBuilder(TEXT("SikMatchmakerConnection")).AsNonBlocking().AsReusable().Build();
+	if (!Socket)
+	{
+		LOG_ERROR(TEXT("Failed to create the matchmaker connection socket"));
+		return;
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSikUdpMatchmakerConnection::Tick));
+}
+
+FSikUdpMatchmakerConnection::~FSikUdpMatchmakerConnection()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	SikMatchmaker::DestroySocket(Socket);
+}
+
+void FSikUdpMatchmakerConnection::Enqueue(const FSikMatchmakingTicket& InTicket)
+{
+	Send(MakeEnqueueRequest(InTicket));
+}
+
+void FSikUdpMatchmakerConnection::Poll(const FGuid& InTicketId)
+{
+	Send(MakePollRequest(InTicketId));
+}
+
+void FSikUdpMatchmakerConnection::ReportHosted(const FGuid& InTicketId, const FString& InSessionCode)
+{
+	Send(MakeReportHostedRequest(InTicketId, InSessionCode));
+}
+
+void FSikUdpMatchmakerConnection::Cancel(const FGuid& InTicketId)
+{
+	Send(MakeCancelRequest(InTicketId));
+}
+
+TArray<uint8> FSikUdpMatchmakerConnection::MakeEnqueueRequest(const FSikMatchmakingTicket& InTicket)
+{
+	TArray<uint8> Packet;
+	FMemoryWriter Writer(Packet);
+
+	SikMatchmaker::EMessageType Type = SikMatchmaker::EMessageType::Enqueue;
+	FSikMatchmakingTicket Ticket = InTicket;
+	SikMatchmaker::SerializeHeader(Writer, Type);
+	SikMatchmaker::SerializeTicket(Writer, Ticket);
+
+	return Packet;
+}
+
+TArray<uint8> FSikUdpMatchmakerConnection::MakePollRequest(const FGuid& InTicketId)
+{
+	TArray<uint8> Packet;
+	FMemoryWriter Writer(Packet);
+
+	SikMatchmaker::EMessageType Type = SikMatchmaker::EMessageType::Poll;
+	FGuid TicketId = InTicketId;
+	SikMatchmaker::SerializeHeader(Writer, Type);
+	Writer << TicketId;
+
+	return Packet;
+}
+
+TArray<uint8> FSikUdpMatchmakerConnection::MakeReportHostedRequest(const FGuid& InTicketId, const FString& InSessionCode)
+{
+	TArray<uint8> Packet;
+	FMemoryWriter Writer(Packet);
+
+	SikMatchmaker::EMessageType Type = SikMatchmaker::EMessageType::ReportHosted;
+	FGuid TicketId = InTicketId;
+	FString SessionCode = InSessionCode;
+	SikMatchmaker::SerializeHeader(Writer, Type);
+	Writer << TicketId;
+	SikMatchmaker::SerializeString(Writer, SessionCode);
+
+	return Packet;
+}
+
+TArray<uint8> FSikUdpMatchmakerConnection::MakeCancelRequest(const FGuid& InTicketId)
+{
+	TArray<uint8> Packet;
+	FMemoryWriter Writer(Packet);
+
+	SikMatchmaker::EMessageType Type = SikMatchmaker::EMessageType::Cancel;
+	FGuid TicketId = InTicketId;
+	SikMatchmaker::SerializeHeader(Writer, Type);
+	Writer << TicketId;
+
+	return Packet;
+}
+
+bool FSikUdpMatchmakerConnection::ReadStatus(TConstArrayView<uint8> InDatagram, FSikMatchmakingStatus& OutStatus)
+{
+	FMemoryReaderView Reader(MakeMemoryView(InDatagram));
+
+	SikMatchmaker::EMessageType Type = SikMatchmaker::EMessageType::Status;
+	return SikMatchmaker::SerializeHeader(Reader, Type) && Type == SikMatchmaker::EMessageType::Status &&
+		SikMatchmaker::SerializeStatus(Reader, OutStatus);
+}
+
+void FSikUdpMatchmakerConnection::Send(const TArray<uint8>& InPacket)
+{
+	if (!IsValid())
+	{
+		return;
+	}
+
+	int32 BytesSent = 0;
+	if (!Socket->SendTo(InPacket.GetData(), InPacket.Num(), BytesSent, *ServerAddress) || BytesSent != InPacket.Num())
+	{
+		LOG_WARNING(TEXT("Failed to send a matchmaking request to %s"), *ServerAddress->ToString(true));
+	}
+}
+
+bool FSikUdpMatchmakerConnection::Tick(float DeltaTime)
+{
+	/** Answers are collected first, handling one may send requests */
+	TArray<FSikMatchmakingStatus> Statuses;
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(SikMatchmaker::MaxPacketSize);
+
+	uint32 PendingDataSize = 0;
+	while (Socket && Socket->HasPendingData(PendingDataSize))
+	{
+		int32 BytesRead = 0;
+		if (!Socket->Recv(Buffer.GetData(), Buffer.Num(), BytesRead))
+		{
+			break;
+		}
+
+		FSikMatchmakingStatus Status;
+		if (ReadStatus(MakeArrayView(Buffer.GetData(), BytesRead), Status))
+		{
+			Statuses.Add(MoveTemp(Status));
+		}
+	}
+
+	for (const FSikMatchmakingStatus& Status : Statuses)
+	{
+		OnStatus.ExecuteIfBound(Status);
+	}
+
+	return true;
+}
+
+#pragma endregion UDP Connection
+
+#pragma region Server
+
+FSikMatchmakerServer::FSikMatchmakerServer(const FSikMatchmakerSettings& InSettings)
+	: Matchmaker(MakeShared<FSikMatchmaker>(InSettings))
+{
+}
+
+FSikMatchmakerServer::~FSikMatchmakerServer()
+{
+	Stop();
+}
+
+bool FSikMatchmakerServer::Start(int32 InPort, bool bInBindAny)
+{
+	Stop();
+
+	const FIPv4Address BindAddress = bInBindAny ? FIPv4Address::Any : FIPv4Address::InternalLoopback;
+	
+	Socket = FUdpSocketBuilder(TEXT("SikMatchmakerServer")).AsNonBlocking().AsReusable()
+		.BoundToAddress(BindAddress).BoundToPort(InPort).Build();
+	if (!Socket)
+	{
+		LOG_ERROR(TEXT("Failed to bind the matchmaker server to %s:%d"), *BindAddress.ToString(), InPort);
+		return false;
+	}
+
+	LOG_INFO(TEXT("Matchmaker server listening on %s:%d"), *BindAddress.ToString(), InPort);
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSikMatchmakerServer::Tick));
+	return true;
+}
+
+void FSikMatchmakerServer::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	SikMatchmaker::DestroySocket(Socket);
+}
+
+bool FSikMatchmakerServer::HandleRequest(TConstArrayView<uint8> InRequest, double InNow, TArray<uint8>& OutReply)
+{
+	OutReply.Reset();
+
+	FMemoryReaderView Reader(MakeMemoryView(InRequest));
+
+	SikMatchmaker::EMessageType Type = SikMatchmaker::EMessageType::Status;
+	if (!SikMatchmaker::SerializeHeader(Reader, Type))
+	{
+		return false;
+	}
+
+	FSikMatchmakingStatus Status;
+	switch (Type)
+	{
+	case SikMatchmaker::EMessageType::Enqueue:
+	{
+		FSikMatchmakingTicket Ticket;
+		if (!SikMatchmaker::SerializeTicket(Reader, Ticket))
+		{
+			return false;
+		}
+		Status = Matchmaker->Enqueue(Ticket, InNow);
+		break;
+	}
+	case SikMatchmaker::EMessageType::Poll:
+	{
+		FGuid TicketId;
+		Reader << TicketId;
+		if (Reader.IsError())
+		{
+			return false;
+		}
+		Status = Matchmaker->Poll(TicketId, InNow);
+		break;
+	}
+	case SikMatchmaker::EMessageType::ReportHosted:
+	{
+		FGuid TicketId;
+		FString SessionCode;
+		Reader << TicketId;
+		SikMatchmaker::SerializeString(Reader, SessionCode);
+		if (Reader.IsError())
+		{
+			return false;
+		}
+		Status = Matchmaker->ReportHosted(TicketId, SessionCode, InNow);
+		break;
+	}
+	case SikMatchmaker::EMessageType::Cancel:
+	{
+		FGuid TicketId;
+		Reader << TicketId;
+		if (Reader.IsError())
+		{
+			return false;
+		}
+		Matchmaker->Cancel(TicketId);
+		return true;
+	}
+	default:
+		return false;
+	}
+
+	FMemoryWriter Writer(OutReply);
+
+	SikMatchmaker::EMessageType ReplyType = SikMatchmaker::EMessageType::Status;
+	SikMatchmaker::SerializeHeader(Writer, ReplyType);
+	SikMatchmaker::SerializeStatus(Writer, Status);
+
+	return true;
+}
+
+bool FSikMatchmakerServer::Tick(float DeltaTime)
+{
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (!Socket || !SocketSubsystem)
+	{
+		return true;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const TSharedRef<FInternetAddr> Sender = SocketSubsystem->CreateInternetAddr();
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(SikMatchmaker::MaxPacketSize);
+
+	uint32 PendingDataSize = 0;
+	while (Socket->HasPendingData(PendingDataSize))
+	{
+		int32 BytesRead = 0;
+		if (!Socket->RecvFrom(Buffer.GetData(), Buffer.Num(), BytesRead, *Sender))
+		{
+			break;
+		}
+
+		TArray<uint8> Reply;
+		if (HandleRequest(MakeArrayView(Buffer.GetData(), BytesRead), Now, Reply) && Reply.Num() > 0)
+		{
+			int32 BytesSent = 0;
+			Socket->SendTo(Reply.GetData(), Reply.Num(), BytesSent, *Sender);
+		}
+	}
+
+	Matchmaker->Tick(Now);
+
+	return true;
+}
+
+#pragma endregion Server
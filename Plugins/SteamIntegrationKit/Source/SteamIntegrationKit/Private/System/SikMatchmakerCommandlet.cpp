@@ -0,0 +1,53 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikMatchmakerCommandlet.h"
+
+#include "Containers/Ticker.h"
+#include "Misc/CoreMisc.h"
+#include "Subsystem/SikSubsystem.h"
+#include "System/SikLogger.h"
+#include "System/SikMatchmaker.h"
+
+USikMatchmakerCommandlet::USikMatchmakerCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 USikMatchmakerCommandlet::Main(const FString& Params)
+{
+	const USikSubsystem* SubsystemDefaults = GetDefault<USikSubsystem>();
+	
+	int32 Port = SubsystemDefaults->GetMatchmakerPort();
+	FParse::Value(*Params, TEXT("Port="), Port);
+	
+	const bool bBindAny = SubsystemDefaults->ShouldMatchmakerServerBindAny() || FParse::Param(*Params, TEXT("BindAny"));
+	
+	FSikMatchmakerServer Server(SubsystemDefaults->GetMatchmakerSettings());
+	if (!Server.Start(Port, bBindAny))
+	{
+		SikLog::Flush();
+		return 1;
+	}
+	
+	UE_LOG(SteamIntegrationKitLog, Display, TEXT("Matchmaker serving on port %d, Ctrl+C to stop"), Port);
+	SikLog::Flush();
+	
+	/** No engine loop runs the core ticker in a commandlet, the server is ticked from here */
+	double LastTime = FPlatformTime::Seconds();
+	while (!IsEngineExitRequested())
+	{
+		const double Now = FPlatformTime::Seconds();
+		FTSTicker::GetCoreTicker().Tick(static_cast<float>(Now - LastTime));
+		LastTime = Now;
+		
+		FPlatformProcess::Sleep(0.01f);
+	}
+	
+	Server.Stop();
+	SikLog::Flush();
+	
+	return 0;
+}
@@ -0,0 +1,384 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikMatchmakingClient.h"
+
+#include "Engine/GameInstance.h"
+#include "Online/OnlineSessionNames.h"
+#include "Subsystem/SikSubsystem.h"
+#include "System/SikLogger.h"
+#include "TimerManager.h"
+
+FSikMatchmakingClient::FSikMatchmakingClient(USikSubsystem& InSubsystem)
+	: Subsystem(InSubsystem)
+{
+}
+
+FSikMatchmakingClient::~FSikMatchmakingClient()
+{
+	/** Poll timer calls into this client, it must not outlive it */
+	if (const UGameInstance* GameInstance = Subsystem.GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(PollTimerHandle);
+	}
+}
+
+void FSikMatchmakingClient::Start(const FString& InRegion, const int32 InSkill, const FSikCustomSessionSettings& InPreferences)
+{
+	LOG_INFO(TEXT("Called Region: %s | Skill: %d | Map: %s | GameMode: %s | Players: %s"), *InRegion, InSkill, 
+		*InPreferences.MapName, *InPreferences.GameMode, *InPreferences.Players);
+	
+	if (Stage != ESikMatchmakingStage::None)
+	{
+		LOG_WARNING(TEXT("Matchmaking already running, ignoring"));
+		return;
+	}
+	
+	UGameInstance* GameInstance = Subsystem.GetGameInstance();
+	if (!Subsystem.SessionInterface.IsValid() || !GameInstance)
+	{
+		LOG_ERROR(TEXT("StartMatchmaking SessionInterface is INVALID"));
+		Subsystem.MultiplayerSessionsOnMatchmakingComplete.Broadcast(ESikMatchResult::Failed);
+		return;
+	}
+	
+	/** A matchmaker of its own would only ever hold this player's ticket, which never fills a match */
+	if (Subsystem.MatchmakerTransport == ESikMatchmakerTransport::InProcess && !Subsystem.MatchmakerServer.IsValid())
+	{
+		LOG_ERROR(TEXT("No matchmaker in this process, start it with -SikMatchmakerServer or set MatchmakerTransport=Udp"));
+		Subsystem.MultiplayerSessionsOnMatchmakingComplete.Broadcast(ESikMatchResult::Failed);
+		return;
+	}
+	
+	if (!Connection.IsValid())
+	{
+		CreateConnection();
+	}
+	
+	Ticket = FSikMatchmakingTicket();
+	Ticket.Region = InRegion;
+	Ticket.Skill = InSkill;
+	Ticket.Preferences = FSikSessionSchema::FromReadable(InPreferences);
+	DeadlineTime = FPlatformTime::Seconds() + Subsystem.MatchmakingTimeout;
+	
+	Subsystem.SessionMetrics.BeginSpan(SIK_SPAN_MATCHMAKING);
+	Subsystem.FlightRecorder.Record(ESikFlightEventType::Issued, ESikFlightSubject::Matchmaking, 0, InSkill);
+	
+	GameInstance->GetTimerManager().SetTimer(PollTimerHandle, FTimerDelegate::CreateRaw(this, &FSikMatchmakingClient::Poll), 
+		FMath::Max(Subsystem.MatchmakerPollInterval, UE_KINDA_SMALL_NUMBER), true);
+	
+	EnqueueTicket();
+}
+
+void FSikMatchmakingClient::Cancel()
+{
+	if (Stage == ESikMatchmakingStage::None)
+	{
+		return;
+	}
+	
+	LOG_INFO(TEXT("Called"));
+	
+	/** Outcome was already broadcast, only the report is left undone */
+	if (!IsMatchmaking())
+	{
+		Stop();
+		return;
+	}
+	
+	/** Dropped before cancelling so the cancelled step does not move the matchmaking on */
+	const FSikSessionTaskHandle CancelledStep = Step;
+	Step = FSikSessionTaskHandle();
+	CancelledStep.Cancel();
+	
+	Finish(ESikMatchResult::Cancelled);
+}
+
+void FSikMatchmakingClient::OnLobbyLoaded()
+{
+	if (Stage == ESikMatchmakingStage::AwaitingTravel)
+	{
+		Stage = ESikMatchmakingStage::Reporting;
+		Poll();
+	}
+}
+
+void FSikMatchmakingClient::CreateConnection()
+{
+	if (Subsystem.MatchmakerTransport == ESikMatchmakerTransport::Udp)
+	{
+		Connection = MakeShared<FSikUdpMatchmakerConnection>(Subsystem.MatchmakerAddress);
+	}
+	else
+	{
+		Connection = MakeShared<FSikLocalMatchmakerConnection>(Subsystem.MatchmakerServer->GetMatchmaker(), false);
+	}
+	
+	/** Connection is owned by this client and goes away with it */
+	Connection->OnStatus.BindRaw(this, &FSikMatchmakingClient::OnStatus);
+}
+
+void FSikMatchmakingClient::EnqueueTicket()
+{
+	Ticket.TicketId = FGuid::NewGuid();
+	Assignment = FSikMatchAssignment();
+	Stage = ESikMatchmakingStage::Queued;
+	
+	LOG_INFO(TEXT("Enqueueing matchmaking ticket %s"), *Ticket.TicketId.ToString());
+	
+	/** In process connection answers right away, the stage is set before */
+	Connection->Enqueue(Ticket);
+}
+
+void FSikMatchmakingClient::Poll()
+{
+	if (!Connection.IsValid())
+	{
+		return;
+	}
+	
+	switch (Stage)
+	{
+	case ESikMatchmakingStage::Queued:
+		if (FPlatformTime::Seconds() >= DeadlineTime)
+		{
+			LOG_WARNING(TEXT("No match found within %.0fs"), Subsystem.MatchmakingTimeout);
+			Finish(ESikMatchResult::Failed);
+			return;
+		}
+		Connection->Poll(Ticket.TicketId);
+		break;
+		
+	/** Creating the session and loading the lobby may outlast the ticket timeout, the ticket is kept alive meanwhile */
+	case ESikMatchmakingStage::Hosting:
+	case ESikMatchmakingStage::AwaitingTravel:
+		Connection->Poll(Ticket.TicketId);
+		break;
+		
+	/** Repeated until acknowledged, datagrams may be lost */
+	case ESikMatchmakingStage::Reporting:
+		Connection->ReportHosted(Ticket.TicketId, SessionCode);
+		break;
+		
+	default:
+		break;
+	}
+}
+
+void FSikMatchmakingClient::OnStatus(const FSikMatchmakingStatus& InStatus)
+{
+	if (InStatus.TicketId != Ticket.TicketId)
+	{
+		return;
+	}
+	
+	if (Stage == ESikMatchmakingStage::Reporting)
+	{
+		if (InStatus.State == ESikMatchmakingTicketState::Reported)
+		{
+			LOG_INFO(TEXT("Matchmaker has the code of match %s"), *InStatus.Assignment.MatchId.ToString());
+			Stop();
+		}
+		else if (InStatus.State == ESikMatchmakingTicketState::Unknown)
+		{
+			LOG_WARNING(TEXT("Matchmaker dropped the ticket before the session was reported, the other members were requeued"));
+			Stop();
+		}
+		return;
+	}
+	
+	if (Stage != ESikMatchmakingStage::Queued)
+	{
+		return;
+	}
+	
+	switch (InStatus.State)
+	{
+	/** Matchmaker restarted or the ticket expired, it is enqueued again */
+	case ESikMatchmakingTicketState::Unknown:
+		LOG_WARNING(TEXT("Matchmaker does not know ticket %s, enqueueing again"), *Ticket.TicketId.ToString());
+		Connection->Enqueue(Ticket);
+		break;
+		
+	case ESikMatchmakingTicketState::Host:
+		Assignment = InStatus.Assignment;
+		HostMatch();
+		break;
+		
+	case ESikMatchmakingTicketState::Join:
+		Assignment = InStatus.Assignment;
+		JoinMatch();
+		break;
+		
+	default:
+		break;
+	}
+}
+
+void FSikMatchmakingClient::HostMatch()
+{
+	LOG_INFO(TEXT("Hosting match %s of %d players"), *Assignment.MatchId.ToString(), Assignment.NumPlayers);
+	Subsystem.FlightRecorder.Record(ESikFlightEventType::Callback, ESikFlightSubject::Matchmaking, 
+		static_cast<uint8>(ESikMatchmakingTicketState::Host), Assignment.NumPlayers);
+	
+	Stage = ESikMatchmakingStage::Hosting;
+	
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Create;
+	Operation.bMatchFlow = true;
+	
+	/** Private so only the members find it, by the code reported to the matchmaker */
+	Operation.CreateSettings = FSikSessionSchema::ToReadable(Assignment.Settings);
+	Operation.CreateSettings.Visibility = FString("Private");
+	Subsystem.FillUnsetSessionSettings(Operation.CreateSettings);
+	
+	Subsystem.ClearReconnectTarget();
+	
+	RunStep(Subsystem.EnqueueAwaitedSessionOperation(MoveTemp(Operation), 0.f), &FSikMatchmakingClient::OnHostComplete);
+}
+
+void FSikMatchmakingClient::OnHostComplete(const FSikSessionTaskResult& InResult)
+{
+	if (!InResult.WasSuccessful())
+	{
+		/** Cancelling the ticket sends the other members back to the queue */
+		Finish(InResult.Result == ESikSessionOperationResult::Cancelled ? ESikMatchResult::Cancelled : ESikMatchResult::Failed);
+		return;
+	}
+	
+	SessionCode.Reset();
+	Subsystem.GetSessionSetting(SETTING_SESSIONKEY, SessionCode);
+	
+	Finish(ESikMatchResult::Hosted);
+}
+
+void FSikMatchmakingClient::JoinMatch()
+{
+	LOG_INFO(TEXT("Joining match %s, session %s"), *Assignment.MatchId.ToString(), *Assignment.SessionCode);
+	Subsystem.FlightRecorder.Record(ESikFlightEventType::Callback, ESikFlightSubject::Matchmaking, 
+		static_cast<uint8>(ESikMatchmakingTicketState::Join), Assignment.NumPlayers);
+	
+	Stage = ESikMatchmakingStage::Joining;
+	
+	/** Matchmaker has nothing more to tell, a failed join enqueues a new ticket */
+	Connection->Cancel(Ticket.TicketId);
+	
+	RunStep(Subsystem.FindSessionByCodeAsync(Assignment.SessionCode, 0.f), &FSikMatchmakingClient::OnSessionFound);
+}
+
+void FSikMatchmakingClient::OnSessionFound(const FSikSessionTaskResult& InResult)
+{
+	if (!InResult.WasSuccessful())
+	{
+		OnJoinComplete(InResult);
+		return;
+	}
+	
+	FSikQueuedSessionOperation Operation;
+	Operation.Operation = ESikSessionOperation::Join;
+	Operation.SessionToJoin = InResult.SessionResult;
+	Operation.bMatchFlow = true;
+	
+	RunStep(Subsystem.EnqueueAwaitedSessionOperation(MoveTemp(Operation), 0.f), &FSikMatchmakingClient::OnJoinComplete);
+}
+
+void FSikMatchmakingClient::OnJoinComplete(const FSikSessionTaskResult& InResult)
+{
+	if (InResult.WasSuccessful())
+	{
+		Finish(ESikMatchResult::Joined);
+		return;
+	}
+	
+	/** A later lookup, create or join replaced this one, the player has moved on */
+	if (InResult.Result == ESikSessionOperationResult::Cancelled)
+	{
+		Finish(ESikMatchResult::Cancelled);
+		return;
+	}
+	
+	LOG_WARNING(TEXT("Could not join match %s : %s"), *Assignment.MatchId.ToString(), *UEnum::GetValueAsString(InResult.Result));
+	
+	if (FPlatformTime::Seconds() >= DeadlineTime)
+	{
+		Finish(ESikMatchResult::Failed);
+		return;
+	}
+	
+	EnqueueTicket();
+}
+
+void FSikMatchmakingClient::RunStep(const FSikSessionTaskHandle& InStep, void (FSikMatchmakingClient::*InOnComplete)(const FSikSessionTaskResult&))
+{
+	Step = InStep;
+	
+	/** Client is reset by Deinitialize, the subsystem is only the way back to it */
+	const TWeakObjectPtr<USikSubsystem> WeakSubsystem(&Subsystem);
+	const TWeakPtr<FSikSessionTask> WeakStepTask = InStep.Task;
+	InStep.OnComplete([WeakSubsystem, WeakStepTask, InOnComplete](const FSikSessionTaskResult& InResult)
+	{
+		USikSubsystem* OwningSubsystem = WeakSubsystem.Get();
+		FSikMatchmakingClient* Client = OwningSubsystem ? OwningSubsystem->MatchmakingClient.Get() : nullptr;
+		
+		/** Steps dropped by a cancel still complete, only the tracked one moves the matchmaking on */
+		const TSharedPtr<FSikSessionTask> StepTask = WeakStepTask.Pin();
+		if (!Client || !StepTask.IsValid() || Client->Step.Task != StepTask)
+		{
+			return;
+		}
+		
+		Client->Step = FSikSessionTaskHandle();
+		(Client->*InOnComplete)(InResult);
+	});
+}
+
+void FSikMatchmakingClient::Finish(const ESikMatchResult InResult)
+{
+	LOG_INFO(TEXT("Matchmaking : %s"), *UEnum::GetValueAsString(InResult));
+	
+	Step = FSikSessionTaskHandle();
+	
+	/** Host keeps its ticket and the poll timer until the session is reported from the lobby */
+	if (InResult == ESikMatchResult::Hosted)
+	{
+		Stage = ESikMatchmakingStage::AwaitingTravel;
+	}
+	else
+	{
+		Stop();
+	}
+	
+	if (InResult == ESikMatchResult::Cancelled)
+	{
+		Subsystem.SessionMetrics.CancelSpan(SIK_SPAN_MATCHMAKING);
+	}
+	else
+	{
+		Subsystem.SessionMetrics.EndSpan(SIK_SPAN_MATCHMAKING, InResult != ESikMatchResult::Failed);
+	}
+	Subsystem.FlightRecorder.Record(ESikFlightEventType::Finished, ESikFlightSubject::Matchmaking, static_cast<uint8>(InResult));
+	
+	Subsystem.MultiplayerSessionsOnMatchmakingComplete.Broadcast(InResult);
+	
+	if (InResult == ESikMatchResult::Failed)
+	{
+		Subsystem.DumpFlightRecorderOnFailure(TEXT("MatchmakingFailed"));
+	}
+}
+
+void FSikMatchmakingClient::Stop()
+{
+	if (Connection.IsValid() && Ticket.TicketId.IsValid())
+	{
+		Connection->Cancel(Ticket.TicketId);
+	}
+	
+	Stage = ESikMatchmakingStage::None;
+	Ticket.TicketId.Invalidate();
+	SessionCode.Reset();
+	Step = FSikSessionTaskHandle();
+	
+	if (const UGameInstance* GameInstance = Subsystem.GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(PollTimerHandle);
+	}
+}
@@ -0,0 +1,782 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikMockOnlineSession.h"
+
+#include "Online/CoreOnline.h"
+#include "Online/OnlineSessionNames.h"
+#include "OnlineSubsystemTypes.h"
+#include "Subsystem/SikSubsystem.h"
+#include "System/SikLogger.h"
+#include "System/SikSessionCode.h"
+
+namespace SikMockOnlineSession
+{
+	/** Type every id handed out by the mock backend is tagged with */
+	const FName IdType = FName("SikMock");
+
+	/** Address the mock sessions resolve to, joining clients travel there */
+	const FString ConnectAddress = FString("127.0.0.1:7777");
+
+	/** Steam lobby ids carry these bits, ids in this range can be encoded into session codes */
+	constexpr uint64 LobbyIdBits = 0x0186000000000000ull;
+
+	/**
+	 * Session info of the mock sessions, only carries the session id
+	 ******************************************************************************************/
+	class FSessionInfo : public FOnlineSessionInfo
+	{
+	public:
+		explicit FSessionInfo(const FString& InSessionId)
+			: SessionId(FUniqueNetIdString::Create(InSessionId, IdType))
+		{
+		}
+
+		virtual const FUniqueNetId& GetSessionId() const override { return *SessionId; }
+		virtual const uint8* GetOnlinePlatformData() const override { return nullptr; }
+		virtual int32 GetSize() const override { return sizeof(FSessionInfo); }
+		virtual bool IsValid() const override { return SessionId->IsValid(); }
+		virtual FString ToString() const override { return SessionId->ToString(); }
+		virtual FString ToDebugString() const override { return FString::Printf(TEXT("SessionId: %s"), *SessionId->ToDebugString()); }
+
+	private:
+		FUniqueNetIdRef SessionId;
+	};
+
+	/** @returns true if the value compares to the searched value the way the search term asks */
+	bool Compare(const FVariantData& InValue, const FVariantData& InSearchedValue, EOnlineComparisonOp::Type InComparisonOp)
+	{
+		switch (InComparisonOp)
+		{
+		case EOnlineComparisonOp::Equals:
+			return InValue == InSearchedValue;
+		case EOnlineComparisonOp::NotEquals:
+			return InValue != InSearchedValue;
+		default:
+			break;
+		}
+
+		const double Value = FCString::Atod(*InValue.ToString());
+		const double SearchedValue = FCString::Atod(*InSearchedValue.ToString());
+
+		switch (InComparisonOp)
+		{
+		case EOnlineComparisonOp::GreaterThan:
+			return Value > SearchedValue;
+		case EOnlineComparisonOp::GreaterThanEquals:
+			return Value >= SearchedValue;
+		case EOnlineComparisonOp::LessThan:
+			return Value < SearchedValue;
+		case EOnlineComparisonOp::LessThanEquals:
+			return Value <= SearchedValue;
+		default:
+			/** Near and In terms are not used by the kit, they never filter anything out */
+			return true;
+		}
+	}
+}
+
+FSikMockOnlineSession::FSikMockOnlineSession(const FSikMockBackendSettings& InSettings)
+	: Settings(InSettings)
+	, RandomStream(InSettings.Seed)
+	, LocalUserId(FUniqueNetIdString::Create(TEXT("SikMockLocalUser"), SikMockOnlineSession::IdType))
+{
+	if (Settings.MapNames.IsEmpty()) Settings.MapNames.Add(FString("Erangel"));
+	if (Settings.GameModes.IsEmpty()) Settings.GameModes.Add(FString("Deathmatch"));
+	if (Settings.Players.IsEmpty()) Settings.Players.Add(FString("1v1"));
+
+	Lobbies.Reserve(Settings.LobbyCount);
+	
+	for (int32 Index = 0; Index < Settings.LobbyCount; ++Index)
+	{
+		FSikCustomSessionSettings LobbySettings;
+		LobbySettings.MapName = Settings.MapNames[RandomStream.RandHelper(Settings.MapNames.Num())];
+		LobbySettings.GameMode = Settings.GameModes[RandomStream.RandHelper(Settings.GameModes.Num())];
+		LobbySettings.Players = Settings.Players[RandomStream.RandHelper(Settings.Players.Num())];
+		LobbySettings.Visibility = RandomStream.FRand() < Settings.PrivateLobbyRate ? FString("Private") : FString("Public");
+
+		const FSikPackedSessionSettings PackedSettings = FSikSessionSchema::FromReadable(LobbySettings);
+		const int32 NumPublicConnections = PackedSettings.GetNumPublicConnections();
+
+		FOnlineSessionSettings SessionSettings;
+		SessionSettings.NumPublicConnections = NumPublicConnections;
+		SessionSettings.bShouldAdvertise = true;
+		SessionSettings.bUsesPresence = true;
+		SessionSettings.bUseLobbiesIfAvailable = true;
+		SessionSettings.bAllowJoinInProgress = true;
+		SessionSettings.Set(SETTING_FILTERSEED, SETTING_FILTERSEED_VALUE, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+		FSikSessionSchema::Advertise(PackedSettings, SessionSettings);
+
+		const FString HostName = FString::Printf(TEXT("SikMockHost_%d"), Index);
+		FOnlineSessionSearchResult& Lobby = AddLobby(SessionSettings, FUniqueNetIdString::Create(HostName, SikMockOnlineSession::IdType), HostName);
+		Lobby.Session.NumOpenPublicConnections = RandomStream.RandRange(0, NumPublicConnections - 1);
+		Lobby.PingInMs = RandomStream.RandRange(15, 250);
+	}
+	
+	LOG_INFO(TEXT("Mock backend synthesized %d lobbies from seed %d"), Lobbies.Num(), Settings.Seed);
+}
+
+FSikMockOnlineSession::~FSikMockOnlineSession()
+{
+	if (PendingSearchHandle.IsValid())
+	{
+		FTSTicker::RemoveTicker(PendingSearchHandle);
+	}
+}
+
+#pragma region Helpers
+
+FTSTicker::FDelegateHandle FSikMockOnlineSession::Schedule(TFunction<void(FSikMockOnlineSession&)>&& InCompletion)
+{
+	TWeakPtr<FSikMockOnlineSession, ESPMode::ThreadSafe> WeakThis = AsShared();
+	
+	return FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[WeakThis, Completion = MoveTemp(InCompletion)](float DeltaTime)
+		{
+			if (const TSharedPtr<FSikMockOnlineSession, ESPMode::ThreadSafe> PinnedThis = WeakThis.Pin())
+			{
+				Completion(*PinnedThis);
+			}
+			return false;
+		}), NextLatency());
+}
+
+float FSikMockOnlineSession::NextLatency()
+{
+	return FMath::Max(0.f, Settings.Latency + RandomStream.FRandRange(-Settings.LatencyJitter, Settings.LatencyJitter));
+}
+
+bool FSikMockOnlineSession::NextOperationFails()
+{
+	return RandomStream.FRand() < Settings.FailureRate;
+}
+
+FOnlineSessionSearchResult& FSikMockOnlineSession::AddLobby(const FOnlineSessionSettings& InSessionSettings, 
+	const FUniqueNetIdRef& InHostId, const FString& InHostName)
+{
+	FOnlineSessionSearchResult& Lobby = Lobbies.AddDefaulted_GetRef();
+	Lobby.Session = FOnlineSession(InSessionSettings);
+	Lobby.Session.OwningUserId = InHostId;
+	Lobby.Session.OwningUserName = InHostName;
+	Lobby.Session.NumOpenPublicConnections = InSessionSettings.NumPublicConnections;
+	Lobby.Session.SessionInfo = MakeShared<SikMockOnlineSession::FSessionInfo>(GenerateLobbyId());
+
+	/** Lobbies advertise a code encoding their id, the same way USikSubsystem advertises it for created sessions */
+	FString SessionCode;
+	if (FSikSessionCode::EncodeSessionId(Lobby.GetSessionIdStr(), SessionCode))
+	{
+		Lobby.Session.SessionSettings.Set(SETTING_SESSIONKEY, SessionCode, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	}
+
+	return Lobby;
+}
+
+FString FSikMockOnlineSession::GenerateLobbyId()
+{
+	const uint64 LobbyId = SikMockOnlineSession::LobbyIdBits | static_cast<uint32>(RandomStream.GetUnsignedInt());
+	return FString::Printf(TEXT("%llu"), LobbyId);
+}
+
+bool FSikMockOnlineSession::MatchesSearch(const FOnlineSessionSearchResult& InLobby, const FOnlineSessionSearch& InSearch)
+{
+	for (const TPair<FName, FOnlineSessionSearchParam>& SearchParam : InSearch.QuerySettings.SearchParams)
+	{
+		if (SearchParam.Key == SEARCH_LOBBIES || SearchParam.Key == SEARCH_PRESENCE)
+		{
+			continue;
+		}
+
+		if (SearchParam.Key == SEARCH_MINSLOTSAVAILABLE)
+		{
+			int32 MinSlotsAvailable = 0;
+			SearchParam.Value.Data.GetValue(MinSlotsAvailable);
+			if (InLobby.Session.NumOpenPublicConnections < MinSlotsAvailable)
+			{
+				return false;
+			}
+			continue;
+		}
+
+		const FOnlineSessionSetting* LobbySetting = InLobby.Session.SessionSettings.Settings.Find(SearchParam.Key);
+		if (!LobbySetting || !SikMockOnlineSession::Compare(LobbySetting->Data, SearchParam.Value.Data, SearchParam.Value.ComparisonOp))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+FOnlineSessionSearchResult* FSikMockOnlineSession::FindLobby(const FString& InSessionId)
+{
+	return Lobbies.FindByPredicate([&InSessionId](const FOnlineSessionSearchResult& Lobby)
+	{
+		return Lobby.GetSessionIdStr() == InSessionId;
+	});
+}
+
+#pragma endregion Helpers
+
+#pragma region Named Sessions
+
+FUniqueNetIdPtr FSikMockOnlineSession::CreateSessionIdFromString(const FString& SessionIdStr)
+{
+	if (SessionIdStr.IsEmpty())
+	{
+		return nullptr;
+	}
+	
+	return FUniqueNetIdString::Create(SessionIdStr, SikMockOnlineSession::IdType);
+}
+
+FNamedOnlineSession* FSikMockOnlineSession::GetNamedSession(FName SessionName)
+{
+	return Sessions.FindByPredicate([SessionName](const FNamedOnlineSession& Session)
+	{
+		return Session.SessionName == SessionName;
+	});
+}
+
+void FSikMockOnlineSession::RemoveNamedSession(FName SessionName)
+{
+	Sessions.RemoveAll([SessionName](const FNamedOnlineSession& Session)
+	{
+		return Session.SessionName == SessionName;
+	});
+}
+
+EOnlineSessionState::Type FSikMockOnlineSession::GetSessionState(FName SessionName) const
+{
+	const FNamedOnlineSession* Session = Sessions.FindByPredicate([SessionName](const FNamedOnlineSession& NamedSession)
+	{
+		return NamedSession.SessionName == SessionName;
+	});
+	
+	return Session ? Session->SessionState : EOnlineSessionState::NoSession;
+}
+
+bool FSikMockOnlineSession::HasPresenceSession()
+{
+	return Sessions.ContainsByPredicate([](const FNamedOnlineSession& Session)
+	{
+		return Session.SessionSettings.bUsesPresence;
+	});
+}
+
+FNamedOnlineSession* FSikMockOnlineSession::AddNamedSession(FName SessionName, const FOnlineSessionSettings& SessionSettings)
+{
+	return &Sessions.Emplace_GetRef(SessionName, SessionSettings);
+}
+
+FNamedOnlineSession* FSikMockOnlineSession::AddNamedSession(FName SessionName, const FOnlineSession& Session)
+{
+	return &Sessions.Emplace_GetRef(SessionName, Session);
+}
+
+FOnlineSessionSettings* FSikMockOnlineSession::GetSessionSettings(FName SessionName)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	return Session ? &Session->SessionSettings : nullptr;
+}
+
+int32 FSikMockOnlineSession::GetNumSessions()
+{
+	return Sessions.Num();
+}
+
+void FSikMockOnlineSession::DumpSessionState()
+{
+	LOG_INFO(TEXT("Mock backend: %d lobbies, %d sessions"), Lobbies.Num(), Sessions.Num());
+	
+	for (const FNamedOnlineSession& Session : Sessions)
+	{
+		LOG_INFO(TEXT("Session %s | Id: %s | State: %s | Registered players: %d"), *Session.SessionName.ToString(), 
+			Session.SessionInfo.IsValid() ? *Session.SessionInfo->ToString() : TEXT("None"), 
+			EOnlineSessionState::ToString(Session.SessionState), Session.RegisteredPlayers.Num());
+	}
+}
+
+#pragma endregion Named Sessions
+
+#pragma region Session Lifetime
+
+bool FSikMockOnlineSession::CreateSession(int32 HostingPlayerNum, FName SessionName, const FOnlineSessionSettings& NewSessionSettings)
+{
+	return CreateSession(*LocalUserId, SessionName, NewSessionSettings);
+}
+
+bool FSikMockOnlineSession::CreateSession(const FUniqueNetId& HostingPlayerId, FName SessionName, const FOnlineSessionSettings& NewSessionSettings)
+{
+	if (GetNamedSession(SessionName))
+	{
+		LOG_WARNING(TEXT("Mock backend cannot create session %s, it already exists"), *SessionName.ToString());
+		return false;
+	}
+	
+	FNamedOnlineSession* Session = AddNamedSession(SessionName, NewSessionSettings);
+	Session->SessionState = EOnlineSessionState::Creating;
+	Session->OwningUserId = LocalUserId;
+	Session->OwningUserName = LocalUserId->ToString();
+	Session->LocalOwnerId = LocalUserId;
+	Session->bHosting = true;
+	Session->NumOpenPublicConnections = NewSessionSettings.NumPublicConnections;
+	Session->SessionInfo = MakeShared<SikMockOnlineSession::FSessionInfo>(GenerateLobbyId());
+	
+	const bool bFails = NextOperationFails();
+	Schedule([SessionName, bFails](FSikMockOnlineSession& This)
+	{
+		FNamedOnlineSession* CreatedSession = This.GetNamedSession(SessionName);
+		if (!CreatedSession || bFails)
+		{
+			This.RemoveNamedSession(SessionName);
+			This.TriggerOnCreateSessionCompleteDelegates(SessionName, false);
+			return;
+		}
+		
+		CreatedSession->SessionState = EOnlineSessionState::Pending;
+		
+		if (CreatedSession->SessionSettings.bShouldAdvertise)
+		{
+			FOnlineSessionSearchResult& Lobby = This.Lobbies.AddDefaulted_GetRef();
+			Lobby.Session = *CreatedSession;
+			Lobby.PingInMs = 0;
+		}
+		
+		This.TriggerOnCreateSessionCompleteDelegates(SessionName, true);
+	});
+	
+	return true;
+}
+
+bool FSikMockOnlineSession::StartSession(FName SessionName)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (!Session || (Session->SessionState != EOnlineSessionState::Pending && Session->SessionState != EOnlineSessionState::Ended))
+	{
+		return false;
+	}
+	
+	Session->SessionState = EOnlineSessionState::Starting;
+	
+	const bool bFails = NextOperationFails();
+	Schedule([SessionName, bFails](FSikMockOnlineSession& This)
+	{
+		FNamedOnlineSession* StartedSession = This.GetNamedSession(SessionName);
+		if (StartedSession)
+		{
+			StartedSession->SessionState = bFails ? EOnlineSessionState::Pending : EOnlineSessionState::InProgress;
+		}
+		
+		This.TriggerOnStartSessionCompleteDelegates(SessionName, StartedSession && !bFails);
+	});
+	
+	return true;
+}
+
+bool FSikMockOnlineSession::UpdateSession(FName SessionName, FOnlineSessionSettings& UpdatedSessionSettings, bool bShouldRefreshOnlineData)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (!Session)
+	{
+		return false;
+	}
+	
+	Session->SessionSettings = UpdatedSessionSettings;
+	
+	if (Session->SessionInfo.IsValid())
+	{
+		if (FOnlineSessionSearchResult* Lobby = FindLobby(Session->SessionInfo->GetSessionId().ToString()))
+		{
+			Lobby->Session.SessionSettings = UpdatedSessionSettings;
+		}
+	}
+	
+	Schedule([SessionName](FSikMockOnlineSession& This)
+	{
+		This.TriggerOnUpdateSessionCompleteDelegates(SessionName, This.GetNamedSession(SessionName) != nullptr);
+	});
+	
+	return true;
+}
+
+bool FSikMockOnlineSession::EndSession(FName SessionName)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (!Session || Session->SessionState != EOnlineSessionState::InProgress)
+	{
+		return false;
+	}
+	
+	Session->SessionState = EOnlineSessionState::Ending;
+	
+	Schedule([SessionName](FSikMockOnlineSession& This)
+	{
+		FNamedOnlineSession* EndedSession = This.GetNamedSession(SessionName);
+		if (EndedSession)
+		{
+			EndedSession->SessionState = EOnlineSessionState::Ended;
+		}
+		
+		This.TriggerOnEndSessionCompleteDelegates(SessionName, EndedSession != nullptr);
+	});
+	
+	return true;
+}
+
+bool FSikMockOnlineSession::DestroySession(FName SessionName, const FOnDestroySessionCompleteDelegate& CompletionDelegate)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (!Session)
+	{
+		return false;
+	}
+	
+	Session->SessionState = EOnlineSessionState::Destroying;
+	
+	Schedule([SessionName, CompletionDelegate](FSikMockOnlineSession& This)
+	{
+		const FNamedOnlineSession* DestroyedSession = This.GetNamedSession(SessionName);
+		if (!DestroyedSession)
+		{
+			CompletionDelegate.ExecuteIfBound(SessionName, false);
+			This.TriggerOnDestroySessionCompleteDelegates(SessionName, false);
+			return;
+		}
+		
+		if (DestroyedSession->SessionInfo.IsValid())
+		{
+			const FString SessionId = DestroyedSession->SessionInfo->GetSessionId().ToString();
+			
+			if (DestroyedSession->bHosting)
+			{
+				This.Lobbies.RemoveAll([&SessionId](const FOnlineSessionSearchResult& Lobby)
+				{
+					return Lobby.GetSessionIdStr() == SessionId;
+				});
+			}
+			else if (FOnlineSessionSearchResult* Lobby = This.FindLobby(SessionId))
+			{
+				Lobby->Session.NumOpenPublicConnections = FMath::Min(Lobby->Session.NumOpenPublicConnections + 1, 
+					Lobby->Session.SessionSettings.NumPublicConnections);
+			}
+		}
+		
+		This.RemoveNamedSession(SessionName);
+		
+		CompletionDelegate.ExecuteIfBound(SessionName, true);
+		This.TriggerOnDestroySessionCompleteDelegates(SessionName, true);
+	});
+	
+	return true;
+}
+
+bool FSikMockOnlineSession::JoinSession(int32 LocalUserNum, FName SessionName, const FOnlineSessionSearchResult& DesiredSession)
+{
+	return JoinSession(*LocalUserId, SessionName, DesiredSession);
+}
+
+bool FSikMockOnlineSession::JoinSession(const FUniqueNetId& InLocalUserId, FName SessionName, const FOnlineSessionSearchResult& DesiredSession)
+{
+	if (GetNamedSession(SessionName))
+	{
+		Schedule([SessionName](FSikMockOnlineSession& This)
+		{
+			This.TriggerOnJoinSessionCompleteDelegates(SessionName, EOnJoinSessionCompleteResult::AlreadyInSession);
+		});
+		return true;
+	}
+	
+	const FString SessionId = DesiredSession.GetSessionIdStr();
+	const bool bFails = NextOperationFails();
+	
+	Schedule([SessionName, SessionId, bFails](FSikMockOnlineSession& This)
+	{
+		FOnlineSessionSearchResult* Lobby = This.FindLobby(SessionId);
+		if (!Lobby)
+		{
+			This.TriggerOnJoinSessionCompleteDelegates(SessionName, EOnJoinSessionCompleteResult::SessionDoesNotExist);
+			return;
+		}
+		
+		if (Lobby->Session.NumOpenPublicConnections <= 0)
+		{
+			This.TriggerOnJoinSessionCompleteDelegates(SessionName, EOnJoinSessionCompleteResult::SessionIsFull);
+			return;
+		}
+		
+		if (bFails)
+		{
+			This.TriggerOnJoinSessionCompleteDelegates(SessionName, EOnJoinSessionCompleteResult::UnknownError);
+			return;
+		}
+		
+		--Lobby->Session.NumOpenPublicConnections;
+		
+		FNamedOnlineSession* JoinedSession = This.AddNamedSession(SessionName, Lobby->Session);
+		JoinedSession->SessionState = EOnlineSessionState::Pending;
+		JoinedSession->LocalOwnerId = This.LocalUserId;
+		JoinedSession->bHosting = false;
+		
+		This.TriggerOnJoinSessionCompleteDelegates(SessionName, EOnJoinSessionCompleteResult::Success);
+	});
+	
+	return true;
+}
+
+#pragma endregion Session Lifetime
+
+#pragma region Search
+
+bool FSikMockOnlineSession::FindSessions(int32 SearchingPlayerNum, const TSharedRef<FOnlineSessionSearch>& SearchSettings)
+{
+	return FindSessions(*LocalUserId, SearchSettings);
+}
+
+bool FSikMockOnlineSession::FindSessions(const FUniqueNetId& SearchingPlayerId, const TSharedRef<FOnlineSessionSearch>& SearchSettings)
+{
+	/** Same as Steam, a search issued while another one is pending is refused */
+	if (PendingSearch.IsValid())
+	{
+		LOG_WARNING(TEXT("Mock backend ignoring search, another one is in progress"));
+		return false;
+	}
+	
+	PendingSearch = SearchSettings;
+	SearchSettings->SearchState = EOnlineAsyncTaskState::InProgress;
+	SearchSettings->SearchResults.Reset();
+	
+	const bool bFails = NextOperationFails();
+	PendingSearchHandle = Schedule([bFails](FSikMockOnlineSession& This)
+	{
+		const TSharedPtr<FOnlineSessionSearch> Search = MoveTemp(This.PendingSearch);
+		This.PendingSearch.Reset();
+		This.PendingSearchHandle.Reset();
+		
+		if (!Search.IsValid())
+		{
+			return;
+		}
+		
+		if (bFails)
+		{
+			Search->SearchState = EOnlineAsyncTaskState::Failed;
+			This.TriggerOnFindSessionsCompleteDelegates(false);
+			return;
+		}
+		
+		const int32 MaxSearchResults = FMath::Max(1, Search->MaxSearchResults);
+		for (const FOnlineSessionSearchResult& Lobby : This.Lobbies)
+		{
+			if (Search->SearchResults.Num() >= MaxSearchResults)
+			{
+				break;
+			}
+			
+			if (MatchesSearch(Lobby, *Search))
+			{
+				Search->SearchResults.Add(Lobby);
+			}
+		}
+		
+		Search->SearchState = EOnlineAsyncTaskState::Done;
+		This.TriggerOnFindSessionsCompleteDelegates(true);
+	});
+	
+	return true;
+}
+
+bool FSikMockOnlineSession::FindSessionById(const FUniqueNetId& SearchingUserId, const FUniqueNetId& SessionId, 
+	const FUniqueNetId& FriendId, const FOnSingleSessionResultCompleteDelegate& CompletionDelegate)
+{
+	const FString SessionIdStr = SessionId.ToString();
+	const bool bFails = NextOperationFails();
+	
+	Schedule([SessionIdStr, bFails, CompletionDelegate](FSikMockOnlineSession& This)
+	{
+		const FOnlineSessionSearchResult* Lobby = bFails ? nullptr : This.FindLobby(SessionIdStr);
+		CompletionDelegate.ExecuteIfBound(0, Lobby != nullptr, Lobby ? *Lobby : FOnlineSessionSearchResult());
+	});
+	
+	return true;
+}
+
+bool FSikMockOnlineSession::CancelFindSessions()
+{
+	if (!PendingSearch.IsValid())
+	{
+		return false;
+	}
+	
+	FTSTicker::RemoveTicker(PendingSearchHandle);
+	PendingSearchHandle.Reset();
+	
+	PendingSearch->SearchState = EOnlineAsyncTaskState::Failed;
+	PendingSearch.Reset();
+	
+	Schedule([](FSikMockOnlineSession& This)
+	{
+		This.TriggerOnCancelFindSessionsCompleteDelegates(true);
+	});
+	
+	return true;
+}
+
+bool FSikMockOnlineSession::PingSearchResults(const FOnlineSessionSearchResult& SearchResult)
+{
+	return false;
+}
+
+bool FSikMockOnlineSession::GetResolvedConnectString(FName SessionName, FString& ConnectInfo, FName PortType)
+{
+	if (!GetNamedSession(SessionName))
+	{
+		return false;
+	}
+	
+	ConnectInfo = SikMockOnlineSession::ConnectAddress;
+	return true;
+}
+
+bool FSikMockOnlineSession::GetResolvedConnectString(const FOnlineSessionSearchResult& SearchResult, FName PortType, FString& ConnectInfo)
+{
+	if (!SearchResult.IsValid())
+	{
+		return false;
+	}
+	
+	ConnectInfo = SikMockOnlineSession::ConnectAddress;
+	return true;
+}
+
+#pragma endregion Search
+
+#pragma region Unsupported
+
+/** Matchmaking, friends and invites are not used by the kit, the mock refuses them like a backend without the feature */
+
+bool FSikMockOnlineSession::StartMatchmaking(const TArray<FUniqueNetIdRef>& LocalPlayers, FName SessionName, 
+	const FOnlineSessionSettings& NewSessionSettings, TSharedRef<FOnlineSessionSearch>& SearchSettings)
+{
+	return false;
+}
+
+bool FSikMockOnlineSession::CancelMatchmaking(int32 SearchingPlayerNum, FName SessionName)
+{
+	return false;
+}
+
+bool FSikMockOnlineSession::CancelMatchmaking(const FUniqueNetId& SearchingPlayerId, FName SessionName)
+{
+	return false;
+}
+
+bool FSikMockOnlineSession::FindFriendSession(int32 LocalUserNum, const FUniqueNetId& Friend)
+{
+	return false;
+}
+
+bool FSikMockOnlineSession::FindFriendSession(const FUniqueNetId& InLocalUserId, const FUniqueNetId& Friend)
+{
+	return false;
+}
+
+bool FSikMockOnlineSession::FindFriendSession(const FUniqueNetId& InLocalUserId, const TArray<FUniqueNetIdRef>& FriendList)
+{
+	return false;
+}
+
+bool FSikMockOnlineSession::SendSessionInviteToFriend(int32 LocalUserNum, FName SessionName, const FUniqueNetId& Friend)
+{
+	return false;
+}
+
+bool FSikMockOnlineSession::SendSessionInviteToFriend(const FUniqueNetId& InLocalUserId, FName SessionName, const FUniqueNetId& Friend)
+{
+	return false;
+}
+
+bool FSikMockOnlineSession::SendSessionInviteToFriends(int32 LocalUserNum, FName SessionName, const TArray<FUniqueNetIdRef>& Friends)
+{
+	return false;
+}
+
+bool FSikMockOnlineSession::SendSessionInviteToFriends(const FUniqueNetId& InLocalUserId, FName SessionName, const TArray<FUniqueNetIdRef>& Friends)
+{
+	return false;
+}
+
+#pragma endregion Unsupported
+
+#pragma region Players
+
+bool FSikMockOnlineSession::IsPlayerInSession(FName SessionName, const FUniqueNetId& UniqueId)
+{
+	const FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	return Session && Session->RegisteredPlayers.ContainsByPredicate([&UniqueId](const FUniqueNetIdRef& RegisteredPlayer)
+	{
+		return *RegisteredPlayer == UniqueId;
+	});
+}
+
+bool FSikMockOnlineSession::RegisterPlayer(FName SessionName, const FUniqueNetId& PlayerId, bool bWasInvited)
+{
+	TArray<FUniqueNetIdRef> Players;
+	Players.Add(PlayerId.AsShared());
+	return RegisterPlayers(SessionName, Players, bWasInvited);
+}
+
+bool FSikMockOnlineSession::RegisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef>& Players, bool bWasInvited)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (Session)
+	{
+		for (const FUniqueNetIdRef& Player : Players)
+		{
+			if (!Session->RegisteredPlayers.ContainsByPredicate([&Player](const FUniqueNetIdRef& RegisteredPlayer) { return *RegisteredPlayer == *Player; }))
+			{
+				Session->RegisteredPlayers.Add(Player);
+			}
+		}
+	}
+	
+	TriggerOnRegisterPlayersCompleteDelegates(SessionName, Players, Session != nullptr);
+	return Session != nullptr;
+}
+
+bool FSikMockOnlineSession::UnregisterPlayer(FName SessionName, const FUniqueNetId& PlayerId)
+{
+	TArray<FUniqueNetIdRef> Players;
+	Players.Add(PlayerId.AsShared());
+	return UnregisterPlayers(SessionName, Players);
+}
+
+bool FSikMockOnlineSession::UnregisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef>& Players)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (Session)
+	{
+		for (const FUniqueNetIdRef& Player : Players)
+		{
+			Session->RegisteredPlayers.RemoveAll([&Player](const FUniqueNetIdRef& RegisteredPlayer) { return *RegisteredPlayer == *Player; });
+		}
+	}
+	
+	TriggerOnUnregisterPlayersCompleteDelegates(SessionName, Players, Session != nullptr);
+	return Session != nullptr;
+}
+
+void FSikMockOnlineSession::RegisterLocalPlayer(const FUniqueNetId& PlayerId, FName SessionName, const FOnRegisterLocalPlayerCompleteDelegate& Delegate)
+{
+	Delegate.ExecuteIfBound(PlayerId, EOnJoinSessionCompleteResult::Success);
+}
+
+void FSikMockOnlineSession::UnregisterLocalPlayer(const FUniqueNetId& PlayerId, FName SessionName, const FOnUnregisterLocalPlayerCompleteDelegate& Delegate)
+{
+	Delegate.ExecuteIfBound(PlayerId, true);
+}
+
+void FSikMockOnlineSession::RemovePlayerFromSession(int32 LocalUserNum, FName SessionName, const FUniqueNetId& TargetPlayerId)
+{
+	UnregisterPlayer(SessionName, TargetPlayerId);
+}
+
+#pragma endregion Players
@@ -0,0 +1,33 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikPollScheduler.h"
+
+void FSikPollScheduler::Reset()
+{
+	ConsecutiveEmptyPolls = 0;
+}
+
+float FSikPollScheduler::ComputeNextDelay(bool bWasSuccessful, bool bWasEmpty, bool bHasChanged, bool bIsVisible)
+{
+	float Delay;
+
+	if (!bWasSuccessful || bWasEmpty)
+	{
+		ConsecutiveEmptyPolls = FMath::Min(ConsecutiveEmptyPolls + 1, 16);
+		Delay = FMath::Min(MinInterval * FMath::Pow(2.f, static_cast<float>(ConsecutiveEmptyPolls)), MaxBackoffInterval);
+	}
+	else
+	{
+		ConsecutiveEmptyPolls = 0;
+		Delay = bIsVisible && bHasChanged ? MinInterval : IdleInterval;
+	}
+
+	if (!bIsVisible)
+	{
+		Delay = FMath::Max(Delay, IdleInterval);
+	}
+
+	Delay *= 1.f + RandomStream.FRandRange(-JitterFraction, JitterFraction);
+
+	return FMath::Max(Delay, MinInterval);
+}
@@ -0,0 +1,112 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikSessionAsyncAction.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "System/SikLogger.h"
+
+USikSessionAsyncAction* USikSessionAsyncAction::CreateSessionAsync(UObject* WorldContextObject, 
+	const FSikCustomSessionSettings& SessionSettings, const float Timeout)
+{
+	return MakeAction(WorldContextObject, [SessionSettings, Timeout](USikSubsystem& Subsystem)
+	{
+		return Subsystem.CreateSessionAsync(SessionSettings, Timeout);
+	});
+}
+
+USikSessionAsyncAction* USikSessionAsyncAction::StartSessionAsync(UObject* WorldContextObject, const float Timeout)
+{
+	return MakeAction(WorldContextObject, [Timeout](USikSubsystem& Subsystem)
+	{
+		return Subsystem.StartSessionAsync(Timeout);
+	});
+}
+
+USikSessionAsyncAction* USikSessionAsyncAction::JoinSessionByCodeAsync(UObject* WorldContextObject, const FString& SessionCode, 
+	const float Timeout)
+{
+	return MakeAction(WorldContextObject, [SessionCode, Timeout](USikSubsystem& Subsystem)
+	{
+		const TWeakObjectPtr<USikSubsystem> WeakSubsystem(&Subsystem);
+		
+		return Subsystem.FindSessionByCodeAsync(SessionCode, Timeout)
+			.Then([WeakSubsystem, Timeout](const FSikSessionTaskResult& InResult)
+			{
+				return WeakSubsystem.IsValid() ? WeakSubsystem->JoinSessionAsync(InResult.SessionResult, Timeout) : FSikSessionTaskHandle();
+			})
+			.Then([WeakSubsystem](const FSikSessionTaskResult& InResult)
+			{
+				if (!WeakSubsystem.IsValid() || !WeakSubsystem->TravelToJoinedSession())
+				{
+					FSikSessionTaskResult TravelResult = InResult;
+					TravelResult.Result = ESikSessionOperationResult::Failed;
+					
+					const TSharedRef<FSikSessionTask> TravelTask = MakeShared<FSikSessionTask>(TEXT("TravelToJoinedSession"));
+					TravelTask->Complete(TravelResult);
+					return FSikSessionTaskHandle(TravelTask);
+				}
+				
+				return FSikSessionTaskHandle();
+			});
+	});
+}
+
+USikSessionAsyncAction* USikSessionAsyncAction::MakeAction(UObject* WorldContextObject, 
+	TFunction<FSikSessionTaskHandle(USikSubsystem&)>&& InStartOperation)
+{
+	USikSessionAsyncAction* Action = NewObject<USikSessionAsyncAction>();
+	Action->WorldContext = WorldContextObject;
+	Action->StartOperation = MoveTemp(InStartOperation);
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void USikSessionAsyncAction::Activate()
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContext.Get(), EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	USikSubsystem* SikSubsystem = GameInstance ? GameInstance->GetSubsystem<USikSubsystem>() : nullptr;
+	
+	if (!SikSubsystem || !StartOperation)
+	{
+		LOG_ERROR(TEXT("No USikSubsystem to run the session operation on"));
+		
+		FSikSessionTaskResult TaskResult;
+		TaskResult.Result = ESikSessionOperationResult::Failed;
+		OnTaskComplete(TaskResult);
+		return;
+	}
+	
+	TaskHandle = StartOperation(*SikSubsystem);
+	StartOperation.Reset();
+	
+	TaskHandle.OnComplete([WeakThis = TWeakObjectPtr<USikSessionAsyncAction>(this)](const FSikSessionTaskResult& InResult)
+	{
+		if (USikSessionAsyncAction* Action = WeakThis.Get())
+		{
+			Action->OnTaskComplete(InResult);
+		}
+	});
+}
+
+void USikSessionAsyncAction::Cancel()
+{
+	TaskHandle.Cancel();
+}
+
+void USikSessionAsyncAction::OnTaskComplete(const FSikSessionTaskResult& InResult)
+{
+	TaskHandle = FSikSessionTaskHandle();
+	
+	if (InResult.WasSuccessful())
+	{
+		OnSuccess.Broadcast(InResult.Result);
+	}
+	else
+	{
+		OnFailure.Broadcast(InResult.Result);
+	}
+	
+	SetReadyToDestroy();
+}
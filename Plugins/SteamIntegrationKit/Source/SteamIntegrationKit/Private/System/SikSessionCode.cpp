@@ -0,0 +1,193 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikSessionCode.h"
+
+#include "Misc/Guid.h"
+#include "Subsystem/SikSubsystem.h"
+
+namespace SikSessionCode
+{
+	static const TCHAR* Alphabet = TEXT("BCDFGHJKLMNPQRSTVWXZ");
+	constexpr int32 Base = 20;
+	constexpr int32 PayloadLength = SETTING_SESSION_CODELENGTH - 1;
+
+	/** 20^8, one past the largest payload eight characters can hold */
+	constexpr uint64 PayloadLimit = 25600000000ull;
+
+	/** Payloads from here upwards are random codes */
+	constexpr uint64 RandomPayloadStart = 1ull << 32;
+
+	/** Universe public, account type chat, instance flags lobby | matchmaking lobby */
+	constexpr uint64 SteamLobbyIdHighBits = 0x0186000000000000ull;
+	constexpr uint64 SteamLobbyIdHighMask = 0xFFFFFFFF00000000ull;
+
+	/** Odd multiplier and its inverse modulo 2^32, consecutive lobby ids should not give look alike codes */
+	constexpr uint32 ScrambleMultiplier = 0x9E3779B1u;
+	constexpr uint32 ScrambleMultiplierInverse = 0x0E8B2F51u;
+	constexpr uint32 ScrambleXor = 0x5A17C0DEu;
+
+	static int32 IndexOf(const TCHAR Char)
+	{
+		for (int32 Index = 0; Index < Base; Index++)
+		{
+			if (Alphabet[Index] == Char)
+			{
+				return Index;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	static uint32 Scramble(const uint32 InValue)
+	{
+		return (InValue * ScrambleMultiplier) ^ ScrambleXor;
+	}
+
+	static uint32 Unscramble(const uint32 InValue)
+	{
+		return (InValue ^ ScrambleXor) * ScrambleMultiplierInverse;
+	}
+}
+
+bool FSikSessionCode::EncodeSessionId(const FString& InSessionId, FString& OutCode)
+{
+	OutCode.Reset();
+
+	if (InSessionId.IsEmpty() || !InSessionId.IsNumeric())
+	{
+		return false;
+	}
+
+	const uint64 LobbyId = FCString::Strtoui64(*InSessionId, nullptr, 10);
+	if ((LobbyId & SikSessionCode::SteamLobbyIdHighMask) != SikSessionCode::SteamLobbyIdHighBits)
+	{
+		return false;
+	}
+
+	OutCode = BuildCode(SikSessionCode::Scramble(static_cast<uint32>(LobbyId)));
+	return true;
+}
+
+bool FSikSessionCode::DecodeSessionId(const FString& InCode, FString& OutSessionId)
+{
+	OutSessionId.Reset();
+
+	if (!IsWellFormed(InCode))
+	{
+		return false;
+	}
+
+	const uint64 Payload = ReadPayload(InCode);
+	if (Payload >= SikSessionCode::RandomPayloadStart)
+	{
+		return false;
+	}
+
+	const uint64 LobbyId = SikSessionCode::SteamLobbyIdHighBits | SikSessionCode::Unscramble(static_cast<uint32>(Payload));
+	OutSessionId = FString::Printf(TEXT("%llu"), LobbyId);
+	return true;
+}
+
+FString FSikSessionCode::GenerateRandomCode()
+{
+	const FGuid NewGuid = FGuid::NewGuid();
+	const uint64 GuidValue = ((static_cast<uint64>(NewGuid.A) << 32) | NewGuid.B) ^ ((static_cast<uint64>(NewGuid.C) << 32) | NewGuid.D);
+
+	const uint64 RandomRange = SikSessionCode::PayloadLimit - SikSessionCode::RandomPayloadStart;
+	return BuildCode(SikSessionCode::RandomPayloadStart + GuidValue % RandomRange);
+}
+
+FString FSikSessionCode::GenerateShortCode()
+{
+	const FGuid NewGuid = FGuid::NewGuid();
+	uint64 GuidValue = ((static_cast<uint64>(NewGuid.A) << 32) | NewGuid.B) ^ ((static_cast<uint64>(NewGuid.C) << 32) | NewGuid.D);
+
+	FString Code;
+	Code.Reserve(SETTING_SESSION_SHORTCODELENGTH);
+	for (int32 Index = 0; Index < SETTING_SESSION_SHORTCODELENGTH; Index++)
+	{
+		Code.AppendChar(SikSessionCode::Alphabet[GuidValue % SikSessionCode::Base]);
+		GuidValue /= SikSessionCode::Base;
+	}
+	return Code;
+}
+
+bool FSikSessionCode::IsWellFormedShortCode(const FString& InCode)
+{
+	if (InCode.Len() != SETTING_SESSION_SHORTCODELENGTH)
+	{
+		return false;
+	}
+
+	for (const TCHAR Char : InCode)
+	{
+		if (SikSessionCode::IndexOf(Char) == INDEX_NONE)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FSikSessionCode::IsWellFormed(const FString& InCode)
+{
+	if (InCode.Len() != SETTING_SESSION_CODELENGTH)
+	{
+		return false;
+	}
+
+	for (const TCHAR Char : InCode)
+	{
+		if (SikSessionCode::IndexOf(Char) == INDEX_NONE)
+		{
+			return false;
+		}
+	}
+
+	return SikSessionCode::IndexOf(InCode[SikSessionCode::PayloadLength]) == ComputeCheckIndex(InCode.Left(SikSessionCode::PayloadLength));
+}
+
+FString FSikSessionCode::BuildCode(uint64 InPayload)
+{
+	FString Code;
+	Code.Reserve(SETTING_SESSION_CODELENGTH);
+
+	/** Most significant character first so the code reads like a number */
+	TCHAR PayloadChars[SikSessionCode::PayloadLength];
+	for (int32 Index = SikSessionCode::PayloadLength - 1; Index >= 0; Index--)
+	{
+		PayloadChars[Index] = SikSessionCode::Alphabet[InPayload % SikSessionCode::Base];
+		InPayload /= SikSessionCode::Base;
+	}
+	Code.AppendChars(PayloadChars, SikSessionCode::PayloadLength);
+
+	Code.AppendChar(SikSessionCode::Alphabet[ComputeCheckIndex(Code)]);
+	return Code;
+}
+
+uint64 FSikSessionCode::ReadPayload(const FString& InCode)
+{
+	uint64 Payload = 0;
+	for (int32 Index = 0; Index < SikSessionCode::PayloadLength; Index++)
+	{
+		Payload = Payload * SikSessionCode::Base + SikSessionCode::IndexOf(InCode[Index]);
+	}
+	return Payload;
+}
+
+int32 FSikSessionCode::ComputeCheckIndex(const FString& InPayloadChars)
+{
+	/** Luhn mod N, catches every single character typo and every swap of two neighbouring characters except B and Z */
+	int32 Factor = 2;
+	int32 Sum = 0;
+	for (int32 Index = InPayloadChars.Len() - 1; Index >= 0; Index--)
+	{
+		int32 Addend = Factor * SikSessionCode::IndexOf(InPayloadChars[Index]);
+		Factor = Factor == 2 ? 1 : 2;
+		Addend = Addend / SikSessionCode::Base + Addend % SikSessionCode::Base;
+		Sum += Addend;
+	}
+
+	return (SikSessionCode::Base - Sum % SikSessionCode::Base) % SikSessionCode::Base;
+}
@@ -0,0 +1,71 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikSessionListFilter.h"
+
+#include "OnlineSessionSettings.h"
+#include "System/SikSessionMetrics.h"
+
+FSikSessionListFilter::FSikSessionListFilter(const FSikCustomSessionSettings& InFilter)
+	: Filter(FSikSessionSchema::FromReadable(InFilter))
+	, bShowAllMap(InFilter.MapName == SETTING_FILTER_ANY)
+	, bShowAllGameMode(InFilter.GameMode == SETTING_FILTER_ANY)
+	, bShowAllPlayers(InFilter.Players == SETTING_FILTER_ANY)
+{
+}
+
+bool FSikSessionListFilter::Matches(const FOnlineSessionSearchResult& InSearchResult, FSikPackedSessionSettings& OutSettings) const
+{
+	if (InSearchResult.Session.NumOpenPublicConnections <= 0)
+		return false;
+
+	int32 PackedSettings = 0;
+	if (!InSearchResult.Session.SessionSettings.Get(SETTING_SESSIONSCHEMA, PackedSettings) || 
+		!FSikPackedSessionSettings::Unpack(PackedSettings, OutSettings))
+		return false;
+
+	if (OutSettings.Visibility == ESikSessionVisibility::Private)
+		return false;
+
+	if (!bShowAllMap && OutSettings.MapId != Filter.MapId)
+		return false;
+
+	if (!bShowAllGameMode && OutSettings.GameModeId != Filter.GameModeId)
+		return false;
+
+	if (!bShowAllPlayers && OutSettings.Players != Filter.Players)
+		return false;
+
+	return true;
+}
+
+void FSikSessionListFilter::Apply(const TArray<FOnlineSessionSearchResult>& InSearchResults, const TSet<FString>& InPreviousKeys, 
+	TArray<FSikSessionListEntry>& OutEntries, TSet<FString>& OutKeys, TArray<FString>& OutRemovedKeys) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_SikSessionListFilter);
+	
+	OutEntries.Reset();
+	OutKeys.Reset();
+	OutRemovedKeys.Reset();
+
+	for (int32 ResultIndex = 0; ResultIndex < InSearchResults.Num(); ++ResultIndex)
+	{
+		const FOnlineSessionSearchResult& SearchResult = InSearchResults[ResultIndex];
+		FSikPackedSessionSettings SessionSettings;
+		if (!Matches(SearchResult, SessionSettings))
+			continue;
+
+		FSikSessionListEntry& Entry = OutEntries.AddDefaulted_GetRef();
+		Entry.Key = SearchResult.GetSessionIdStr();
+		Entry.Settings = SessionSettings;
+		Entry.SearchResult = &SearchResult;
+		Entry.ResultIndex = ResultIndex;
+
+		OutKeys.Add(Entry.Key);
+	}
+
+	for (const FString& PreviousKey : InPreviousKeys)
+	{
+		if (!OutKeys.Contains(PreviousKey))
+			OutRemovedKeys.Add(PreviousKey);
+	}
+}
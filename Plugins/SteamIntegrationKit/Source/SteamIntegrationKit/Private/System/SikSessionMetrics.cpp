@@ -0,0 +1,197 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikSessionMetrics.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Subsystem/SikSubsystem.h"
+#include "System/SikLogger.h"
+
+DEFINE_STAT(STAT_SikSessionOperationsStarted);
+DEFINE_STAT(STAT_SikSessionOperationsFailed);
+DEFINE_STAT(STAT_SikSessionSearchesStarted);
+DEFINE_STAT(STAT_SikSessionSearchResults);
+DEFINE_STAT(STAT_SikLatencyProbesInFlight);
+DEFINE_STAT(STAT_SikOpenSpans);
+DEFINE_STAT(STAT_SikMatchmakingTicketsWaiting);
+
+DEFINE_STAT(STAT_SikFindSessionsComplete);
+DEFINE_STAT(STAT_SikSessionListFilter);
+DEFINE_STAT(STAT_SikUpdateSessionsList);
+DEFINE_STAT(STAT_SikRankSessions);
+DEFINE_STAT(STAT_SikFormMatches);
+
+void FSikSessionMetrics::BeginSpan(FName InSpan)
+{
+	if (OpenSpans.Contains(InSpan))
+	{
+		CloseSpan(InSpan);
+	}
+	
+	OpenSpans.Add(InSpan, FPlatformTime::Seconds());
+	SET_DWORD_STAT(STAT_SikOpenSpans, OpenSpans.Num());
+	
+	TRACE_BEGIN_REGION(*InSpan.ToString());
+}
+
+void FSikSessionMetrics::EndSpan(FName InSpan, bool bSucceeded)
+{
+	const double* StartTime = OpenSpans.Find(InSpan);
+	if (!StartTime)
+	{
+		return;
+	}
+	
+	const float DurationInMs = static_cast<float>((FPlatformTime::Seconds() - *StartTime) * 1000.0);
+	CloseSpan(InSpan);
+	
+	FSpanHistory& SpanHistory = SpanHistories.FindOrAdd(InSpan);
+	if (!bSucceeded)
+	{
+		SpanHistory.FailedCount += 1;
+		return;
+	}
+	
+	SpanHistory.SucceededCount += 1;
+	
+	if (SpanHistory.Samples.Num() < WindowSize)
+	{
+		SpanHistory.Samples.Add(DurationInMs);
+	}
+	else
+	{
+		SpanHistory.Samples[SpanHistory.NextSample] = DurationInMs;
+	}
+	
+	SpanHistory.NextSample = (SpanHistory.NextSample + 1) % WindowSize;
+}
+
+void FSikSessionMetrics::CancelSpan(FName InSpan)
+{
+	if (OpenSpans.Contains(InSpan))
+	{
+		CloseSpan(InSpan);
+	}
+}
+
+void FSikSessionMetrics::FailOpenSpans()
+{
+	TArray<FName> OpenSpanNames;
+	OpenSpans.GetKeys(OpenSpanNames);
+	
+	for (const FName& OpenSpanName : OpenSpanNames)
+	{
+		EndSpan(OpenSpanName, false);
+	}
+}
+
+FSikLatencyPercentiles FSikSessionMetrics::GetPercentiles(FName InSpan) const
+{
+	FSikLatencyPercentiles Percentiles;
+	
+	const FSpanHistory* SpanHistory = SpanHistories.Find(InSpan);
+	if (!SpanHistory)
+	{
+		return Percentiles;
+	}
+	
+	Percentiles.SampleCount = SpanHistory->Samples.Num();
+	Percentiles.SucceededCount = SpanHistory->SucceededCount;
+	Percentiles.FailedCount = SpanHistory->FailedCount;
+	
+	if (SpanHistory->Samples.IsEmpty())
+	{
+		return Percentiles;
+	}
+	
+	/** Window is small and only sorted when queried, keeping recording cheap */
+	TArray<float> SortedSamples = SpanHistory->Samples;
+	SortedSamples.Sort();
+	
+	/** Nearest rank, always one of the recorded durations */
+	auto GetPercentile = [&SortedSamples](float InPercentile)
+	{
+		const int32 Rank = FMath::CeilToInt(InPercentile * SortedSamples.Num());
+		return SortedSamples[FMath::Clamp(Rank - 1, 0, SortedSamples.Num() - 1)];
+	};
+	
+	Percentiles.P50 = GetPercentile(0.50f);
+	Percentiles.P95 = GetPercentile(0.95f);
+	Percentiles.P99 = GetPercentile(0.99f);
+	Percentiles.Max = SortedSamples.Last();
+	
+	return Percentiles;
+}
+
+TArray<FName> FSikSessionMetrics::GetSpanNames() const
+{
+	TArray<FName> SpanNames;
+	SpanHistories.GetKeys(SpanNames);
+	SpanNames.Sort(FNameLexicalLess());
+	
+	return SpanNames;
+}
+
+void FSikSessionMetrics::Reset()
+{
+	SpanHistories.Reset();
+}
+
+void FSikSessionMetrics::SetWindowSize(int32 InWindowSize)
+{
+	WindowSize = FMath::Max(1, InWindowSize);
+	
+	/** Recorded durations are dropped rather than reordered, resizing only happens on start up */
+	SpanHistories.Reset();
+}
+
+void FSikSessionMetrics::LogSummary() const
+{
+	const TArray<FName> SpanNames = GetSpanNames();
+	if (SpanNames.IsEmpty())
+	{
+		LOG_INFO(TEXT("No session spans completed yet"));
+		return;
+	}
+	
+	for (const FName& SpanName : SpanNames)
+	{
+		const FSikLatencyPercentiles Percentiles = GetPercentiles(SpanName);
+		
+		LOG_INFO(TEXT("%-28s ok %5d | failed %5d | p50 %8.1f ms | p95 %8.1f ms | p99 %8.1f ms | max %8.1f ms"), 
+			*SpanName.ToString(), Percentiles.SucceededCount, Percentiles.FailedCount, 
+			Percentiles.P50, Percentiles.P95, Percentiles.P99, Percentiles.Max);
+	}
+}
+
+void FSikSessionMetrics::CloseSpan(FName InSpan)
+{
+	OpenSpans.Remove(InSpan);
+	SET_DWORD_STAT(STAT_SikOpenSpans, OpenSpans.Num());
+	
+	TRACE_END_REGION(*InSpan.ToString());
+}
+
+static FAutoConsoleCommandWithWorldAndArgs SikStatsCommand(
+	TEXT("Sik.Stats"),
+	TEXT("Logs the p50/p95/p99 durations of the session operations and flows. Usage: Sik.Stats [reset]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		USikSubsystem* SikSubsystem = World && World->GetGameInstance() ? World->GetGameInstance()->GetSubsystem<USikSubsystem>() : nullptr;
+		if (!SikSubsystem)
+		{
+			LOG_ERROR(TEXT("Sik.Stats needs a world with a game instance"));
+			return;
+		}
+		
+		if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+		{
+			SikSubsystem->GetSessionMetrics().Reset();
+			LOG_INFO(TEXT("Session metrics reset"));
+			return;
+		}
+		
+		SikSubsystem->GetSessionMetrics().LogSummary();
+	}));
@@ -0,0 +1,144 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikSessionSchema.h"
+
+#include "OnlineSessionSettings.h"
+#include "Subsystem/SikSubsystem.h"
+
+namespace SikSessionSchema
+{
+	constexpr int32 MapShift = 0;
+	constexpr int32 GameModeShift = 8;
+	constexpr int32 PlayersShift = 16;
+	constexpr int32 PrivateShift = 20;
+	constexpr int32 VersionShift = 24;
+
+	/** Readable names of ESikPlayersConfig, indexed by its value */
+	const TCHAR* const PlayersNames[] = { TEXT(""), TEXT("1v1"), TEXT("2v2"), TEXT("4v4") };
+
+	/** Name tables are config of USikSubsystem so host and clients of the same build agree on the ids */
+	uint8 FindId(const TArray<FString>& InNames, const FString& InName)
+	{
+		const int32 Index = InNames.IndexOfByKey(InName);
+		return (Index != INDEX_NONE && Index < MAX_uint8) ? static_cast<uint8>(Index + 1) : 0;
+	}
+
+	FString FindName(const TArray<FString>& InNames, const uint8 InId)
+	{
+		return InNames.IsValidIndex(InId - 1) ? InNames[InId - 1] : FString();
+	}
+}
+
+int32 FSikPackedSessionSettings::Pack() const
+{
+	using namespace SikSessionSchema;
+	
+	return (static_cast<int32>(MapId) << MapShift) | 
+		(static_cast<int32>(GameModeId) << GameModeShift) |
+		((static_cast<int32>(Players) & 0xF) << PlayersShift) |
+		((Visibility == ESikSessionVisibility::Private ? 1 : 0) << PrivateShift) |
+		(SchemaVersion << VersionShift);
+}
+
+bool FSikPackedSessionSettings::Unpack(const int32 InPacked, FSikPackedSessionSettings& OutSettings)
+{
+	using namespace SikSessionSchema;
+	
+	if (((InPacked >> VersionShift) & 0xF) != SchemaVersion)
+	{
+		return false;
+	}
+	
+	const int32 Players = (InPacked >> PlayersShift) & 0xF;
+	
+	OutSettings.MapId = static_cast<uint8>((InPacked >> MapShift) & 0xFF);
+	OutSettings.GameModeId = static_cast<uint8>((InPacked >> GameModeShift) & 0xFF);
+	OutSettings.Players = Players <= static_cast<int32>(ESikPlayersConfig::FourVsFour) ? 
+		static_cast<ESikPlayersConfig>(Players) : ESikPlayersConfig::Any;
+	OutSettings.Visibility = ((InPacked >> PrivateShift) & 1) ? ESikSessionVisibility::Private : ESikSessionVisibility::Public;
+	
+	return true;
+}
+
+int32 FSikPackedSessionSettings::GetNumPublicConnections() const
+{
+	switch (Players)
+	{
+	case ESikPlayersConfig::TwoVsTwo:
+		return 4;
+	case ESikPlayersConfig::FourVsFour:
+		return 8;
+	default:
+		return 2;
+	}
+}
+
+uint8 FSikSessionSchema::GetMapId(const FString& InMapName)
+{
+	return SikSessionSchema::FindId(GetDefault<USikSubsystem>()->GetSessionMapNames(), InMapName);
+}
+
+uint8 FSikSessionSchema::GetGameModeId(const FString& InGameMode)
+{
+	return SikSessionSchema::FindId(GetDefault<USikSubsystem>()->GetSessionGameModes(), InGameMode);
+}
+
+ESikPlayersConfig FSikSessionSchema::ParsePlayers(const FString& InPlayers)
+{
+	for (int32 Index = 1; Index < UE_ARRAY_COUNT(SikSessionSchema::PlayersNames); ++Index)
+	{
+		if (InPlayers == SikSessionSchema::PlayersNames[Index])
+		{
+			return static_cast<ESikPlayersConfig>(Index);
+		}
+	}
+	
+	return ESikPlayersConfig::Any;
+}
+
+FString FSikSessionSchema::GetMapName(const uint8 InMapId)
+{
+	return SikSessionSchema::FindName(GetDefault<USikSubsystem>()->GetSessionMapNames(), InMapId);
+}
+
+FString FSikSessionSchema::GetGameModeName(const uint8 InGameModeId)
+{
+	return SikSessionSchema::FindName(GetDefault<USikSubsystem>()->GetSessionGameModes(), InGameModeId);
+}
+
+FString FSikSessionSchema::GetPlayersName(const ESikPlayersConfig InPlayers)
+{
+	const int32 Index = static_cast<int32>(InPlayers);
+	return Index < UE_ARRAY_COUNT(SikSessionSchema::PlayersNames) ? FString(SikSessionSchema::PlayersNames[Index]) : FString();
+}
+
+FSikPackedSessionSettings FSikSessionSchema::FromReadable(const FSikCustomSessionSettings& InSettings)
+{
+	FSikPackedSessionSettings Settings;
+	Settings.MapId = GetMapId(InSettings.MapName);
+	Settings.GameModeId = GetGameModeId(InSettings.GameMode);
+	Settings.Players = ParsePlayers(InSettings.Players);
+	Settings.Visibility = InSettings.Visibility == FString("Private") ? ESikSessionVisibility::Private : ESikSessionVisibility::Public;
+	return Settings;
+}
+
+FSikCustomSessionSettings FSikSessionSchema::ToReadable(const FSikPackedSessionSettings& InSettings)
+{
+	FSikCustomSessionSettings Settings;
+	Settings.MapName = GetMapName(InSettings.MapId);
+	Settings.GameMode = GetGameModeName(InSettings.GameModeId);
+	Settings.Players = GetPlayersName(InSettings.Players);
+	Settings.Visibility = InSettings.Visibility == ESikSessionVisibility::Private ? FString("Private") : FString("Public");
+	return Settings;
+}
+
+void FSikSessionSchema::Advertise(const FSikPackedSessionSettings& InSettings, FOnlineSessionSettings& OutSessionSettings)
+{
+	constexpr EOnlineDataAdvertisementType::Type Advertisement = EOnlineDataAdvertisementType::ViaOnlineServiceAndPing;
+	
+	OutSessionSettings.Set(SETTING_SESSIONSCHEMA, InSettings.Pack(), Advertisement);
+	OutSessionSettings.Set(SETTING_SCHEMA_MAP, static_cast<int32>(InSettings.MapId), Advertisement);
+	OutSessionSettings.Set(SETTING_SCHEMA_GAMEMODE, static_cast<int32>(InSettings.GameModeId), Advertisement);
+	OutSessionSettings.Set(SETTING_SCHEMA_PLAYERS, static_cast<int32>(InSettings.Players), Advertisement);
+	OutSessionSettings.Set(SETTING_SCHEMA_VISIBILITY, static_cast<int32>(InSettings.Visibility), Advertisement);
+}
@@ -0,0 +1,142 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "System/SikSessionTask.h"
+#include "System/SikLogger.h"
+
+FSikSessionTask::FSikSessionTask(const FString& InDescription)
+	: Description(InDescription)
+	, Future(Promise.GetFuture().Share())
+{
+}
+
+bool FSikSessionTask::Complete(const FSikSessionTaskResult& InResult)
+{
+	if (bIsComplete)
+	{
+		return false;
+	}
+	
+	bIsComplete = true;
+	OnAbort.Reset();
+	
+	LOG_INFO(TEXT("%s : %s"), *Description, *UEnum::GetValueAsString(InResult.Result));
+	
+	Promise.SetValue(InResult);
+	
+	/** Keeps the task alive while continuations drop the last references to it */
+	const TSharedRef<FSikSessionTask> KeepAlive = AsShared();
+	const TArray<TFunction<void(const FSikSessionTaskResult&)>> CompletedContinuations = MoveTemp(Continuations);
+	Continuations.Reset();
+	
+	for (const TFunction<void(const FSikSessionTaskResult&)>& Continuation : CompletedContinuations)
+	{
+		Continuation(InResult);
+	}
+	
+	return true;
+}
+
+bool FSikSessionTask::Complete(ESikSessionOperationResult InResult)
+{
+	FSikSessionTaskResult TaskResult;
+	TaskResult.Result = InResult;
+	return Complete(TaskResult);
+}
+
+void FSikSessionTask::Abort(ESikSessionOperationResult InResult)
+{
+	if (bIsComplete)
+	{
+		return;
+	}
+	
+	const TSharedRef<FSikSessionTask> KeepAlive = AsShared();
+	
+	/** The abort may already complete the task, with a payload the plain result below would lack */
+	if (const TFunction<void(ESikSessionOperationResult)> AbortOperation = MoveTemp(OnAbort))
+	{
+		OnAbort.Reset();
+		AbortOperation(InResult);
+	}
+	
+	Complete(InResult);
+}
+
+void FSikSessionTask::AddContinuation(TFunction<void(const FSikSessionTaskResult&)>&& InContinuation)
+{
+	if (bIsComplete)
+	{
+		InContinuation(Future.Get());
+		return;
+	}
+	
+	Continuations.Add(MoveTemp(InContinuation));
+}
+
+TSharedFuture<FSikSessionTaskResult> FSikSessionTaskHandle::GetFuture() const
+{
+	return Task.IsValid() ? Task->GetFuture() : TSharedFuture<FSikSessionTaskResult>();
+}
+
+void FSikSessionTaskHandle::Cancel() const
+{
+	if (Task.IsValid())
+	{
+		Task->Abort(ESikSessionOperationResult::Cancelled);
+	}
+}
+
+const FSikSessionTaskHandle& FSikSessionTaskHandle::OnComplete(TFunction<void(const FSikSessionTaskResult&)>&& InCallback) const
+{
+	if (Task.IsValid())
+	{
+		Task->AddContinuation(MoveTemp(InCallback));
+	}
+	
+	return *this;
+}
+
+FSikSessionTaskHandle FSikSessionTaskHandle::Then(TFunction<FSikSessionTaskHandle(const FSikSessionTaskResult&)>&& InNextStep) const
+{
+	if (!Task.IsValid())
+	{
+		return FSikSessionTaskHandle();
+	}
+	
+	const TSharedRef<FSikSessionTask> ChainTask = MakeShared<FSikSessionTask>(Task->GetDescription() + TEXT(" -> Then"));
+	
+	/** Whichever step is running when the chain is cancelled or times out is the one aborted */
+	const TSharedRef<TSharedPtr<FSikSessionTask>> RunningStep = MakeShared<TSharedPtr<FSikSessionTask>>(Task);
+	ChainTask->OnAbort = [RunningStep](ESikSessionOperationResult InResult)
+	{
+		if (const TSharedPtr<FSikSessionTask> Step = *RunningStep)
+		{
+			Step->Abort(InResult);
+		}
+	};
+	
+	/** Steps hold the chain, it lives on while a step runs even if the caller drops the returned handle */
+	Task->AddContinuation([ChainTask, RunningStep, NextStep = MoveTemp(InNextStep)](const FSikSessionTaskResult& InResult)
+	{
+		if (ChainTask->IsComplete())
+		{
+			return;
+		}
+		
+		const FSikSessionTaskHandle NextHandle = InResult.WasSuccessful() ? NextStep(InResult) : FSikSessionTaskHandle();
+		if (!NextHandle.IsValid())
+		{
+			RunningStep->Reset();
+			ChainTask->Complete(InResult);
+			return;
+		}
+		
+		*RunningStep = NextHandle.Task;
+		NextHandle.Task->AddContinuation([ChainTask](const FSikSessionTaskResult& InNextResult)
+		{
+			ChainTask->Complete(InNextResult);
+		});
+	});
+	
+	return FSikSessionTaskHandle(ChainTask);
+}
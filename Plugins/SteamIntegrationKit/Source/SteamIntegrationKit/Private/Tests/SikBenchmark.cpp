@@ -0,0 +1,481 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "Tests/SikBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/PlatformTime.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/FileHelper.h"
+#include "Misc/App.h"
+#include "Misc/Paths.h"
+#include "Components/TextBlock.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Subsystem/SikSubsystem.h"
+#include "System/SikLogger.h"
+#include "System/SikMatchmaker.h"
+#include "System/SikMockOnlineSession.h"
+#include "System/SikSessionCode.h"
+#include "System/SikSessionListFilter.h"
+#include "System/SikSessionSnapshot.h"
+
+/**
+ * Micro benchmarks of the session browser hot path, run the SteamIntegrationKit.Benchmark automation test
+ * 
+ * Lobbies are synthesized by the mock backend, so the numbers do not depend on Steam or the network
+ * Every case reports ns/op, and with -SikBenchmark on the command line allocations/op, bytes/op and the peak bytes
+ * it held, counted on the thread running it. Results are written as JSON to Saved/Benchmarks so they can be compared
+ * between builds, -SikBenchmarkSeconds= sets how long each case runs
+ ******************************************************************************************/
+namespace SikBenchmark
+{
+	/** Lobby counts the session list cases run with */
+	static constexpr int32 LobbyCounts[] = { 10, 1000, 10000 };
+
+	/** Seconds each case runs for when no duration is given */
+	static constexpr double DefaultMinSeconds = 0.2;
+
+	/** Allocations made by one thread while it measures a case */
+	struct FAllocationCounts
+	{
+		uint64 NumAllocations = 0;
+		uint64 NumBytes = 0;
+		int64 LiveBytes = 0;
+		int64 PeakLiveBytes = 0;
+	};
+
+	/** Counts of the case measured on this thread, null while none is, so other threads never touch them */
+	static thread_local FAllocationCounts* ThreadAllocationCounts = nullptr;
+
+	/**
+	 * Allocator forwarding to the one it wraps and counting the allocations of the threads measuring a case
+	 * Live bytes are the allocation sizes the wrapped allocator reports, blocks freed that were allocated before the case lower them
+	 ******************************************************************************************/
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInnerMalloc) : InnerMalloc(InInnerMalloc) {}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			void* Result = InnerMalloc->Malloc(Count, Alignment);
+			RecordAllocation(Result, Count);
+			return Result;
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			void* Result = InnerMalloc->TryMalloc(Count, Alignment);
+			RecordAllocation(Result, Count);
+			return Result;
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			RecordFree(Original);
+			void* Result = InnerMalloc->Realloc(Original, Count, Alignment);
+			RecordAllocation(Result, Count);
+			return Result;
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			RecordFree(Original);
+			void* Result = InnerMalloc->TryRealloc(Original, Count, Alignment);
+			RecordAllocation(Result, Count);
+			return Result;
+		}
+
+		virtual void Free(void* Original) override
+		{
+			RecordFree(Original);
+			InnerMalloc->Free(Original);
+		}
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+		virtual const TCHAR* GetDescriptiveName() override { return TEXT("SikCountingMalloc"); }
+
+	private:
+		/** @returns the size the wrapped allocator holds for the block, the requested one if it does not track sizes */
+		SIZE_T GetBlockSize(void* InBlock, SIZE_T InRequestedSize) const
+		{
+			SIZE_T BlockSize = InRequestedSize;
+			InnerMalloc->GetAllocationSize(InBlock, BlockSize);
+			return BlockSize;
+		}
+
+		void RecordAllocation(void* InBlock, SIZE_T InCount)
+		{
+			FAllocationCounts* Counts = ThreadAllocationCounts;
+			if (!Counts || !InBlock)
+			{
+				return;
+			}
+
+			++Counts->NumAllocations;
+			Counts->NumBytes += InCount;
+			Counts->LiveBytes += GetBlockSize(InBlock, InCount);
+			Counts->PeakLiveBytes = FMath::Max(Counts->PeakLiveBytes, Counts->LiveBytes);
+		}
+
+		void RecordFree(void* InBlock)
+		{
+			FAllocationCounts* Counts = ThreadAllocationCounts;
+			if (!Counts || !InBlock)
+			{
+				return;
+			}
+
+			Counts->LiveBytes -= GetBlockSize(InBlock, 0);
+		}
+
+		FMalloc* InnerMalloc;
+	};
+
+	/** Set once the counting allocator wraps GMalloc */
+	static bool bAllocationCounterInstalled = false;
+
+	void InstallAllocationCounter()
+	{
+		if (bAllocationCounterInstalled || !GMalloc)
+		{
+			return;
+		}
+
+		/** Never freed, blocks allocated through it may be freed at any point until exit */
+		FMalloc* CountingMalloc = new FCountingMalloc(GMalloc);
+		FPlatformMisc::MemoryBarrier();
+		GMalloc = CountingMalloc;
+		bAllocationCounterInstalled = true;
+
+		LOG_WARNING(TEXT("Counting the allocations of the benchmarks, allocations are forwarded through SikCountingMalloc"));
+	}
+
+	/** Result of a single case, the allocation fields are negative if the counting allocator is not installed */
+	struct FResult
+	{
+		FString Name;
+		int32 NumItems = 0;
+		int64 NumIterations = 0;
+		double NsPerOp = 0.0;
+		double AllocsPerOp = -1.0;
+		double BytesPerOp = -1.0;
+		int64 PeakBytes = -1;
+	};
+
+	/** Runs the body until it took at least the given seconds, then measures the same number of iterations again counting allocations */
+	template <typename BodyType>
+	FResult RunCase(const FString& InName, int32 InNumItems, double InMinSeconds, BodyType&& InBody)
+	{
+		/** Warm up, fills caches and grows the containers the body reuses */
+		InBody();
+
+		int64 NumIterations = 1;
+		for (;;)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			for (int64 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				InBody();
+			}
+
+			if (FPlatformTime::Seconds() - StartTime >= InMinSeconds || NumIterations >= (int64(1) << 30))
+			{
+				break;
+			}
+
+			NumIterations *= 2;
+		}
+
+		FAllocationCounts AllocationCounts;
+		ThreadAllocationCounts = &AllocationCounts;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int64 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			InBody();
+		}
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+		ThreadAllocationCounts = nullptr;
+
+		FResult Result;
+		Result.Name = InName;
+		Result.NumItems = InNumItems;
+		Result.NumIterations = NumIterations;
+		Result.NsPerOp = ElapsedTime * 1e9 / NumIterations;
+		if (bAllocationCounterInstalled)
+		{
+			Result.AllocsPerOp = double(AllocationCounts.NumAllocations) / NumIterations;
+			Result.BytesPerOp = double(AllocationCounts.NumBytes) / NumIterations;
+			Result.PeakBytes = AllocationCounts.PeakLiveBytes;
+		}
+
+		LOG_INFO(TEXT("%-32s items %6d | %12.1f ns/op | %8.1f allocs/op | %10.1f bytes/op | %10lld peak bytes"), 
+			*Result.Name, Result.NumItems, Result.NsPerOp, Result.AllocsPerOp, Result.BytesPerOp, Result.PeakBytes);
+		
+		return Result;
+	}
+
+	/** @returns the mock backend settings the lobbies are synthesized with, fixed so runs are comparable */
+	FSikMockBackendSettings MakeMockSettings(int32 InLobbyCount)
+	{
+		FSikMockBackendSettings Settings;
+		Settings.Seed = 1;
+		Settings.LobbyCount = InLobbyCount;
+		/** Names of the default session schema tables, so lobbies pack to known ids */
+		Settings.MapNames = { FString("Erangel"), FString("Miramar"), FString("Nuketown") };
+		Settings.GameModes = { FString("Deathmatch"), FString("Domination") };
+		Settings.Players = { FString("1v1"), FString("2v2"), FString("4v4") };
+		return Settings;
+	}
+
+	/** Filter and diff of a refreshed session list against the previous one, with the given filter */
+	void RunSessionListCases(const FString& InFilterName, const FSikCustomSessionSettings& InFilter, double InMinSeconds, TArray<FResult>& OutResults)
+	{
+		const FSikSessionListFilter SessionListFilter(InFilter);
+		
+		for (const int32 LobbyCount : LobbyCounts)
+		{
+			const TSharedRef<FSikMockOnlineSession, ESPMode::ThreadSafe> MockSession = 
+				MakeShared<FSikMockOnlineSession, ESPMode::ThreadSafe>(MakeMockSettings(LobbyCount));
+			const TArray<FOnlineSessionSearchResult>& SearchResults = MockSession->GetLobbies();
+
+			/** Steady state of the browser, the previous refresh listed the same sessions */
+			TArray<FSikSessionListEntry> Entries;
+			TSet<FString> PreviousKeys;
+			TArray<FString> RemovedKeys;
+			SessionListFilter.Apply(SearchResults, TSet<FString>(), Entries, PreviousKeys, RemovedKeys);
+
+			TSet<FString> Keys;
+			OutResults.Add(RunCase(FString::Printf(TEXT("SessionList/FilterAndDiff/%s"), *InFilterName), LobbyCount, InMinSeconds, 
+				[&]()
+				{
+					SessionListFilter.Apply(SearchResults, PreviousKeys, Entries, Keys, RemovedKeys);
+				}));
+		}
+	}
+
+	/**
+	 * Refresh of the listed session widgets once the list is filtered, what USikHudWidget::UpdateSessionsList does per entry
+	 * Texts are set on text blocks outside any widget tree the way USikSessionDataWidget::SetSessionInfo sets them,
+	 * the layout and paint of the next Slate frame are not included
+	 */
+	void RunWidgetUpdateCases(double InMinSeconds, TArray<FResult>& OutResults)
+	{
+		const FSikSessionListFilter SessionListFilter((FSikCustomSessionSettings()));
+		
+		for (const int32 LobbyCount : LobbyCounts)
+		{
+			const TSharedRef<FSikMockOnlineSession, ESPMode::ThreadSafe> MockSession = 
+				MakeShared<FSikMockOnlineSession, ESPMode::ThreadSafe>(MakeMockSettings(LobbyCount));
+			TArray<FOnlineSessionSearchResult> SearchResults = MockSession->GetLobbies();
+			const FSikSessionSearchSnapshotRef Snapshot = MakeShared<FSikSessionSearchSnapshot>(1, MoveTemp(SearchResults));
+
+			TArray<FSikSessionListEntry> Entries;
+			TSet<FString> Keys;
+			TArray<FString> RemovedKeys;
+			SessionListFilter.Apply(Snapshot->GetResults(), TSet<FString>(), Entries, Keys, RemovedKeys);
+
+			/** Map, players and game mode text of every listed session */
+			TArray<TStrongObjectPtr<UTextBlock>> TextBlocks;
+			TextBlocks.Reserve(Entries.Num() * 3);
+			for (int32 Index = 0; Index < Entries.Num() * 3; ++Index)
+			{
+				TextBlocks.Emplace(NewObject<UTextBlock>(GetTransientPackage()));
+			}
+			TArray<FSikSessionHandle> Handles;
+			Handles.SetNum(Entries.Num());
+
+			OutResults.Add(RunCase(FString("SessionList/UpdateWidgets"), LobbyCount, InMinSeconds, 
+				[&]()
+				{
+					for (int32 Index = 0; Index < Entries.Num(); ++Index)
+					{
+						const FSikCustomSessionSettings Settings = FSikSessionSchema::ToReadable(Entries[Index].Settings);
+						Handles[Index] = Snapshot->GetHandle(Entries[Index].ResultIndex);
+						TextBlocks[Index * 3]->SetText(FText::FromString(Settings.MapName));
+						TextBlocks[Index * 3 + 1]->SetText(FText::FromString(Settings.Players));
+						TextBlocks[Index * 3 + 2]->SetText(FText::FromString(Settings.GameMode));
+					}
+				}));
+		}
+	}
+
+	/** Session code generation and the decode and lookup steps of joining by code */
+	void RunSessionCodeCases(double InMinSeconds, TArray<FResult>& OutResults)
+	{
+		OutResults.Add(RunCase(FString("SessionCode/Generate"), 1, InMinSeconds, 
+			[]()
+			{
+				FString Code = FSikSessionCode::GenerateRandomCode();
+				check(!Code.IsEmpty());
+			}));
+
+		/** Code of a mock lobby, it decodes to the lobby id */
+		FString SessionCodeToDecode;
+		MakeShared<FSikMockOnlineSession, ESPMode::ThreadSafe>(MakeMockSettings(LobbyCounts[0]))->GetLobbies()[0]
+			.Session.SessionSettings.Get(SETTING_SESSIONKEY, SessionCodeToDecode);
+
+		OutResults.Add(RunCase(FString("SessionCode/Decode"), 1, InMinSeconds, 
+			[&]()
+			{
+				FString DecodedSessionId;
+				FSikSessionCode::DecodeSessionId(SessionCodeToDecode, DecodedSessionId);
+			}));
+
+		for (const int32 LobbyCount : LobbyCounts)
+		{
+			const TSharedRef<FSikMockOnlineSession, ESPMode::ThreadSafe> MockSession = 
+				MakeShared<FSikMockOnlineSession, ESPMode::ThreadSafe>(MakeMockSettings(LobbyCount));
+			TArray<FOnlineSessionSearchResult> SearchResults = MockSession->GetLobbies();
+
+			/** Worst case for a scan, the code of the last lobby */
+			FString SessionCodeToFind;
+			SearchResults.Last().Session.SessionSettings.Get(SETTING_SESSIONKEY, SessionCodeToFind);
+
+			/** Same snapshot the subsystem caches, USikSubsystem::FindCachedSessionByCode looks codes up in it */
+			const FSikSessionSearchSnapshotRef Snapshot = MakeShared<FSikSessionSearchSnapshot>(1, MoveTemp(SearchResults));
+
+			OutResults.Add(RunCase(FString("SessionCode/CachedLookup"), LobbyCount, InMinSeconds, 
+				[&]()
+				{
+					const FSikSessionHandle FoundSession = Snapshot->FindBySessionKey(SessionCodeToFind);
+					check(FoundSession.IsValid());
+				}));
+		}
+	}
+
+	/** One round of the matchmaker grouping a full queue, tickets spread over a few regions and the whole skill range */
+	void RunMatchmakerCases(double InMinSeconds, TArray<FResult>& OutResults)
+	{
+		for (const int32 TicketCount : LobbyCounts)
+		{
+			FRandomStream RandomStream(1);
+			
+			TArray<FSikMatchmakingTicket> Tickets;
+			Tickets.Reserve(TicketCount);
+			for (int32 Index = 0; Index < TicketCount; ++Index)
+			{
+				FSikMatchmakingTicket& Ticket = Tickets.AddDefaulted_GetRef();
+				Ticket.TicketId = FGuid(1, 0, 0, Index);
+				Ticket.Region = FString::Printf(TEXT("Region%d"), RandomStream.RandRange(0, 3));
+				Ticket.Skill = RandomStream.RandRange(0, 3000);
+				Ticket.Preferences.MapId = static_cast<uint8>(RandomStream.RandRange(0, 3));
+				Ticket.Preferences.Players = static_cast<ESikPlayersConfig>(RandomStream.RandRange(0, 3));
+			}
+			
+			OutResults.Add(RunCase(FString("Matchmaker/EnqueueAndFormMatches"), TicketCount, InMinSeconds, 
+				[&]()
+				{
+					FSikMatchmaker Matchmaker{FSikMatchmakerSettings()};
+					for (const FSikMatchmakingTicket& Ticket : Tickets)
+					{
+						Matchmaker.Enqueue(Ticket, 0.0);
+					}
+					Matchmaker.FormMatches(0.0);
+				}));
+		}
+	}
+
+	/** Writes the results as JSON and returns the path of the file */
+	FString WriteResults(const TArray<FResult>& InResults, double InMinSeconds)
+	{
+		TArray<TSharedPtr<FJsonValue>> JsonCases;
+		for (const FResult& Result : InResults)
+		{
+			const TSharedRef<FJsonObject> JsonCase = MakeShared<FJsonObject>();
+			JsonCase->SetStringField(TEXT("name"), Result.Name);
+			JsonCase->SetNumberField(TEXT("items"), Result.NumItems);
+			JsonCase->SetNumberField(TEXT("iterations"), static_cast<double>(Result.NumIterations));
+			JsonCase->SetNumberField(TEXT("ns_per_op"), Result.NsPerOp);
+			JsonCase->SetNumberField(TEXT("allocs_per_op"), Result.AllocsPerOp);
+			JsonCase->SetNumberField(TEXT("bytes_per_op"), Result.BytesPerOp);
+			JsonCase->SetNumberField(TEXT("peak_bytes"), static_cast<double>(Result.PeakBytes));
+			JsonCases.Add(MakeShared<FJsonValueObject>(JsonCase));
+		}
+
+		const TSharedRef<FJsonObject> JsonRoot = MakeShared<FJsonObject>();
+		JsonRoot->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+		JsonRoot->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+		JsonRoot->SetStringField(TEXT("build"), LexToString(FApp::GetBuildConfiguration()));
+		JsonRoot->SetNumberField(TEXT("min_seconds_per_case"), InMinSeconds);
+		JsonRoot->SetArrayField(TEXT("cases"), JsonCases);
+
+		FString Output;
+		const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&Output);
+		FJsonSerializer::Serialize(JsonRoot, JsonWriter);
+
+		const FString FilePath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / 
+			FString::Printf(TEXT("SikBenchmark-%s.json"), *FDateTime::Now().ToString());
+		
+		if (!FFileHelper::SaveStringToFile(Output, *FilePath))
+		{
+			LOG_ERROR(TEXT("Failed to write benchmark results to %s"), *FilePath);
+			return FString();
+		}
+
+		return FilePath;
+	}
+
+	/** Runs every case and writes the results, @returns the path of the file, empty if it could not be written */
+	FString Run(double InMinSeconds)
+	{
+		LOG_INFO(TEXT("Running session browser benchmarks, %.2f seconds per case"), InMinSeconds);
+
+		TArray<FResult> Results;
+
+		FSikCustomSessionSettings ShowAllFilter;
+		RunSessionListCases(FString("Any"), ShowAllFilter, InMinSeconds, Results);
+
+		FSikCustomSessionSettings MapFilter;
+		MapFilter.MapName = FString("Miramar");
+		RunSessionListCases(FString("Map"), MapFilter, InMinSeconds, Results);
+
+		RunWidgetUpdateCases(InMinSeconds, Results);
+
+		RunSessionCodeCases(InMinSeconds, Results);
+
+		RunMatchmakerCases(InMinSeconds, Results);
+
+		return WriteResults(Results, InMinSeconds);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikSessionBrowserBenchmark, "SteamIntegrationKit.Benchmark.SessionBrowser", 
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSikSessionBrowserBenchmark::RunTest(const FString& Parameters)
+{
+	double MinSeconds = SikBenchmark::DefaultMinSeconds;
+	FParse::Value(FCommandLine::Get(), TEXT("SikBenchmarkSeconds="), MinSeconds);
+	MinSeconds = FMath::Max(MinSeconds, 0.01);
+
+	if (!SikBenchmark::bAllocationCounterInstalled)
+	{
+		AddInfo(TEXT("Allocations are not counted, run with -SikBenchmark to count them"));
+	}
+
+	const FString FilePath = SikBenchmark::Run(MinSeconds);
+	if (FilePath.IsEmpty())
+	{
+		AddError(TEXT("Failed to write the benchmark results"));
+		return false;
+	}
+
+	AddInfo(FString::Printf(TEXT("Benchmark results written to %s"), *FilePath));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,18 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SikBenchmark
+{
+	/**
+	 * Wraps GMalloc in the allocator the benchmarks count their allocations with, called at module startup with -SikBenchmark
+	 * Installed once and never removed, it forwards every call so blocks from before and after go to the same allocator
+	 */
+	void InstallAllocationCounter();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,133 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "System/SikMatchmaker.h"
+
+/**
+ * Request datagrams as built by FSikUdpMatchmakerConnection, handled by a FSikMatchmakerServer that is never started
+ ******************************************************************************************/
+namespace SikMatchmakerTests
+{
+	/** Magic, version and message type */
+	constexpr int32 HeaderSize = 6;
+
+	/** Sends the request and reads the answer, @returns false if the request was dropped or not answered */
+	static bool Request(FSikMatchmakerServer& InServer, const TArray<uint8>& InRequest, double InNow, FSikMatchmakingStatus& OutStatus)
+	{
+		TArray<uint8> Reply;
+		return InServer.HandleRequest(InRequest, InNow, Reply) && FSikUdpMatchmakerConnection::ReadStatus(Reply, OutStatus);
+	}
+
+	static FSikMatchmakingTicket MakeTicket()
+	{
+		FSikMatchmakingTicket Ticket;
+		Ticket.TicketId = FGuid::NewGuid();
+		Ticket.Region = TEXT("eu");
+		Ticket.Skill = 1200;
+		Ticket.Preferences.Players = ESikPlayersConfig::Any;
+		return Ticket;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikMatchmakerRequestTest, "SteamIntegrationKit.Matchmaker.Requests",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikMatchmakerRequestTest::RunTest(const FString& Parameters)
+{
+	FSikMatchmakerServer Server{FSikMatchmakerSettings()};
+	const FSikMatchmakingTicket Ticket = SikMatchmakerTests::MakeTicket();
+
+	FSikMatchmakingStatus Status;
+	if (TestTrue(TEXT("Enqueue is answered"), SikMatchmakerTests::Request(Server, FSikUdpMatchmakerConnection::MakeEnqueueRequest(Ticket), 0.0, Status)))
+	{
+		TestEqual(TEXT("Enqueue answers the ticket"), Status.TicketId, Ticket.TicketId);
+		TestTrue(TEXT("Enqueued ticket waits"), Status.State == ESikMatchmakingTicketState::Waiting);
+	}
+	TestEqual(TEXT("Enqueued ticket is queued"), Server.GetMatchmaker()->GetNumWaitingTickets(), 1);
+
+	if (TestTrue(TEXT("Poll is answered"), SikMatchmakerTests::Request(Server, FSikUdpMatchmakerConnection::MakePollRequest(Ticket.TicketId), 1.0, Status)))
+	{
+		TestTrue(TEXT("Polled ticket waits"), Status.State == ESikMatchmakingTicketState::Waiting);
+	}
+
+	const FGuid UnknownTicketId = FGuid::NewGuid();
+	if (TestTrue(TEXT("Poll of an unknown ticket is answered"), SikMatchmakerTests::Request(Server, FSikUdpMatchmakerConnection::MakePollRequest(UnknownTicketId), 1.0, Status)))
+	{
+		TestEqual(TEXT("Poll answers the unknown ticket"), Status.TicketId, UnknownTicketId);
+		TestTrue(TEXT("Unknown ticket is unknown"), Status.State == ESikMatchmakingTicketState::Unknown);
+	}
+
+	if (TestTrue(TEXT("Report of a waiting ticket is answered"), SikMatchmakerTests::Request(Server, FSikUdpMatchmakerConnection::MakeReportHostedRequest(Ticket.TicketId, TEXT("BCDFGHJKL")), 1.0, Status)))
+	{
+		TestTrue(TEXT("Report of a waiting ticket is ignored"), Status.State == ESikMatchmakingTicketState::Waiting);
+	}
+
+	TArray<uint8> Reply;
+	TestTrue(TEXT("Cancel is accepted"), Server.HandleRequest(FSikUdpMatchmakerConnection::MakeCancelRequest(Ticket.TicketId), 2.0, Reply));
+	TestEqual(TEXT("Cancel is not answered"), Reply.Num(), 0);
+	TestEqual(TEXT("Cancelled ticket is dropped"), Server.GetMatchmaker()->GetNumWaitingTickets(), 0);
+
+	if (TestTrue(TEXT("Poll of a cancelled ticket is answered"), SikMatchmakerTests::Request(Server, FSikUdpMatchmakerConnection::MakePollRequest(Ticket.TicketId), 2.0, Status)))
+	{
+		TestTrue(TEXT("Cancelled ticket is unknown"), Status.State == ESikMatchmakingTicketState::Unknown);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikMatchmakerMalformedRequestTest, "SteamIntegrationKit.Matchmaker.MalformedRequests",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikMatchmakerMalformedRequestTest::RunTest(const FString& Parameters)
+{
+	FSikMatchmakerServer Server{FSikMatchmakerSettings()};
+	const FSikMatchmakingTicket Ticket = SikMatchmakerTests::MakeTicket();
+	const TArray<uint8> EnqueueRequest = FSikUdpMatchmakerConnection::MakeEnqueueRequest(Ticket);
+
+	TArray<uint8> Reply;
+	TestFalse(TEXT("Empty datagram is dropped"), Server.HandleRequest(TArray<uint8>(), 0.0, Reply));
+
+	TArray<uint8> BadMagic = EnqueueRequest;
+	BadMagic[0] ^= 0xFF;
+	TestFalse(TEXT("Datagram with another magic is dropped"), Server.HandleRequest(BadMagic, 0.0, Reply));
+
+	TArray<uint8> BadVersion = EnqueueRequest;
+	BadVersion[4] += 1;
+	TestFalse(TEXT("Datagram of another protocol version is dropped"), Server.HandleRequest(BadVersion, 0.0, Reply));
+
+	TArray<uint8> BadType = EnqueueRequest;
+	BadType[5] = 0xFF;
+	TestFalse(TEXT("Datagram of an unknown message type is dropped"), Server.HandleRequest(BadType, 0.0, Reply));
+
+	TArray<uint8> StatusAsRequest = FSikUdpMatchmakerConnection::MakePollRequest(Ticket.TicketId);
+	StatusAsRequest[5] = 4;
+	TestFalse(TEXT("Status sent to the server is dropped"), Server.HandleRequest(StatusAsRequest, 0.0, Reply));
+
+	for (int32 Size = 0; Size < EnqueueRequest.Num(); Size++)
+	{
+		if (Server.HandleRequest(MakeArrayView(EnqueueRequest.GetData(), Size), 0.0, Reply))
+		{
+			AddError(FString::Printf(TEXT("Enqueue truncated to %d of %d bytes was accepted"), Size, EnqueueRequest.Num()));
+			break;
+		}
+	}
+
+	/** Length prefix of the session code, right after the header and the ticket id */
+	TArray<uint8> OversizedCode = FSikUdpMatchmakerConnection::MakeReportHostedRequest(Ticket.TicketId, TEXT("BCDFGHJKL"));
+	OversizedCode[SikMatchmakerTests::HeaderSize + sizeof(FGuid)] = 65;
+	OversizedCode.AddZeroed(65);
+	TestFalse(TEXT("Report with a code longer than allowed is dropped"), Server.HandleRequest(OversizedCode, 0.0, Reply));
+
+	TestEqual(TEXT("Malformed requests enqueue nothing"), Server.GetMatchmaker()->GetNumWaitingTickets(), 0);
+
+	TestTrue(TEXT("Well formed enqueue is accepted"), Server.HandleRequest(EnqueueRequest, 0.0, Reply));
+	TestEqual(TEXT("Well formed enqueue is queued"), Server.GetMatchmaker()->GetNumWaitingTickets(), 1);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
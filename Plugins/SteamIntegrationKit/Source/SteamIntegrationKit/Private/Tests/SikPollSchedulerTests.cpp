@@ -0,0 +1,97 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "System/SikPollScheduler.h"
+
+namespace SikPollSchedulerTests
+{
+	/** Scheduler with the default intervals and no jitter, so every delay is exact */
+	static FSikPollScheduler MakeScheduler()
+	{
+		FSikPollScheduler Scheduler;
+		Scheduler.MinInterval = 2.f;
+		Scheduler.IdleInterval = 8.f;
+		Scheduler.MaxBackoffInterval = 60.f;
+		Scheduler.JitterFraction = 0.f;
+		return Scheduler;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikPollSchedulerIntervalsTest, "SteamIntegrationKit.PollScheduler.Intervals",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikPollSchedulerIntervalsTest::RunTest(const FString& Parameters)
+{
+	FSikPollScheduler Scheduler = SikPollSchedulerTests::MakeScheduler();
+
+	TestEqual(TEXT("Visible changing list polls at the min interval"), Scheduler.ComputeNextDelay(true, false, true, true), 2.f);
+	TestEqual(TEXT("Visible stable list polls at the idle interval"), Scheduler.ComputeNextDelay(true, false, false, true), 8.f);
+	TestEqual(TEXT("Hidden changing list polls at the idle interval"), Scheduler.ComputeNextDelay(true, false, true, false), 8.f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikPollSchedulerBackoffTest, "SteamIntegrationKit.PollScheduler.Backoff",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikPollSchedulerBackoffTest::RunTest(const FString& Parameters)
+{
+	FSikPollScheduler Scheduler = SikPollSchedulerTests::MakeScheduler();
+
+	/** Doubles from the min interval with every empty or failed poll in a row, up to the cap */
+	const float ExpectedDelays[] = { 4.f, 8.f, 16.f, 32.f, 60.f, 60.f };
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(ExpectedDelays); Index++)
+	{
+		const bool bWasSuccessful = Index % 2 == 0;
+		TestEqual(FString::Printf(TEXT("Empty or failed poll %d backs off"), Index + 1), 
+			Scheduler.ComputeNextDelay(bWasSuccessful, true, false, true), ExpectedDelays[Index]);
+	}
+
+	TestEqual(TEXT("Poll with results ends the backoff"), Scheduler.ComputeNextDelay(true, false, true, true), 2.f);
+	TestEqual(TEXT("Backoff starts over after results"), Scheduler.ComputeNextDelay(true, true, false, true), 4.f);
+
+	Scheduler.ComputeNextDelay(false, true, false, true);
+	Scheduler.Reset();
+	TestEqual(TEXT("Reset clears the backoff"), Scheduler.ComputeNextDelay(false, true, false, true), 4.f);
+
+	/** Hidden lists never poll faster than the idle interval, even right after a reset */
+	Scheduler.Reset();
+	TestEqual(TEXT("Hidden list backs off no faster than idle"), Scheduler.ComputeNextDelay(false, true, false, false), 8.f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikPollSchedulerJitterTest, "SteamIntegrationKit.PollScheduler.Jitter",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikPollSchedulerJitterTest::RunTest(const FString& Parameters)
+{
+	FSikPollScheduler Scheduler = SikPollSchedulerTests::MakeScheduler();
+	Scheduler.JitterFraction = 0.2f;
+
+	int32 NumOutOfRange = 0;
+	int32 NumBelowMin = 0;
+	TSet<float> Delays;
+
+	for (int32 Index = 0; Index < 1000; Index++)
+	{
+		const float IdleDelay = Scheduler.ComputeNextDelay(true, false, false, true);
+		NumOutOfRange += IdleDelay < 8.f * 0.8f - KINDA_SMALL_NUMBER || IdleDelay > 8.f * 1.2f + KINDA_SMALL_NUMBER ? 1 : 0;
+		Delays.Add(IdleDelay);
+
+		/** Jitter below the min interval is clamped, the min interval is a floor */
+		NumBelowMin += Scheduler.ComputeNextDelay(true, false, true, true) < 2.f ? 1 : 0;
+	}
+
+	TestEqual(TEXT("Jittered delays stay within the jitter fraction"), NumOutOfRange, 0);
+	TestEqual(TEXT("No delay is below the min interval"), NumBelowMin, 0);
+	TestTrue(TEXT("Delays are spread out"), Delays.Num() > 1);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
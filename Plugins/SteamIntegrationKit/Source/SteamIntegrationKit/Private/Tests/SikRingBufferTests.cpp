@@ -0,0 +1,191 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Algo/AllOf.h"
+#include "Async/Async.h"
+#include "Misc/AutomationTest.h"
+#include "System/SikRingBuffer.h"
+
+namespace SikRingBufferTests
+{
+	/** Threads pushing at once in the multiple producers test */
+	constexpr int32 NumProducers = 4;
+
+	/** Elements each producer pushes, many times the capacity so the positions wrap around while contended */
+	constexpr int32 PushesPerProducer = 20000;
+
+	/** Packs the producer and its running count into one element, so every pushed element can be told apart */
+	static uint32 MakeElement(const int32 Producer, const int32 Count)
+	{
+		return static_cast<uint32>(Producer) << 24 | static_cast<uint32>(Count);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikRingBufferWraparoundTest, "SteamIntegrationKit.RingBuffer.Wraparound",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikRingBufferWraparoundTest::RunTest(const FString& Parameters)
+{
+	TSikMpscRingBuffer<int32> Queue(3);
+	TestEqual(TEXT("Capacity is rounded up to a power of two"), static_cast<int32>(Queue.GetCapacity()), 4);
+
+	int32 NextPushed = 0;
+	int32 NextExpected = 0;
+	int32 NumOutOfOrder = 0;
+
+	/** One element stays behind, so the push and pop positions sit in different slots as they wrap around */
+	Queue.Push(int32(NextPushed++));
+
+	for (int32 Round = 0; Round < 100; ++Round)
+	{
+		for (int32 Index = 0; Index < 3; ++Index)
+		{
+			if (!Queue.Push(int32(NextPushed++)))
+			{
+				AddError(FString::Printf(TEXT("Push %d failed with room left in the queue"), NextPushed - 1));
+				return false;
+			}
+		}
+
+		for (int32 Index = 0; Index < 3; ++Index)
+		{
+			int32 Element = INDEX_NONE;
+			if (!Queue.Pop(Element))
+			{
+				AddError(FString::Printf(TEXT("Pop %d failed with elements left in the queue"), NextExpected));
+				return false;
+			}
+
+			NumOutOfOrder += Element != NextExpected++ ? 1 : 0;
+		}
+	}
+
+	TestEqual(TEXT("Elements come out in the order pushed across the wraparound"), NumOutOfOrder, 0);
+	TestEqual(TEXT("Element left behind is still queued"), static_cast<int32>(Queue.NumApprox()), 1);
+
+	int32 Element = INDEX_NONE;
+	TestTrue(TEXT("Last element pops"), Queue.Pop(Element));
+	TestEqual(TEXT("Last element is the last one pushed"), Element, NextPushed - 1);
+	TestFalse(TEXT("Pop from an empty queue fails"), Queue.Pop(Element));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikRingBufferFullTest, "SteamIntegrationKit.RingBuffer.Full",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikRingBufferFullTest::RunTest(const FString& Parameters)
+{
+	TSikMpscRingBuffer<FString> Queue(4);
+
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		TestTrue(FString::Printf(TEXT("Push %d fits"), Index), Queue.Push(FString::FromInt(Index)));
+	}
+
+	FString Rejected = TEXT("Rejected");
+	TestFalse(TEXT("Push into a full queue fails"), Queue.Push(MoveTemp(Rejected)));
+	TestEqual(TEXT("Rejected element is left untouched"), Rejected, FString(TEXT("Rejected")));
+
+	bool bWriterCalled = false;
+	TestFalse(TEXT("Push in place into a full queue fails"), Queue.PushInPlace([&bWriterCalled](FString&) { bWriterCalled = true; }));
+	TestFalse(TEXT("Writer is not called for a full queue"), bWriterCalled);
+
+	FString Element;
+	TestTrue(TEXT("Oldest element pops"), Queue.Pop(Element));
+	TestEqual(TEXT("Oldest element is the first pushed"), Element, FString(TEXT("0")));
+
+	TestTrue(TEXT("Popping makes room again"), Queue.Push(MoveTemp(Rejected)));
+
+	TArray<FString> Remaining;
+	while (Queue.Pop(Element))
+	{
+		Remaining.Add(Element);
+	}
+
+	const TArray<FString> Expected = { TEXT("1"), TEXT("2"), TEXT("3"), TEXT("Rejected") };
+	TestTrue(TEXT("Queue keeps the order across the full state"), Remaining == Expected);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikRingBufferProducersTest, "SteamIntegrationKit.RingBuffer.MultipleProducers",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikRingBufferProducersTest::RunTest(const FString& Parameters)
+{
+	using namespace SikRingBufferTests;
+
+	TSikMpscRingBuffer<uint32> Queue(64);
+
+	/** Producers retry while the queue is full, every element has to make it through */
+	TArray<TFuture<void>> Producers;
+	for (int32 Producer = 0; Producer < NumProducers; ++Producer)
+	{
+		Producers.Add(Async(EAsyncExecution::Thread, [&Queue, Producer]()
+		{
+			for (int32 Count = 0; Count < PushesPerProducer; ++Count)
+			{
+				while (!Queue.Push(MakeElement(Producer, Count)))
+				{
+					FPlatformProcess::Yield();
+				}
+			}
+		}));
+	}
+
+	TArray<int32> NextCounts;
+	NextCounts.Init(0, NumProducers);
+
+	const int32 NumPushed = NumProducers * PushesPerProducer;
+	int32 NumPopped = 0;
+	int32 NumOutOfOrder = 0;
+
+	while (NumPopped < NumPushed)
+	{
+		uint32 Element = 0;
+		if (!Queue.Pop(Element))
+		{
+			if (!Algo::AllOf(Producers, [](const TFuture<void>& Producer) { return Producer.IsReady(); }))
+			{
+				FPlatformProcess::Yield();
+				continue;
+			}
+
+			/** Producers are done, a push may have landed since the last pop, whatever is still missing was lost */
+			if (!Queue.Pop(Element))
+			{
+				break;
+			}
+		}
+
+		++NumPopped;
+
+		/** Producers never wait on each other, only the order of each one's own elements is kept */
+		const int32 Producer = static_cast<int32>(Element >> 24);
+		const int32 Count = static_cast<int32>(Element & 0xFFFFFF);
+		if (!NextCounts.IsValidIndex(Producer) || NextCounts[Producer] != Count)
+		{
+			++NumOutOfOrder;
+			continue;
+		}
+
+		++NextCounts[Producer];
+	}
+
+	for (const TFuture<void>& Producer : Producers)
+	{
+		Producer.Wait();
+	}
+
+	TestEqual(TEXT("Every pushed element is popped"), NumPopped, NumPushed);
+	TestEqual(TEXT("Elements of each producer come out in the order it pushed them"), NumOutOfOrder, 0);
+	TestEqual(TEXT("Queue is empty once drained"), static_cast<int32>(Queue.NumApprox()), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,101 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/SikTestHelpers.h"
+#include "TimerManager.h"
+
+namespace SikSessionCacheTests
+{
+	/** @returns the generation of the snapshot the task completed with, 0 while it has none */
+	static uint32 GetGeneration(const FSikSessionTaskHandle& InHandle)
+	{
+		if (!InHandle.IsComplete())
+		{
+			return 0;
+		}
+
+		const FSikSessionSearchSnapshotPtr& Snapshot = InHandle.GetFuture().Get().SearchSnapshot;
+		return Snapshot.IsValid() ? Snapshot->GetGeneration() : 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikSessionCacheHitTest, "SteamIntegrationKit.SessionCache.Hit",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikSessionCacheHitTest::RunTest(const FString& Parameters)
+{
+	using namespace SikTestHelpers;
+	using namespace SikSessionCacheTests;
+
+	FScopedMockGameInstance MockGame(20);
+	if (!MockGame.IsValid())
+	{
+		AddError(TEXT("Could not start a game instance on the mock backend"));
+		return false;
+	}
+
+	USikSubsystem* Subsystem = MockGame.GetSubsystem();
+	FTimerManager& TimerManager = MockGame.GetGameInstance()->GetTimerManager();
+
+	FSikSessionQuery Query;
+	Query.MinOpenSlots = 0;
+
+	const FSikSessionTaskHandle SearchTask = Subsystem->FindSessionsAsync(Query);
+	TickUntil([&SearchTask]() { return SearchTask.IsComplete(); });
+
+	const uint32 Generation = GetGeneration(SearchTask);
+	TestTrue(TEXT("Search succeeds"), SearchTask.IsComplete() && SearchTask.GetFuture().Get().WasSuccessful());
+	TestTrue(TEXT("Search completes with a snapshot"), Generation != 0);
+
+	/** Fresh cache answers without asking the backend, the snapshot is shared rather than searched again */
+	const FSikSessionTaskHandle CachedTask = Subsystem->FindSessionsAsync(Query);
+	TestTrue(TEXT("Cached search completes right away"), CachedTask.IsComplete());
+	TestEqual(TEXT("Cached search completes with the same snapshot"), GetGeneration(CachedTask), Generation);
+
+	const FSikSessionSearchSnapshotPtr CachedSnapshot = Subsystem->GetCachedSearchResults(Query);
+	TestTrue(TEXT("Cache holds the snapshot of the query"), CachedSnapshot.IsValid() && CachedSnapshot->GetGeneration() == Generation);
+
+	/** Cache is keyed on the filter terms, a query sending other terms is not served from it */
+	FSikSessionQuery OtherQuery = Query;
+	OtherQuery.MinOpenSlots = Query.MinOpenSlots + 1;
+	TestFalse(TEXT("Query with other filters misses the cache"), Subsystem->GetCachedSearchResults(OtherQuery).IsValid());
+
+	/** Fewer results are a subset of the cached ones, more results too as the backend had fewer lobbies than asked for */
+	FSikSessionQuery SmallerQuery = Query;
+	SmallerQuery.MaxSearchResults = Query.MaxSearchResults / 2;
+	FSikSessionQuery LargerQuery = Query;
+	LargerQuery.MaxSearchResults = Query.MaxSearchResults * 2;
+	TestTrue(TEXT("Query asking for fewer results hits the cache"), Subsystem->GetCachedSearchResults(SmallerQuery).IsValid());
+	TestTrue(TEXT("Query asking for more results than the backend has hits the cache"), Subsystem->GetCachedSearchResults(LargerQuery).IsValid());
+
+	int32 NumBroadcasts = 0;
+	uint32 BroadcastGeneration = 0;
+	const FDelegateHandle BroadcastHandle = Subsystem->MultiplayerSessionsOnFindSessionsComplete.AddLambda(
+		[&NumBroadcasts, &BroadcastGeneration](const FSikSessionSearchSnapshotRef& InSnapshot, bool bWasSuccessful)
+	{
+		NumBroadcasts++;
+		BroadcastGeneration = bWasSuccessful ? InSnapshot->GetGeneration() : 0;
+	});
+
+	/** Cache hit is broadcast on the next tick like a backend result, and once however often it is asked for in a frame */
+	Subsystem->FindSessions(Query);
+	Subsystem->FindSessions(Query);
+	TestEqual(TEXT("Cache hit is not broadcast from within FindSessions"), NumBroadcasts, 0);
+
+	TimerManager.Tick(TickInterval);
+	TestEqual(TEXT("Cache hits of one frame are broadcast once"), NumBroadcasts, 1);
+	TestEqual(TEXT("Cache hit broadcasts the cached snapshot"), BroadcastGeneration, Generation);
+
+	TimerManager.Tick(TickInterval);
+	TestEqual(TEXT("Cache hit is broadcast only once"), NumBroadcasts, 1);
+
+	Subsystem->MultiplayerSessionsOnFindSessionsComplete.Remove(BroadcastHandle);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
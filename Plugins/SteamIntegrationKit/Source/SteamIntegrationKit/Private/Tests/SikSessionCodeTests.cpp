@@ -0,0 +1,147 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Subsystem/SikSubsystem.h"
+#include "System/SikSessionCode.h"
+
+namespace SikSessionCodeTests
+{
+	/** Steam lobby ids, public universe, chat account type and lobby instance flags */
+	static const TCHAR* LobbyIds[] =
+	{
+		TEXT("109775240917975040"),
+		TEXT("109775240917975041"),
+		TEXT("109775241058139342"),
+		TEXT("109775245212123135")
+	};
+
+	static const TCHAR* Alphabet = TEXT("BCDFGHJKLMNPQRSTVWXZ");
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikSessionCodeRoundTripTest, "SteamIntegrationKit.SessionCode.RoundTrip",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikSessionCodeRoundTripTest::RunTest(const FString& Parameters)
+{
+	TSet<FString> Codes;
+	for (const TCHAR* LobbyId : SikSessionCodeTests::LobbyIds)
+	{
+		FString Code;
+		if (!TestTrue(FString::Printf(TEXT("Lobby %s encodes"), LobbyId), FSikSessionCode::EncodeSessionId(LobbyId, Code)))
+		{
+			continue;
+		}
+
+		TestEqual(TEXT("Code has the session code length"), Code.Len(), SETTING_SESSION_CODELENGTH);
+		TestTrue(FString::Printf(TEXT("Code %s is well formed"), *Code), FSikSessionCode::IsWellFormed(Code));
+		TestFalse(FString::Printf(TEXT("Code %s is unique"), *Code), Codes.Contains(Code));
+		Codes.Add(Code);
+
+		FString SessionId;
+		if (TestTrue(FString::Printf(TEXT("Code %s decodes"), *Code), FSikSessionCode::DecodeSessionId(Code, SessionId)))
+		{
+			TestEqual(TEXT("Code decodes into the lobby it was encoded from"), SessionId, FString(LobbyId));
+		}
+	}
+
+	FString Code;
+	TestFalse(TEXT("Empty id does not encode"), FSikSessionCode::EncodeSessionId(FString(), Code));
+	TestFalse(TEXT("Non numeric id does not encode"), FSikSessionCode::EncodeSessionId(TEXT("Lobby"), Code));
+	TestFalse(TEXT("Id of another account type does not encode"), FSikSessionCode::EncodeSessionId(TEXT("76561197960287930"), Code));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikSessionCodeChecksumTest, "SteamIntegrationKit.SessionCode.Checksum",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikSessionCodeChecksumTest::RunTest(const FString& Parameters)
+{
+	FString Code;
+	if (!TestTrue(TEXT("Lobby encodes"), FSikSessionCode::EncodeSessionId(SikSessionCodeTests::LobbyIds[0], Code)))
+	{
+		return false;
+	}
+
+	/** Every single character typo is caught */
+	for (int32 Position = 0; Position < Code.Len(); Position++)
+	{
+		for (const TCHAR* Char = SikSessionCodeTests::Alphabet; *Char; Char++)
+		{
+			if (Code[Position] == *Char)
+			{
+				continue;
+			}
+
+			FString Typo = Code;
+			Typo[Position] = *Char;
+
+			FString SessionId;
+			if (FSikSessionCode::IsWellFormed(Typo) || FSikSessionCode::DecodeSessionId(Typo, SessionId))
+			{
+				AddError(FString::Printf(TEXT("Typo %s of code %s passes the checksum"), *Typo, *Code));
+			}
+		}
+	}
+
+	FString SessionId;
+	TestFalse(TEXT("Too short code is rejected"), FSikSessionCode::DecodeSessionId(Code.LeftChop(1), SessionId));
+	TestFalse(TEXT("Too long code is rejected"), FSikSessionCode::DecodeSessionId(Code + TEXT("B"), SessionId));
+	TestFalse(TEXT("Lower case code is rejected"), FSikSessionCode::DecodeSessionId(Code.ToLower(), SessionId));
+	TestFalse(TEXT("Code with a vowel is rejected"), FSikSessionCode::DecodeSessionId(FString(TEXT("A")) + Code.RightChop(1), SessionId));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikSessionCodeRandomTest, "SteamIntegrationKit.SessionCode.Random",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikSessionCodeRandomTest::RunTest(const FString& Parameters)
+{
+	for (int32 Index = 0; Index < 100; Index++)
+	{
+		const FString Code = FSikSessionCode::GenerateRandomCode();
+
+		FString SessionId;
+		if (!FSikSessionCode::IsWellFormed(Code) || FSikSessionCode::DecodeSessionId(Code, SessionId))
+		{
+			AddError(FString::Printf(TEXT("Random code %s is not well formed or decodes into a session id"), *Code));
+			break;
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikSessionCodeShortTest, "SteamIntegrationKit.SessionCode.Short",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikSessionCodeShortTest::RunTest(const FString& Parameters)
+{
+	for (int32 Index = 0; Index < 100; Index++)
+	{
+		const FString Code = FSikSessionCode::GenerateShortCode();
+
+		/** Short codes never decode, the lookup falls back to the session key search for them */
+		FString SessionId;
+		if (!FSikSessionCode::IsWellFormedShortCode(Code) || FSikSessionCode::IsWellFormed(Code) || FSikSessionCode::DecodeSessionId(Code, SessionId))
+		{
+			AddError(FString::Printf(TEXT("Short code %s is not well formed or decodes into a session id"), *Code));
+			break;
+		}
+	}
+
+	FString LongCode;
+	if (TestTrue(TEXT("Lobby encodes"), FSikSessionCode::EncodeSessionId(SikSessionCodeTests::LobbyIds[0], LongCode)))
+	{
+		TestFalse(TEXT("Encoded code is not a short code"), FSikSessionCode::IsWellFormedShortCode(LongCode));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
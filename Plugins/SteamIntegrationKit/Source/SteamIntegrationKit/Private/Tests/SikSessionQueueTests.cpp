@@ -0,0 +1,61 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/SikTestHelpers.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikSessionQueueCoalescingTest, "SteamIntegrationKit.SessionQueue.Coalescing",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikSessionQueueCoalescingTest::RunTest(const FString& Parameters)
+{
+	using namespace SikTestHelpers;
+
+	FScopedMockGameInstance MockGame(2);
+	if (!MockGame.IsValid() || MockGame.GetMockSession()->GetLobbies().Num() < 2)
+	{
+		AddError(TEXT("Could not start a game instance on the mock backend"));
+		return false;
+	}
+
+	USikSubsystem* Subsystem = MockGame.GetSubsystem();
+	const TSharedPtr<FSikMockOnlineSession, ESPMode::ThreadSafe> MockSession = MockGame.GetMockSession();
+	const TArray<FOnlineSessionSearchResult>& Lobbies = MockSession->GetLobbies();
+
+	/** Runs right away and keeps the queue waiting until the mock backend is ticked */
+	const FSikSessionTaskHandle CreateTask = Subsystem->CreateSessionAsync(FSikCustomSessionSettings());
+	TestFalse(TEXT("Create waits for the backend"), CreateTask.IsComplete());
+
+	/** A start already waiting takes the next one */
+	const FSikSessionTaskHandle FirstStartTask = Subsystem->StartSessionAsync();
+	const FSikSessionTaskHandle SecondStartTask = Subsystem->StartSessionAsync();
+
+	/** Latest host or join intent wins, a join replaces the waiting create and a later join */
+	const FSikSessionTaskHandle ReplacedCreateTask = Subsystem->CreateSessionAsync(FSikCustomSessionSettings());
+	const FSikSessionTaskHandle FirstJoinTask = Subsystem->JoinSessionAsync(Lobbies[0]);
+	const FSikSessionTaskHandle SecondJoinTask = Subsystem->JoinSessionAsync(Lobbies[1]);
+
+	TestEqual(TEXT("Replaced create is cancelled"), GetResult(ReplacedCreateTask), static_cast<int32>(ESikSessionOperationResult::Cancelled));
+	TestFalse(TEXT("Merged start is not completed on its own"), SecondStartTask.IsComplete());
+	TestFalse(TEXT("Merged join is not completed on its own"), FirstJoinTask.IsComplete());
+	TestFalse(TEXT("Join waits behind the start"), SecondJoinTask.IsComplete());
+
+	TickUntil([&FirstStartTask]() { return FirstStartTask.IsComplete(); });
+
+	TestEqual(TEXT("Create succeeds"), GetResult(CreateTask), static_cast<int32>(ESikSessionOperationResult::Succeeded));
+	TestEqual(TEXT("Start succeeds"), GetResult(FirstStartTask), static_cast<int32>(ESikSessionOperationResult::Succeeded));
+	TestEqual(TEXT("Merged start completes with the start it was merged into"), GetResult(SecondStartTask), GetResult(FirstStartTask));
+	TestTrue(TEXT("Session is in progress"), MockSession->GetSessionState(NAME_GameSession) == EOnlineSessionState::InProgress);
+
+	MockGame.Shutdown();
+
+	TestTrue(TEXT("Shutdown completes the waiting join"), SecondJoinTask.IsComplete());
+	TestEqual(TEXT("Merged join completes with the join it was merged into"), GetResult(FirstJoinTask), GetResult(SecondJoinTask));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
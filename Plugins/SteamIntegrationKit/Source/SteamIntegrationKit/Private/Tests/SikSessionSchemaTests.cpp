@@ -0,0 +1,126 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "OnlineSessionSettings.h"
+#include "Subsystem/SikSubsystem.h"
+#include "System/SikSessionSchema.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikSessionSchemaPackTest, "SteamIntegrationKit.SessionSchema.PackRoundTrip",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikSessionSchemaPackTest::RunTest(const FString& Parameters)
+{
+	const ESikPlayersConfig PlayersConfigs[] = { ESikPlayersConfig::Any, ESikPlayersConfig::OneVsOne, ESikPlayersConfig::TwoVsTwo, ESikPlayersConfig::FourVsFour };
+	const ESikSessionVisibility Visibilities[] = { ESikSessionVisibility::Public, ESikSessionVisibility::Private };
+	const uint8 Ids[] = { 0, 1, 2, 127, 255 };
+
+	int32 NumMismatches = 0;
+	int32 NumNegative = 0;
+	TSet<int32> PackedValues;
+
+	for (const uint8 MapId : Ids)
+	{
+		for (const uint8 GameModeId : Ids)
+		{
+			for (const ESikPlayersConfig Players : PlayersConfigs)
+			{
+				for (const ESikSessionVisibility Visibility : Visibilities)
+				{
+					FSikPackedSessionSettings Settings;
+					Settings.MapId = MapId;
+					Settings.GameModeId = GameModeId;
+					Settings.Players = Players;
+					Settings.Visibility = Visibility;
+
+					const int32 Packed = Settings.Pack();
+					NumNegative += Packed < 0 ? 1 : 0;
+					PackedValues.Add(Packed);
+
+					FSikPackedSessionSettings Unpacked;
+					NumMismatches += FSikPackedSessionSettings::Unpack(Packed, Unpacked) && Unpacked == Settings ? 0 : 1;
+				}
+			}
+		}
+	}
+
+	TestEqual(TEXT("Every settings combination unpacks to itself"), NumMismatches, 0);
+	TestEqual(TEXT("Packed values keep bit 31 clear"), NumNegative, 0);
+	TestEqual(TEXT("Every settings combination packs to its own value"), PackedValues.Num(),
+		static_cast<int32>(UE_ARRAY_COUNT(Ids) * UE_ARRAY_COUNT(Ids) * UE_ARRAY_COUNT(PlayersConfigs) * UE_ARRAY_COUNT(Visibilities)));
+
+	/** Values of another schema version must not be listed */
+	FSikPackedSessionSettings Unpacked;
+	const int32 OtherVersion = (FSikPackedSessionSettings().Pack() & ~(0xF << 24)) | ((FSikPackedSessionSettings::SchemaVersion + 1) << 24);
+	TestFalse(TEXT("Value of another schema version does not unpack"), FSikPackedSessionSettings::Unpack(OtherVersion, Unpacked));
+	TestFalse(TEXT("Missing value does not unpack"), FSikPackedSessionSettings::Unpack(0, Unpacked));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSikSessionSchemaReadableTest, "SteamIntegrationKit.SessionSchema.ReadableRoundTrip",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSikSessionSchemaReadableTest::RunTest(const FString& Parameters)
+{
+	const USikSubsystem* DefaultSubsystem = GetDefault<USikSubsystem>();
+	const TArray<FString>& MapNames = DefaultSubsystem->GetSessionMapNames();
+	const TArray<FString>& GameModes = DefaultSubsystem->GetSessionGameModes();
+	if (MapNames.IsEmpty() || GameModes.IsEmpty())
+	{
+		AddWarning(TEXT("No session map names or game modes configured, nothing to round trip"));
+		return true;
+	}
+
+	FSikCustomSessionSettings Readable;
+	Readable.MapName = MapNames.Last();
+	Readable.GameMode = GameModes.Last();
+	Readable.Players = TEXT("2v2");
+	Readable.Visibility = TEXT("Private");
+
+	const FSikPackedSessionSettings Packed = FSikSessionSchema::FromReadable(Readable);
+	TestEqual(TEXT("Map id is its index + 1"), static_cast<int32>(Packed.MapId), MapNames.Num());
+	TestEqual(TEXT("Game mode id is its index + 1"), static_cast<int32>(Packed.GameModeId), GameModes.Num());
+
+	FSikPackedSessionSettings Unpacked;
+	if (TestTrue(TEXT("Advertised value unpacks"), FSikPackedSessionSettings::Unpack(Packed.Pack(), Unpacked)))
+	{
+		const FSikCustomSessionSettings RoundTrip = FSikSessionSchema::ToReadable(Unpacked);
+		TestEqual(TEXT("Map name survives the round trip"), RoundTrip.MapName, Readable.MapName);
+		TestEqual(TEXT("Game mode survives the round trip"), RoundTrip.GameMode, Readable.GameMode);
+		TestEqual(TEXT("Players survive the round trip"), RoundTrip.Players, Readable.Players);
+		TestEqual(TEXT("Visibility survives the round trip"), RoundTrip.Visibility, Readable.Visibility);
+	}
+
+	/** Names not in the tables stay unset rather than taking another entry's id */
+	FSikCustomSessionSettings Unknown = Readable;
+	Unknown.MapName = TEXT("SikUnknownMap");
+	Unknown.Players = TEXT("3v3");
+	const FSikPackedSessionSettings UnknownPacked = FSikSessionSchema::FromReadable(Unknown);
+	TestEqual(TEXT("Unknown map is unset"), static_cast<int32>(UnknownPacked.MapId), 0);
+	TestTrue(TEXT("Unknown players configuration is unset"), UnknownPacked.Players == ESikPlayersConfig::Any);
+
+	/** Every field the backend filters on is advertised, the packed value and the per field keys agree */
+	FOnlineSessionSettings SessionSettings;
+	FSikSessionSchema::Advertise(Packed, SessionSettings);
+
+	int32 AdvertisedPacked = 0;
+	int32 AdvertisedMap = 0;
+	int32 AdvertisedGameMode = 0;
+	int32 AdvertisedPlayers = 0;
+	int32 AdvertisedVisibility = 0;
+	TestTrue(TEXT("Packed value is advertised"), SessionSettings.Get(SETTING_SESSIONSCHEMA, AdvertisedPacked) && AdvertisedPacked == Packed.Pack());
+	TestTrue(TEXT("Map is advertised"), SessionSettings.Get(SETTING_SCHEMA_MAP, AdvertisedMap) && AdvertisedMap == Packed.MapId);
+	TestTrue(TEXT("Game mode is advertised"), SessionSettings.Get(SETTING_SCHEMA_GAMEMODE, AdvertisedGameMode) && AdvertisedGameMode == Packed.GameModeId);
+	TestTrue(TEXT("Players are advertised"), SessionSettings.Get(SETTING_SCHEMA_PLAYERS, AdvertisedPlayers) && 
+		AdvertisedPlayers == static_cast<int32>(Packed.Players));
+	TestTrue(TEXT("Visibility is advertised"), SessionSettings.Get(SETTING_SCHEMA_VISIBILITY, AdvertisedVisibility) && 
+		AdvertisedVisibility == static_cast<int32>(Packed.Visibility));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,122 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Subsystem/SikSubsystem.h"
+#include "System/SikMockOnlineSession.h"
+
+namespace SikTestHelpers
+{
+	/** Seconds the core ticker and the timers are advanced by at once, the mock backend completes from the ticker */
+	constexpr float TickInterval = 0.05f;
+
+	/** Ticks the mock backend is given to complete an operation */
+	constexpr int32 MaxTicks = 200;
+
+	/** @returns the result of the task, or -1 while it has none */
+	inline int32 GetResult(const FSikSessionTaskHandle& InHandle)
+	{
+		return InHandle.IsComplete() ? static_cast<int32>(InHandle.GetFuture().Get().Result) : INDEX_NONE;
+	}
+
+	/**
+	 * Ticks the core ticker the mock backend completes from until InIsDone returns true, at most MaxTicks times
+	 * @returns whether InIsDone returned true
+	 */
+	template <typename PredicateType>
+	bool TickUntil(PredicateType&& InIsDone)
+	{
+		for (int32 Tick = 0; Tick < MaxTicks; Tick++)
+		{
+			if (InIsDone())
+			{
+				return true;
+			}
+
+			FTSTicker::GetCoreTicker().Tick(TickInterval);
+		}
+
+		return InIsDone();
+	}
+
+	/**
+	 * Standalone game instance whose subsystem runs on the mock backend, with a fixed latency and no failures
+	 * so every operation completes after the same number of ticks. Shut down and its world destroyed when it goes out of scope
+	 ******************************************************************************************/
+	class FScopedMockGameInstance
+	{
+	public:
+		explicit FScopedMockGameInstance(int32 InLobbyCount)
+		{
+			if (!GEngine)
+			{
+				return;
+			}
+
+			GameInstance = NewObject<UGameInstance>(GEngine);
+			GameInstance->InitializeStandalone();
+
+			FSikMockBackendSettings MockSettings;
+			MockSettings.LobbyCount = InLobbyCount;
+			MockSettings.Latency = TickInterval;
+			MockSettings.LatencyJitter = 0.f;
+			MockSettings.FailureRate = 0.f;
+			MockSettings.PrivateLobbyRate = 0.f;
+
+			Subsystem = GameInstance->GetSubsystem<USikSubsystem>();
+			MockSession = Subsystem ? Subsystem->UseMockBackend(MockSettings) : nullptr;
+		}
+
+		~FScopedMockGameInstance()
+		{
+			Shutdown();
+		}
+
+		UE_NONCOPYABLE(FScopedMockGameInstance);
+
+		/** @returns true if the subsystem switched to the mock backend */
+		bool IsValid() const { return MockSession.IsValid(); }
+
+		UGameInstance* GetGameInstance() const { return GameInstance; }
+		USikSubsystem* GetSubsystem() const { return Subsystem; }
+		const TSharedPtr<FSikMockOnlineSession, ESPMode::ThreadSafe>& GetMockSession() const { return MockSession; }
+
+		/** Shuts the game instance down before it goes out of scope, for tests checking what the shutdown completes */
+		void Shutdown()
+		{
+			if (!GameInstance)
+			{
+				return;
+			}
+
+			/** The game instance forgets its world on shutdown */
+			UWorld* World = GameInstance->GetWorld();
+			GameInstance->Shutdown();
+
+			if (World)
+			{
+				GEngine->DestroyWorldContext(World);
+				World->DestroyWorld(false);
+			}
+
+			GameInstance = nullptr;
+			Subsystem = nullptr;
+			MockSession.Reset();
+		}
+
+	private:
+		UGameInstance* GameInstance = nullptr;
+		USikSubsystem* Subsystem = nullptr;
+		TSharedPtr<FSikMockOnlineSession, ESPMode::ThreadSafe> MockSession;
+	};
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -5,11 +5,15 @@
 #include "OnlineSessionSettings.h"
 #include "OnlineSubsystem.h"
 #include "Widgets/SikSessionDataWidget.h"
+#include "Components/ScrollBox.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "Online/OnlineSessionNames.h"
 #include "System/SikLogger.h"
+#include "System/SikSessionListFilter.h"
+#include "System/SikSessionMetrics.h"
+#include "ProfilingDebugging/MiscTrace.h"
 
 bool USikHudWidget::Initialize()
 {
@@ -43,7 +47,16 @@ bool USikHudWidget::Initialize()
 	
 		SikSubsystem->MultiplayerSessionsOnCreateSessionComplete.AddDynamic(this, &ThisClass::OnSessionCreatedCallback);
 		SikSubsystem->MultiplayerSessionsOnFindSessionsComplete.AddUObject(this, &ThisClass::OnSessionsFoundCallback);
+		SikSubsystem->MultiplayerSessionsOnFindSessionByCodeComplete.AddUObject(this, &ThisClass::OnSessionFoundByCodeCallback);
 		SikSubsystem->MultiplayerSessionsOnJoinSessionsComplete.AddUObject(this, &ThisClass::OnSessionJoinedCallback);
+		SikSubsystem->MultiplayerSessionsOnSessionLatenciesUpdated.AddUObject(this, &ThisClass::OnSessionLatenciesUpdatedCallback);
+		SikSubsystem->MultiplayerSessionsOnQuickMatchComplete.AddDynamic(this, &ThisClass::OnMatchCompleteCallback);
+		SikSubsystem->MultiplayerSessionsOnMatchmakingComplete.AddDynamic(this, &ThisClass::OnMatchCompleteCallback);
+		
+		if (SessionsScrollBox)
+		{
+			SessionsScrollBox->OnUserScrolled.AddUniqueDynamic(this, &ThisClass::OnSessionsScrolled);
+		}
 	}
 	
 	return true;
@@ -59,6 +72,8 @@ void USikHudWidget::HostGame(const FSikCustomSessionSettings& InSessionSettings)
 
 	if (GetSikSubsystem())
 	{
+		SikSubsystem->GetSessionMetrics().BeginSpan(SIK_SPAN_HOSTGAME);
+		SikSubsystem->PreloadTravelMaps(LobbyMapPath);
 		SikSubsystem->CreateSession(InSessionSettings);
 	}
 }
@@ -67,13 +82,13 @@ void USikHudWidget::EnterCode(const FText& InSessionCode)
 {
 	LOG_INFO(TEXT("Called session Code Entered : %s"), *InSessionCode.ToString());
 	
-	bJoinSessionViaCode = true;
 	SessionCodeToJoin = InSessionCode.ToString();
 
-	if (SessionCodeToJoin.Len() < SETTING_SESSION_CODELENGTH)
+	/** Short codes come from hosts on backends without a lookup by id, see FSikSessionCode::GenerateShortCode */
+	if (SessionCodeToJoin.Len() != SETTING_SESSION_SHORTCODELENGTH && SessionCodeToJoin.Len() != SETTING_SESSION_CODELENGTH)
 	{
-		ShowMessage(FString::Printf(TEXT("Room code must be %d digits long"), 
-			SETTING_SESSION_CODELENGTH), true);		
+		ShowMessage(FString::Printf(TEXT("Room code must be %d or %d letters long"), 
+			SETTING_SESSION_SHORTCODELENGTH, SETTING_SESSION_CODELENGTH), true);		
 		return;
 	}
 	
@@ -81,7 +96,81 @@ void USikHudWidget::EnterCode(const FText& InSessionCode)
 	
 	if (GetSikSubsystem())
 	{
-		SikSubsystem->FindSessions();
+		SikSubsystem->GetSessionMetrics().BeginSpan(SIK_SPAN_JOINBYCODE);
+		SikSubsystem->PreloadTravelMaps(LobbyMapPath);
+		SikSubsystem->FindSessionByCode(SessionCodeToJoin);
+	}
+}
+
+void USikHudWidget::SetLanMode(const bool bInLanMode)
+{
+	LOG_INFO(TEXT("Called LAN : %s"), bInLanMode ? TEXT("on") : TEXT("off"));
+	
+	if (!GetSikSubsystem())
+	{
+		return;
+	}
+	
+	if (!SikSubsystem->SetLanMode(bInLanMode))
+	{
+		ShowMessage(FString("Leave the room before switching between LAN and online"), true);
+		return;
+	}
+	
+	/** Sessions listed so far belong to the other backend */
+	if (bCanFindNewSessions)
+	{
+		StartFindingSessions();
+	}
+}
+
+void USikHudWidget::QuickMatch(const FSikCustomSessionSettings& InFilter)
+{
+	LOG_INFO(TEXT("Called"));
+	
+	if (!GetSikSubsystem() || SikSubsystem->IsQuickMatching())
+	{
+		return;
+	}
+	
+	ShowMessage(FString("Finding a match"));
+	
+	SikSubsystem->PreloadTravelMaps(LobbyMapPath);
+	SikSubsystem->QuickMatch(FSikSessionQuery::FromFilter(InFilter), FTimespan::FromSeconds(QuickMatchDeadline));
+}
+
+void USikHudWidget::CancelQuickMatch()
+{
+	LOG_INFO(TEXT("Called"));
+	
+	if (GetSikSubsystem())
+	{
+		SikSubsystem->CancelQuickMatch();
+	}
+}
+
+void USikHudWidget::StartMatchmaking(const FString& InRegion, const int32 InSkill, const FSikCustomSessionSettings& InPreferences)
+{
+	LOG_INFO(TEXT("Called"));
+	
+	if (!GetSikSubsystem() || SikSubsystem->IsMatchmaking())
+	{
+		return;
+	}
+	
+	ShowMessage(FString("Waiting for players"));
+	
+	SikSubsystem->PreloadTravelMaps(LobbyMapPath);
+	SikSubsystem->StartMatchmaking(InRegion, InSkill, InPreferences);
+}
+
+void USikHudWidget::CancelMatchmaking()
+{
+	LOG_INFO(TEXT("Called"));
+	
+	if (GetSikSubsystem())
+	{
+		SikSubsystem->CancelMatchmaking();
 	}
 }
 
@@ -95,6 +184,11 @@ void USikHudWidget::OnSessionCreatedCallback(bool bWasSuccessful)
 	
 	if (!bWasSuccessful)
 	{
+		if (GetSikSubsystem())
+		{
+			SikSubsystem->GetSessionMetrics().EndSpan(SIK_SPAN_HOSTGAME, false);
+		}
+		
 		ShowMessage(FString("Failed to Create Session"), true);
 		return;
 	}
@@ -104,19 +198,31 @@ void USikHudWidget::OnSessionCreatedCallback(bool bWasSuccessful)
 		
 	if (UWorld* World = GetWorld())
 	{
+		/** Closed by ASikLobbyGameMode::PostLogin once the host's own controller is in the lobby */
+		if (GetSikSubsystem())
+		{
+			SikSubsystem->GetSessionMetrics().BeginSpan(SIK_SPAN_SERVERTRAVEL);
+			SikSubsystem->GetFlightRecorder().Record(ESikFlightEventType::TravelStarted, ESikFlightSubject::ServerTravel);
+		}
+		
+		TRACE_BOOKMARK(TEXT("Sik ServerTravel %s"), *TravelPath);
 		World->ServerTravel(TravelPath);
 	}
 }
 
-void USikHudWidget::OnSessionsFoundCallback(const TArray<FOnlineSessionSearchResult>& SessionResults, bool bWasSuccessful)
+void USikHudWidget::OnSessionsFoundCallback(const FSikSessionSearchSnapshotRef& SessionResults, bool bWasSuccessful)
 {
 	LOG_INFO(TEXT("Session found : %s"), bWasSuccessful ? TEXT("Success") : TEXT("Failed"));
 	
+	if (!bCanFindNewSessions)
+	{
+		return;
+	}
+	
 	if (!GetSikSubsystem())
 	{		
 		LOG_ERROR(TEXT("MultiplayerSessionsSubsystem is INVALID"));
 		
-		bJoinSessionViaCode = false;
 		ShowMessage(FString("Unknown Error"), true);
 		SetFindSessionsThrobberVisibility(ESlateVisibility::Visible);
 		FindNewSessionsIfAllowed();
@@ -127,19 +233,37 @@ void USikHudWidget::OnSessionsFoundCallback(const TArray<FOnlineSessionSearchRes
 	{
 		LOG_ERROR(TEXT("Session search result unsuccessful"));
 		
-		bJoinSessionViaCode = false;
 		SetFindSessionsThrobberVisibility(ESlateVisibility::Visible);
 		FindNewSessionsIfAllowed();
 		return;
 	}
 
-	if (bJoinSessionViaCode)
+	UpdateSessionsList(SessionResults);
+}
+
+void USikHudWidget::OnSessionFoundByCodeCallback(const FOnlineSessionSearchResult& SessionResult, bool bWasSuccessful)
+{
+	LOG_INFO(TEXT("Session found by code : %s"), bWasSuccessful ? TEXT("Success") : TEXT("Failed"));
+	
+	if (!bWasSuccessful || !SessionResult.IsValid())
 	{
-		JoinSessionViaSessionCode(SessionResults);
+		LOG_INFO(TEXT("Wrong Session Code Entered: %s"), *SessionCodeToJoin);
+		
+		if (GetSikSubsystem())
+		{
+			SikSubsystem->GetSessionMetrics().EndSpan(SIK_SPAN_JOINBYCODE, false);
+			SikSubsystem->ReleasePreloadedMaps();
+		}
+		
+		ShowMessage(FString::Printf(TEXT("Wrong room Code Entered: %s"), *SessionCodeToJoin), true);
+		return;
 	}
-	else
+	
+	ShowMessage(TEXT("Found the room"));
+	
+	if (GetSikSubsystem())
 	{
-		UpdateSessionsList(SessionResults);
+		SikSubsystem->JoinSessions(SessionResult);
 	}
 }
 
@@ -169,29 +293,27 @@ void USikHudWidget::OnSessionJoinedCallback(EOnJoinSessionCompleteResult::Type R
 
 	if (Result != EOnJoinSessionCompleteResult::Type::Success)
 	{
+		if (GetSikSubsystem())
+		{
+			SikSubsystem->GetSessionMetrics().EndSpan(SIK_SPAN_JOINBYCODE, false);
+		}
+		
 		ShowMessage(FString::Printf(TEXT("%s"), LexToString(Result)), true);
-		bJoinSessionViaCode = false;
 		
 		return;
 	}
 	
-	const IOnlineSubsystem* OnlineSubsystem = IOnlineSubsystem::Get();
-	if (!OnlineSubsystem)
-	{
-		LOG_ERROR(TEXT("OnlineSubsystem is NULL"));
-	}
-	
-	const IOnlineSessionPtr SessionInterface = OnlineSubsystem->GetSessionInterface();
-	if (!SessionInterface.IsValid())
-	{
-		LOG_ERROR(TEXT("SessionInterface is INVALID"));
-	}
-	
+	/** Resolved through the subsystem so the address comes from the session backend it actually uses */
 	if (FString AddressOfSessionToJoin; 
-			SessionInterface->GetResolvedConnectString(NAME_GameSession, AddressOfSessionToJoin))
+			GetSikSubsystem() && SikSubsystem->GetResolvedConnectString(AddressOfSessionToJoin))
 	{
 		if (APlayerController* PlayerController = GetGameInstance()->GetFirstLocalPlayerController())
 		{
+			/** Closed by USikSubsystem once the session's map has loaded */
+			SikSubsystem->GetSessionMetrics().BeginSpan(SIK_SPAN_CLIENTTRAVEL);
+			SikSubsystem->GetFlightRecorder().Record(ESikFlightEventType::TravelStarted, ESikFlightSubject::ClientTravel);
+			TRACE_BOOKMARK(TEXT("Sik ClientTravel %s"), *AddressOfSessionToJoin);
+			
 			PlayerController->ClientTravel(AddressOfSessionToJoin, ETravelType::TRAVEL_Absolute);	
 		}
 	}
@@ -199,94 +321,69 @@ void USikHudWidget::OnSessionJoinedCallback(EOnJoinSessionCompleteResult::Type R
 	{
 		LOG_ERROR(TEXT("Failed to find the address of the session to join"));
 		
+		if (GetSikSubsystem())
+		{
+			SikSubsystem->GetSessionMetrics().EndSpan(SIK_SPAN_JOINBYCODE, false);
+		}
+		
 		ShowMessage(FString("Failed to Join Session"), true);
-		bJoinSessionViaCode = false;
 	}
 }
 
-#pragma endregion Subsystem Callbacks
-
-#pragma region Defaults
-	
-void USikHudWidget::JoinSessionViaSessionCode(const TArray<FOnlineSessionSearchResult>& SessionSearchResults)
+void USikHudWidget::OnMatchCompleteCallback(ESikMatchResult Result)
 {
-	LOG_INFO(TEXT("Called"));
+	LOG_INFO(TEXT("Match : %s"), *UEnum::GetValueAsString(Result));
 	
-	for (FOnlineSessionSearchResult CurrentSessionSearchResult : SessionSearchResults)
+	switch (Result)
 	{
-		FString CurrentSessionResultSessionCode = FString(""); 
-		CurrentSessionSearchResult.Session.SessionSettings.Get(SETTING_SESSIONKEY, CurrentSessionResultSessionCode);
-		
-		if (CurrentSessionResultSessionCode != SessionCodeToJoin)
+	case ESikMatchResult::Joined:
+		OnSessionJoinedCallback(EOnJoinSessionCompleteResult::Success);
+		break;
+	case ESikMatchResult::Hosted:
+		OnSessionCreatedCallback(true);
+		break;
+	case ESikMatchResult::Failed:
+		if (GetSikSubsystem())
 		{
-			continue;	
+			SikSubsystem->ReleasePreloadedMaps();
 		}
-		
-		LOG_INFO(TEXT("Found session with code %s joining it"), *SessionCodeToJoin);
-	
-		ShowMessage(TEXT("Found the room"));
-		
+		ShowMessage(FString("Failed to find or host a match"), true);
+		break;
+	case ESikMatchResult::Cancelled:
 		if (GetSikSubsystem())
 		{
-			SikSubsystem->JoinSessions(CurrentSessionSearchResult);
+			SikSubsystem->ReleasePreloadedMaps();
 		}
-			
-		return;
+		ShowMessage(FString("Stopped looking for a match"), true);
+		break;
 	}
-	
-	LOG_INFO(TEXT("Wrong Session Code Entered: %s"), *SessionCodeToJoin);
-	
-	ShowMessage(FString::Printf(TEXT("Wrong room Code Entered: %s"), *SessionCodeToJoin), true);
-	
-	bJoinSessionViaCode = false;
 }
 
-void USikHudWidget::UpdateSessionsList(const TArray<FOnlineSessionSearchResult>& Results)
+#pragma endregion Subsystem Callbacks
+
+#pragma region Defaults
+	
+void USikHudWidget::UpdateSessionsList(const FSikSessionSearchSnapshotRef& Results)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SikUpdateSessionsList);
+	
 	LOG_INFO(TEXT("Called"));
 
 	TSet<FString> NewSessionKeys;
 	bool bAnySessionExists = false;
 
-	// Filter settings
-	const auto [MapName, GameMode, 
-		Players, RoomVisibility] = GetCurrentSessionsFilter();
-	const bool bShowAllMap = MapName == "Any";
-	const bool bShowAllGameMode = GameMode == "Any";
-	const bool bShowAllPlayers = Players == "Any";
-
 	// --- FIRST PASS: Add/update only filtered sessions ---
-	for (const FOnlineSessionSearchResult& Result : Results)
+	TArray<FSikSessionListEntry> Entries;
+	TArray<FString> RemovedSessionKeys;
+	const FSikSessionListFilter SessionListFilter(GetCurrentSessionsFilter());
+	SessionListFilter.Apply(Results->GetResults(), LastSessionKeys, Entries, NewSessionKeys, RemovedSessionKeys);
+	
+	for (const FSikSessionListEntry& Entry : Entries)
 	{
-		if (Result.Session.NumOpenPublicConnections <= 0)
-			continue;
-
-		FSikCustomSessionSettings CurrentSessionSettings;
-		Result.Session.SessionSettings.Get(SETTING_MAPNAME, CurrentSessionSettings.MapName);
-		Result.Session.SessionSettings.Get(SETTING_GAMEMODE, CurrentSessionSettings.GameMode);
-		Result.Session.SessionSettings.Get(SETTING_NUMPLAYERSREQUIRED, CurrentSessionSettings.Players);
-		Result.Session.SessionSettings.Get(SETTING_SESSION_VISIBILITY, CurrentSessionSettings.Visibility);
-
-		if (CurrentSessionSettings.Visibility == FString("Private"))
-			continue;
-		
-		if (!bShowAllMap && CurrentSessionSettings.MapName != MapName)
-			continue;
-		
-		if (!bShowAllGameMode && CurrentSessionSettings.GameMode != GameMode)
-			continue;
-		
-		if (!bShowAllPlayers && CurrentSessionSettings.Players != Players)
-			continue;
-		
-		// Session matches the filter → handle it
-		const FString Key = Result.GetSessionIdStr();
-		NewSessionKeys.Add(Key);
-
 		// --- UPDATE EXISTING WIDGET ---
-		if (USikSessionDataWidget** ExistingWidgetPtr = ActiveSessionWidgets.Find(Key))
+		if (USikSessionDataWidget** ExistingWidgetPtr = ActiveSessionWidgets.Find(Entry.Key))
 		{
-			(*ExistingWidgetPtr)->SetSessionInfo(Result, CurrentSessionSettings);
+			(*ExistingWidgetPtr)->SetSessionInfo(Results->GetHandle(Entry.ResultIndex), FSikSessionSchema::ToReadable(Entry.Settings));
 			bAnySessionExists = true;
 			continue;
 		}
@@ -299,21 +396,18 @@ void USikHudWidget::UpdateSessionsList(const TArray<FOnlineSessionSearchResult>&
 		}
 
 		USikSessionDataWidget* NewWidget = CreateWidget<USikSessionDataWidget>(GetWorld(), SessionDataWidgetClass);
-		NewWidget->SetSessionInfo(Result, CurrentSessionSettings);
+		NewWidget->SetSessionInfo(Results->GetHandle(Entry.ResultIndex), FSikSessionSchema::ToReadable(Entry.Settings));
 		NewWidget->SetSikHudWidget(this);
 
-		AddSessionDataWidget(NewWidget);
-		ActiveSessionWidgets.Add(Key, NewWidget);
+		/** Added to the scroll box by RankSessionsList once all sessions are known */
+		ActiveSessionWidgets.Add(Entry.Key, NewWidget);
 
 		bAnySessionExists = true;
 	}
 
 	// --- SECOND PASS: REMOVE widgets NOT in filtered set ---
-	for (const FString& CurrentKey : LastSessionKeys)
+	for (const FString& CurrentKey : RemovedSessionKeys)
 	{
-		if (NewSessionKeys.Contains(CurrentKey))
-			continue;
-
 		if (USikSessionDataWidget** WidgetPtr = ActiveSessionWidgets.Find(CurrentKey))
 		{
 			if (USikSessionDataWidget* Widget = *WidgetPtr)
@@ -324,6 +418,8 @@ void USikHudWidget::UpdateSessionsList(const TArray<FOnlineSessionSearchResult>&
 	}
 
 	LastSessionKeys = MoveTemp(NewSessionKeys);
+	
+	RankSessionsList();
 
 	if (bAnySessionExists)
 	{
@@ -337,6 +433,71 @@ void USikHudWidget::UpdateSessionsList(const TArray<FOnlineSessionSearchResult>&
 	FindNewSessionsIfAllowed();
 }
 
+void USikHudWidget::RankSessionsList()
+{
+	if (!GetSikSubsystem())
+	{
+		return;
+	}
+	
+	/** Sessions already on screen keep their relative order among equal latencies, new ones follow */
+	TArray<FString> PreviousOrder;
+	PreviousOrder.Reserve(ActiveSessionWidgets.Num());
+	for (const FString& Key : DisplayedSessionOrder)
+	{
+		if (ActiveSessionWidgets.Contains(Key))
+		{
+			PreviousOrder.Add(Key);
+		}
+	}
+	for (const TPair<FString, USikSessionDataWidget*>& ActiveSessionWidget : ActiveSessionWidgets)
+	{
+		if (!DisplayedSessionOrder.Contains(ActiveSessionWidget.Key))
+		{
+			PreviousOrder.Add(ActiveSessionWidget.Key);
+		}
+	}
+	
+	TArray<FSikSessionHandle> RankedSessions;
+	RankedSessions.Reserve(PreviousOrder.Num());
+	for (const FString& Key : PreviousOrder)
+	{
+		RankedSessions.Add(ActiveSessionWidgets[Key]->GetSessionHandle());
+	}
+	
+	SikSubsystem->RankSessionsByLatency(RankedSessions);
+	
+	TArray<FString> RankedOrder;
+	RankedOrder.Reserve(RankedSessions.Num());
+	for (const FSikSessionHandle& RankedSession : RankedSessions)
+	{
+		const FString Key = RankedSession->GetSessionIdStr();
+		RankedOrder.Add(Key);
+		ActiveSessionWidgets[Key]->SetPing(SikSubsystem->GetSessionLatency(*RankedSession));
+	}
+	
+	if (RankedOrder == DisplayedSessionOrder)
+	{
+		return;
+	}
+	
+	ClearSessionsScrollBox();
+	for (const FString& Key : RankedOrder)
+	{
+		AddSessionDataWidget(ActiveSessionWidgets[Key]);
+	}
+	
+	DisplayedSessionOrder = MoveTemp(RankedOrder);
+}
+
+void USikHudWidget::OnSessionLatenciesUpdatedCallback()
+{
+	if (bCanFindNewSessions)
+	{
+		RankSessionsList();
+	}
+}
+
 void USikHudWidget::FindNewSessionsIfAllowed()
 {
 	if (bCanFindNewSessions)
@@ -347,14 +508,15 @@ void USikHudWidget::FindNewSessionsIfAllowed()
 			return;
 		}
 
+		/** Same query keeps the running schedule, a changed filter restarts polling with the new query */
 		if (GetSikSubsystem())
 		{
-			SikSubsystem->FindSessions();
+			SikSubsystem->StartSessionBrowserPolling(SikSubsystem->MakeSessionBrowserQuery(GetCurrentSessionsFilter()));
 		}
 	}
 }
 
-void USikHudWidget::JoinTheGivenSession(FOnlineSessionSearchResult& InSessionToJoin)
+void USikHudWidget::JoinTheGivenSession(const FSikSessionHandle& InSessionToJoin)
 {
 	LOG_INFO(TEXT("Called"));
 	
@@ -366,12 +528,13 @@ void USikHudWidget::JoinTheGivenSession(FOnlineSessionSearchResult& InSessionToJ
 	
 	ShowMessage(FString("Joining room"));
 	
-	bJoinSessionViaCode = false;
 	bCanFindNewSessions = false;
 	
+	/** Subsystem stops the browser and cancels the running search itself once the join is queued */
 	if (GetSikSubsystem())
 	{
-        SikSubsystem->CancelFindSessions();
+		/** Hosts travel to LobbyMapPath after creating the session, so that is the map the client is going to load */
+		SikSubsystem->PreloadTravelMaps(LobbyMapPath);
 		SikSubsystem->JoinSessions(InSessionToJoin);
 	}
 }
@@ -416,12 +579,24 @@ void USikHudWidget::StartFindingSessions()
 	
 	LastSessionKeys.Empty();
 	
+	DisplayedSessionOrder.Empty();
+	
 	SetFindSessionsThrobberVisibility(ESlateVisibility::Visible);
 	
-	if (GetSikSubsystem())
+	if (!GetSikSubsystem())
 	{
-		SikSubsystem->FindSessions();
+		return;
 	}
+	
+	/** Show the last snapshot right away, UpdateSessionsList then starts polling to revalidate it */
+	const FSikSessionQuery Query = SikSubsystem->MakeSessionBrowserQuery(GetCurrentSessionsFilter());
+	if (const FSikSessionSearchSnapshotPtr CachedResults = SikSubsystem->GetCachedSearchResults(Query))
+	{
+		UpdateSessionsList(CachedResults.ToSharedRef());
+		return;
+	}
+	
+	SikSubsystem->StartSessionBrowserPolling(Query);
 }
 
 void USikHudWidget::StopFindingSessions()
@@ -436,7 +611,36 @@ void USikHudWidget::StopFindingSessions()
 	
 	LastSessionKeys.Empty();
 	
+	DisplayedSessionOrder.Empty();
+	
 	SetFindSessionsThrobberVisibility(ESlateVisibility::Visible);
+	
+	if (GetSikSubsystem())
+	{
+		SikSubsystem->StopSessionBrowserPolling();
+	}
+}
+
+void USikHudWidget::LoadMoreSessions()
+{
+	if (!bCanFindNewSessions || !GetSikSubsystem())
+	{
+		return;
+	}
+	
+	/** Rows already listed are kept by UpdateSessionsList, the larger search only adds the sessions not seen yet */
+	if (SikSubsystem->RequestMoreSessionResults())
+	{
+		LOG_INFO(TEXT("Requested more sessions"));
+	}
+}
+
+void USikHudWidget::OnSessionsScrolled(float CurrentOffset)
+{
+	if (SessionsScrollBox && CurrentOffset >= SessionsScrollBox->GetScrollOffsetOfEnd() - LoadMoreScrollThreshold)
+	{
+		LoadMoreSessions();
+	}
 }
 
 TObjectPtr<USikSubsystem> USikHudWidget::GetSikSubsystem()
@@ -8,6 +8,8 @@
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "GameMode/SikLobbyGameMode.h"
+#include "GameMode/SikLobbyGameState.h"
+#include "GameMode/SikLobbyPlayerState.h"
 #include "Online/OnlineSessionNames.h"
 #include "System/SikLogger.h"
 
@@ -34,6 +36,19 @@ bool USikLobbyWidget::Initialize()
         {
             bIsHost = PC->HasAuthority();
         }
+
+        if (bIsHost)
+        {
+            if (ASikLobbyGameState* LobbyGameState = GetLobbyGameState())
+            {
+                LobbyGameState->OnMapPrefetchChanged.AddUObject(this, &ThisClass::OnMapPrefetchChanged);
+            }
+        }
+    }
+
+    if (MapPrefetchText)
+    {
+        MapPrefetchText->SetVisibility(bIsHost ? ESlateVisibility::Visible : ESlateVisibility::Hidden);
     }
 
     if (StartGameButton && PlayersCountDataHb)
@@ -71,6 +86,11 @@ void USikLobbyWidget::NativeDestruct()
     }
 
     ASikLobbyGameMode::OnLobbyPlayersChangedGlobal.RemoveAll(this);
+
+    if (ASikLobbyGameState* LobbyGameState = GetLobbyGameState())
+    {
+        LobbyGameState->OnMapPrefetchChanged.RemoveAll(this);
+    }
     
     Super::NativeDestruct();
 }
@@ -112,6 +132,11 @@ void USikLobbyWidget::OnLobbyPlayersChangedGlobal(const uint32 CurrentPlayers)
         }
     }
     
+    if (bIsHost)
+    {
+        OnMapPrefetchChanged(nullptr);
+    }
+    
     if (bIsOtherSessionSettingsSet)
     {
         return;
@@ -125,31 +150,34 @@ void USikLobbyWidget::OnLobbyPlayersChangedGlobal(const uint32 CurrentPlayers)
         : SessionCodeText->SetText(FText::FromString(TEXT("------")));
     }
     
+    FSikPackedSessionSettings PackedSettings;
+    const bool bHasSettings = SikSubsystem->GetSessionSchemaSettings(PackedSettings);
+    const FSikCustomSessionSettings Settings = FSikSessionSchema::ToReadable(PackedSettings);
+    
     if (SessionVisibilityText)
     {
-        FString Setting;
-        SikSubsystem->GetSessionSetting(SETTING_SESSION_VISIBILITY, Setting)
-        ? SessionVisibilityText->SetText(FText::FromString(Setting))
+        bHasSettings
+        ? SessionVisibilityText->SetText(FText::FromString(Settings.Visibility))
         : SessionVisibilityText->SetText(FText::FromString(TEXT("------")));
     }
     
     if (GameModeText)
     {
-        FString Setting;
-        SikSubsystem->GetSessionSetting(SETTING_GAMEMODE, Setting)
-        ? GameModeText->SetText(FText::FromString(Setting))
+        bHasSettings && !Settings.GameMode.IsEmpty()
+        ? GameModeText->SetText(FText::FromString(Settings.GameMode))
         : GameModeText->SetText(FText::FromString(TEXT("------")));
     }
     
     if (MapNameText)
     {
-        FString Setting;
-        SikSubsystem->GetSessionSetting(SETTING_MAPNAME, Setting)
-        ? MapNameText->SetText(FText::FromString(Setting))
+        bHasSettings && !Settings.MapName.IsEmpty()
+        ? MapNameText->SetText(FText::FromString(Settings.MapName))
         : MapNameText->SetText(FText::FromString(TEXT("------")));
     }
     
     bIsOtherSessionSettingsSet = true;
+
+    PrefetchSelectedMap();
 }
 
 void USikLobbyWidget::OnStartGameClicked()
@@ -204,6 +232,49 @@ void USikLobbyWidget::OnSessionStartedCallback(bool bWasSuccessful)
     }
 }
 
+void USikLobbyWidget::OnMapPrefetchChanged(const ASikLobbyPlayerState* PlayerState)
+{
+    const ASikLobbyGameState* LobbyGameState = GetLobbyGameState();
+    if (!MapPrefetchText || !LobbyGameState)
+    {
+        return;
+    }
+
+    const FString PrefetchString = FString::Printf(TEXT("Map ready %d / %d"), 
+        LobbyGameState->GetNumPlayersReadyForMap(), LobbyGameState->PlayerArray.Num());
+    MapPrefetchText->SetText(FText::FromString(PrefetchString));
+}
+
+void USikLobbyWidget::PrefetchSelectedMap()
+{
+    if (!bIsHost || !MapNameText)
+    {
+        return;
+    }
+
+    const FString* MapPath = MapPaths.Find(MapNameText->GetText().ToString());
+    if (!MapPath)
+    {
+        LOG_WARNING(TEXT("MapPaths does not contain the selected map, nothing to prefetch"));
+        return;
+    }
+
+    if (ASikLobbyGameState* LobbyGameState = GetLobbyGameState())
+    {
+        LobbyGameState->SetPrefetchMapPath(*MapPath);
+    }
+    else
+    {
+        LOG_WARNING(TEXT("Lobby map does not use ASikLobbyGameState, match map is not prefetched"));
+    }
+}
+
+ASikLobbyGameState* USikLobbyWidget::GetLobbyGameState() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetGameState<ASikLobbyGameState>() : nullptr;
+}
+
 TObjectPtr<USikSubsystem> USikLobbyWidget::GetSikSubsystem()
 {
     if (IsValid(SikSubsystem))
@@ -26,13 +26,12 @@ void USikSessionDataWidget::OnJoinSessionButtonClicked()
 		return;
 	}
 	
-	SikHudWidget->JoinTheGivenSession(SessionSearchResult);
+	SikHudWidget->JoinTheGivenSession(SessionHandle);
 }
 
-void USikSessionDataWidget::SetSessionInfo(const FOnlineSessionSearchResult& InSessionSearchResultRef, 
-	const FSikCustomSessionSettings& SessionSettings)
+void USikSessionDataWidget::SetSessionInfo(const FSikSessionHandle& InSessionHandle, const FSikCustomSessionSettings& SessionSettings)
 {
-	SessionSearchResult = InSessionSearchResultRef;
+	SessionHandle = InSessionHandle;
 	
 	MapName->SetText(FText::FromString(SessionSettings.MapName));
 	Players->SetText(FText::FromString(SessionSettings.Players));
@@ -43,3 +42,11 @@ void USikSessionDataWidget::SetSikHudWidget(USikHudWidget* InSikHudWidget)
 {
 	SikHudWidget = InSikHudWidget;
 }
+
+void USikSessionDataWidget::SetPing(int32 InPingInMs)
+{
+	if (!Ping)
+		return;
+	
+	Ping->SetText(InPingInMs < 0 ? FText::FromString(TEXT("-")) : FText::FromString(FString::Printf(TEXT("%d ms"), InPingInMs)));
+}
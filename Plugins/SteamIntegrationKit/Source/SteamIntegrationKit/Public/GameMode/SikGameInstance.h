@@ -0,0 +1,20 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/GameInstance.h"
+#include "SikGameInstance.generated.h"
+
+/**
+ * Game instance using USikOnlineSession, so a dropped client stays in its world while USikSubsystem reconnects
+ * Set as GameInstanceClass of the project, or return USikOnlineSession from a game instance of its own
+ ******************************************************************************************/
+UCLASS(Blueprintable, BlueprintType)
+class STEAMINTEGRATIONKIT_API USikGameInstance : public UGameInstance
+{
+	GENERATED_BODY()
+
+public:
+	virtual TSubclassOf<UOnlineSession> GetOnlineSessionClass() override;
+};
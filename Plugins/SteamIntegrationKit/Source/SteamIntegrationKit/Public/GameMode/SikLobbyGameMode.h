@@ -11,6 +11,7 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnLobbyPlayersChanged, uint32);
 /**
  * Game mode for the lobby map, if any user joins or leave then updates that data
  * So that host can start session only when the required no of players are present
+ * On a dedicated server there is no host, the match starts once the lobby is full, see USikSubsystem::IsDedicatedServer
  ******************************************************************************************/
 UCLASS(Blueprintable, BlueprintType, ClassGroup=GameMode)
 class STEAMINTEGRATIONKIT_API ASikLobbyGameMode : public AGameModeBase
@@ -18,7 +19,7 @@ class STEAMINTEGRATIONKIT_API ASikLobbyGameMode : public AGameModeBase
 	GENERATED_BODY()
 	
 public:
-	/** Default Constructor to enable seamless travel */
+	/** Default Constructor to enable seamless travel and use the lobby game state and player state for the map prefetch */
 	ASikLobbyGameMode(const FObjectInitializer& ObjectInitializer);
 	
 	/** Delegate UI (USikLobbyWidget) will bind to */
@@ -34,6 +35,9 @@ protected:
 	virtual void Logout(AController* ExitingController) override;
 	
 private:
+	/** Hands the player count to USikSubsystem on a dedicated server, which starts the match once the lobby is full */
+	void NotifyDedicatedServer() const;
+
 	/** Stores the current no of players present in the lobby */
 	uint32 CurrentLobbyPlayers = 0;
 };
@@ -0,0 +1,73 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/GameStateBase.h"
+#include "SikLobbyGameState.generated.h"
+
+class ASikLobbyPlayerState;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLobbyMapPrefetchChanged, const ASikLobbyPlayerState*);
+
+/**
+ * Game state for the lobby map, replicates the match map the host is going to travel to
+ * So that every lobby member loads it in the background while waiting, instead of all of them loading it cold on travel
+ * Each member reports its load progress through its ASikLobbyPlayerState
+ ******************************************************************************************/
+UCLASS(Blueprintable, BlueprintType, ClassGroup=GameMode)
+class STEAMINTEGRATIONKIT_API ASikLobbyGameState : public AGameStateBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/**
+	 * Tells every lobby member to prefetch the given map, host only
+	 * 
+	 * @param InMapPath: Map the host will ServerTravel to
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Map Prefetch")
+	void SetPrefetchMapPath(const FString& InMapPath);
+
+	/** Returns the map lobby members are prefetching, empty until the host knows it */
+	UFUNCTION(BlueprintPure, Category = "Map Prefetch")
+	const FString& GetPrefetchMapPath() const { return PrefetchMapPath; }
+
+	/**
+	 * Returns how many lobby members have the match map ready to travel to
+	 * Members that cannot prefetch (ESikMapPrefetchState::Skipped) or failed to are not waited on and count as ready
+	 */
+	UFUNCTION(BlueprintPure, Category = "Map Prefetch")
+	int32 GetNumPlayersReadyForMap() const;
+
+	/** Broadcasts whenever any lobby member reports new prefetch progress */
+	FOnLobbyMapPrefetchChanged OnMapPrefetchChanged;
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	/** 
+	 * Starts the local prefetch when the host sets or changes the map
+	 * 
+	 * @param OldPrefetchMapPath: Map prefetched before, released so only the selected match map is held in memory
+	 */
+	UFUNCTION()
+	void OnRep_PrefetchMapPath(const FString& OldPrefetchMapPath);
+
+	/** Polls the local prefetch and reports it through the local player's player state until the map is ready */
+	void ReportLocalMapPrefetch();
+
+	/** Map lobby members should load in the background */
+	UPROPERTY(ReplicatedUsing = OnRep_PrefetchMapPath)
+	FString PrefetchMapPath;
+
+	/** Seconds between two polls of the local prefetch progress */
+	UPROPERTY(EditDefaultsOnly, Category = "Map Prefetch")
+	float PrefetchReportInterval = 0.25f;
+
+	/** Timer to poll the local prefetch progress */
+	FTimerHandle PrefetchReportTimer;
+};
@@ -0,0 +1,60 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/PlayerState.h"
+#include "Subsystem/SikSubsystem.h"
+#include "SikLobbyPlayerState.generated.h"
+
+/**
+ * Player state for the lobby map, replicates how far this player has got loading the match map
+ * So that the host can see who is ready before starting the match, see ASikLobbyGameState
+ ******************************************************************************************/
+UCLASS(Blueprintable, BlueprintType, ClassGroup=GameMode)
+class STEAMINTEGRATIONKIT_API ASikLobbyPlayerState : public APlayerState
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/**
+	 * Reports the local prefetch of the match map to the server, only sends when the state or whole percent changed
+	 * 
+	 * @param InState: Where the prefetch stands
+	 * @param InProgress: Load progress from 0 to 1
+	 */
+	void ReportMapPrefetch(ESikMapPrefetchState InState, float InProgress);
+
+	/** Returns where this player's prefetch of the match map stands */
+	UFUNCTION(BlueprintPure, Category = "Map Prefetch")
+	ESikMapPrefetchState GetMapPrefetchState() const { return MapPrefetchState; }
+
+	/** Returns this player's load progress of the match map, from 0 to 100 */
+	UFUNCTION(BlueprintPure, Category = "Map Prefetch")
+	int32 GetMapPrefetchPercent() const { return MapPrefetchPercent; }
+
+private:
+	/** Owning client sends its prefetch progress to the server */
+	UFUNCTION(Server, Reliable)
+	void ServerReportMapPrefetch(ESikMapPrefetchState InState, uint8 InPercent);
+
+	/** Tells the lobby game state so the host UI can refresh */
+	UFUNCTION()
+	void OnRep_MapPrefetch();
+
+	/** Where this player's prefetch of the match map stands */
+	UPROPERTY(ReplicatedUsing = OnRep_MapPrefetch)
+	ESikMapPrefetchState MapPrefetchState = ESikMapPrefetchState::None;
+
+	/** Load progress of the match map from 0 to 100 */
+	UPROPERTY(ReplicatedUsing = OnRep_MapPrefetch)
+	uint8 MapPrefetchPercent = 0;
+
+	/** Last state sent to the server, owning client only */
+	ESikMapPrefetchState LastReportedState = ESikMapPrefetchState::None;
+
+	/** Last percent sent to the server, owning client only */
+	uint8 LastReportedPercent = 0;
+};
@@ -0,0 +1,22 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/OnlineSession.h"
+#include "SikOnlineSession.generated.h"
+
+/**
+ * Online session of the game instance, lets USikSubsystem reconnect before the engine leaves the world of a lost connection
+ * Without it the engine travels to the default map on every client disconnect and each reconnect attempt starts from there
+ * Used by USikGameInstance, a game instance of its own returns it from GetOnlineSessionClass the same way
+ ******************************************************************************************/
+UCLASS()
+class STEAMINTEGRATIONKIT_API USikOnlineSession : public UOnlineSession
+{
+	GENERATED_BODY()
+
+public:
+	/** Hands the disconnect to the engine only if USikSubsystem is not reconnecting, see USikSubsystem::DeferDisconnect */
+	virtual void HandleDisconnect(UWorld* World, UNetDriver* NetDriver) override;
+};
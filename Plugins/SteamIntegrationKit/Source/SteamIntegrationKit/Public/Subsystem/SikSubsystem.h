@@ -5,13 +5,110 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Interfaces/OnlineSessionInterface.h"
+#include "OnlineSessionSettings.h"
+#include "PartyBeaconState.h"
+#include "Engine/TimerHandle.h"
+#include "Misc/Optional.h"
+#include "System/SikPollScheduler.h"
+#include "System/SikLatencyProbe.h"
+#include "System/SikMatchmaker.h"
+#include "System/SikMatchmakingClient.h"
+#include "System/SikSessionMetrics.h"
+#include "System/SikFlightRecorder.h"
+#include "System/SikSessionSchema.h"
+#include "System/SikSessionSnapshot.h"
+#include "System/SikSessionTask.h"
 #include "SikSubsystem.generated.h"
 
-#define SETTING_NUMPLAYERSREQUIRED FName("NumPlayers") 
+class FSikMockOnlineSession;
+struct FSikMockBackendSettings;
+class AOnlineBeaconHost;
+class APartyBeaconClient;
+class APartyBeaconHost;
+
 #define SETTING_FILTERSEED FName("FilterSeed")
 #define SETTING_FILTERSEED_VALUE 94311
-#define SETTING_SESSION_VISIBILITY FName("Visibility")
-#define SETTING_SESSION_CODELENGTH 6
+#define SETTING_SESSION_CODELENGTH 9
+/** Length of the random codes of backends without a lookup by id, see FSikSessionCode::GenerateShortCode */
+#define SETTING_SESSION_SHORTCODELENGTH 6
+#define SETTING_FILTER_ANY FString("Any")
+#define SETTING_PARTY FName("SikParty")
+#define SETTING_PARTY_GAMECODE FName("PartyGameCode")
+/** Load of a dedicated server from 0 to 100, the higher of its player fill and its game thread time against the frame budget */
+#define SETTING_SERVERLOAD FName("SikServerLoad")
+/** Port the host answers latency probes on, see FSikUdpEchoServer */
+#define SETTING_LATENCYECHOPORT FName("SikEchoPort")
+/** Steam relay ping location of the host, clients estimate their latency from it, see FSikSteamPingLocation */
+#define SETTING_PINGLOCATION FName("SikPingLocation")
+
+/** Transport USikSubsystem measures the latency to session hosts with, see ISikLatencyProbe */
+UENUM(BlueprintType)
+enum class ESikLatencyProbeTransport : uint8
+{
+	/** Ping reported by the backend along with the search results, estimated from SETTING_PINGLOCATION for Steam lobbies reporting none */
+	Backend,
+	/** Round trip to the echo endpoint each host runs on LatencyProbeEchoPort, hosts without an IP address get the backend ping */
+	UdpEcho
+};
+
+/** Where the background load of a map stands, see USikSubsystem::GetMapPreloadState */
+UENUM(BlueprintType)
+enum class ESikMapPrefetchState : uint8
+{
+	None,
+	Loading,
+	Ready,
+	Failed,
+	/** Preloading is off or not possible in this world (PIE), the map loads on travel */
+	Skipped
+};
+
+/** How USikSubsystem::QuickMatch or USikSubsystem::StartMatchmaking ended */
+UENUM(BlueprintType)
+enum class ESikMatchResult : uint8
+{
+	/** Joined the session picked for the player, travelling to it is up to the caller */
+	Joined,
+	/** Picked to host, the session was created and travelling to the lobby is up to the caller */
+	Hosted,
+	Failed,
+	Cancelled
+};
+
+/** Transport USikSubsystem talks to the matchmaker through, see ISikMatchmakerConnection */
+UENUM(BlueprintType)
+enum class ESikMatchmakerTransport : uint8
+{
+	/** Matchmaker of this process, only there if it was started with -SikMatchmakerServer */
+	InProcess,
+	/** Matchmaker server at MatchmakerAddress, started with -SikMatchmakerServer or -run=SikMatchmaker */
+	Udp
+};
+
+/** Backend query a browse search of USikSubsystem runs, the results of every pass are merged into one list */
+enum class ESikSessionSearchPass : uint8
+{
+	/** LAN beacon, answered by the hosts on the local network */
+	Lan,
+	Lobbies,
+	/** Dedicated servers, advertised as game servers instead of lobbies */
+	Servers
+};
+
+/** Where the session of a dedicated server stands, see USikSubsystem::IsDedicatedServer */
+enum class ESikDedicatedServerStage : uint8
+{
+	/** No session, one is created once the lobby map is loaded */
+	Idle,
+	Creating,
+	/** Session advertised, waiting in the lobby for it to fill */
+	Lobby,
+	/** Lobby full, starting the session and travelling to the match map */
+	Starting,
+	InMatch,
+	/** Destroying the session of the last match before advertising a fresh one */
+	Resetting
+};
 
 #pragma region Custom Delegates
 
@@ -20,17 +117,29 @@
  */
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMultiplayerSessionsOnCreateSessionComplete, bool, bWasSuccessful);
+/** FSikSessionSearchSnapshot is not USTRUCT so we cannot use DYNAMIC keyword here */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FMultiplayerSessionsOnFindSessionsComplete, const FSikSessionSearchSnapshotRef& SessionResults, bool bWasSuccessful);
 /** FOnlineSessionSearchResult is not UCLASS so we cannot use DYNAMIC keyword here */
-DECLARE_MULTICAST_DELEGATE_TwoParams(FMultiplayerSessionsOnFindSessionsComplete, const TArray<FOnlineSessionSearchResult>& SessionResults, bool bWasSuccessful);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FMultiplayerSessionsOnFindSessionByCodeComplete, const FOnlineSessionSearchResult& SessionResult, bool bWasSuccessful);
 /** EOnJoinSessionCompleteResult is not UCLASS so we cannot use DYNAMIC keyword here */
 DECLARE_MULTICAST_DELEGATE_OneParam(FMultiplayerSessionsOnJoinSessionsComplete, EOnJoinSessionCompleteResult::Type Result);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMultiplayerSessionsOnDestroySessionComplete, bool, bWasSuccessful);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMultiplayerSessionsOnStartSessionComplete, bool, bWasSuccessful);
+DECLARE_MULTICAST_DELEGATE(FMultiplayerSessionsOnSessionLatenciesUpdated);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FMultiplayerSessionsOnNamedSessionOperationComplete, FName, SessionName, 
+	ESikSessionOperation, Operation, ESikSessionOperationResult, Result);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMultiplayerSessionsOnReconnectStarted, int32, MaxAttempts);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMultiplayerSessionsOnReconnectComplete, bool, bWasSuccessful);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FMultiplayerSessionsOnSessionOperationComplete, ESikSessionOperation, Operation, 
+	ESikSessionOperationResult, Result);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMultiplayerSessionsOnQuickMatchComplete, ESikMatchResult, Result);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMultiplayerSessionsOnMatchmakingComplete, ESikMatchResult, Result);
 
 #pragma endregion Custom Delegates
 
 /**
  * Structure to store all the settings to be set while creating a session
+ * Readable form used by the UI and Blueprint, sent over the backend as FSikPackedSessionSettings
  ******************************************************************************************/
 USTRUCT(Blueprintable, BlueprintType)
 struct FSikCustomSessionSettings
@@ -54,11 +163,153 @@ struct FSikCustomSessionSettings
 	FString Visibility = FString("");
 };
 
+/**
+ * Structure describing which sessions the user wants to see in the session browser
+ * Translated into backend query terms by USikSubsystem::FindSessions so that only matching lobbies are returned
+ ******************************************************************************************/
+USTRUCT(Blueprintable, BlueprintType)
+struct FSikSessionQuery
+{
+	GENERATED_BODY()
+
+	/** Map the session must be hosted on, "Any" to accept every map */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Query")
+	FString MapName = SETTING_FILTER_ANY;
+
+	/** Game mode the session must be running, "Any" to accept every game mode */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Query")
+	FString GameMode = SETTING_FILTER_ANY;
+
+	/** Players configuration ("1v1", "2v2", "4v4") of the session, "Any" to accept every configuration */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Query")
+	FString Players = SETTING_FILTER_ANY;
+
+	/** When true private sessions are excluded from the results */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Query")
+	bool bPublicOnly = true;
+
+	/** Minimum number of open public slots a session must have to be returned */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Query")
+	int32 MinOpenSlots = 1;
+
+	/** Max number of sessions the backend is allowed to return */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Query")
+	int32 MaxSearchResults = 200;
+
+	/** Builds a query out of the filter the user has selected in the session browser */
+	static FSikSessionQuery FromFilter(const FSikCustomSessionSettings& InFilter);
+
+	/** @returns true if map, game mode and players are all set so the packed schema value can be used as the filter bucket key */
+	bool IsFullySpecified() const;
+
+	/** Queries are equal when they would send the same filter terms to the backend, the result limit is left out */
+	bool operator==(const FSikSessionQuery& Other) const;
+
+	/** @returns true if a search with this query returns everything the other one would, same filters and at least as many results */
+	bool Covers(const FSikSessionQuery& Other) const;
+};
+
+/**
+ * Session operation waiting in the USikSubsystem queue along with what it needs to run
+ ******************************************************************************************/
+struct FSikQueuedSessionOperation
+{
+	/** Operation to run */
+	ESikSessionOperation Operation = ESikSessionOperation::None;
+
+	/** Session the operation runs on, NAME_GameSession or NAME_PartySession */
+	FName SessionName = NAME_GameSession;
+
+	/** Settings to create the session with, used by Create only */
+	FSikCustomSessionSettings CreateSettings;
+
+	/** Session to join, used by Join only */
+	FOnlineSessionSearchResult SessionToJoin;
+
+	/** Number of members the party is created for, used by Create of NAME_PartySession only */
+	int32 MaxPartyMembers = 0;
+
+	/** True if the join follows the party leader into its game session, the subsystem travels instead of the UI */
+	bool bFollowParty = false;
+
+	/** True once the session in the way has been destroyed for this operation, so it is not destroyed twice */
+	bool bDestroyedExistingSession = false;
+
+	/** True once Join asked the host for its slots, whether granted or skipped, so it is not asked twice */
+	bool bSlotReservationRequested = false;
+
+	/** Result the backend reported, set by Join once it completes */
+	EOnJoinSessionCompleteResult::Type JoinResult = EOnJoinSessionCompleteResult::UnknownError;
+
+	/** Tasks awaiting the outcome, including the ones of requests merged into this one */
+	TArray<TSharedRef<FSikSessionTask>> Tasks;
+
+	/** 
+	 * True if requested through an Async function, dropped from the queue once every task awaiting it is cancelled
+	 * Its outcome goes to the tasks only, the UI would otherwise act on it a second time
+	 */
+	bool bAwaited = false;
+
+	/** True if requested by the quick match or the matchmaking of USikSubsystem, its outcome is reported to them instead of the UI */
+	bool bMatchFlow = false;
+
+	/** True if the join re-joins the last joined session for a reconnect, the subsystem travels instead of the UI */
+	bool bReconnect = false;
+};
+
+/**
+ * FindSessionsAsync call waiting on a browse search of USikSubsystem
+ ******************************************************************************************/
+struct FSikAwaitedSessionSearch
+{
+	/** Query the task asked for */
+	FSikSessionQuery Query;
+
+	/** Id of the search the task completes with, 0 until a search covering the query is started */
+	uint32 SearchId = 0;
+
+	/** Task awaiting the search, kept alive by the subsystem until it completes */
+	TWeakPtr<FSikSessionTask> Task;
+};
+
+/**
+ * Session code lookup waiting in the USikSubsystem queue along with who requested it
+ ******************************************************************************************/
+struct FSikSessionCodeLookup
+{
+	/** Code to look up */
+	FString SessionCode;
+
+	/** Task the result goes to, see FindSessionByCodeAsync */
+	TWeakPtr<FSikSessionTask> Task;
+
+	/** True if requested through FindSessionByCodeAsync, the result is not broadcast even once the task is gone */
+	bool bAwaited = false;
+
+	/** True if a member follows the party leader into its game session, the result goes to FollowPartyIntoGameSession */
+	bool bFollowParty = false;
+
+	/** Id the lookup runs under, a late callback of an abandoned lookup carries an older one */
+	uint32 LookupId = 0;
+};
+
+/**
+ * Measured latency to a session host and when it was measured
+ ******************************************************************************************/
+struct FSikHostLatency
+{
+	/** Round trip time in ms, negative if the host could not be measured */
+	int32 PingInMs = -1;
+
+	/** Time the latency was measured at */
+	double MeasuredTime = 0.0;
+};
+
 /**
  * Class to handle all the session operations
  * Being a subsystem of game instance this can be called from anywhere
  ******************************************************************************************/
-UCLASS(ClassGroup = (Subsystem))
+UCLASS(ClassGroup = (Subsystem), Config = Game)
 class STEAMINTEGRATIONKIT_API USikSubsystem : public UGameInstanceSubsystem
 {
 	GENERATED_BODY()
@@ -79,10 +330,35 @@ public:
 	 */
 	FMultiplayerSessionsOnCreateSessionComplete MultiplayerSessionsOnCreateSessionComplete;
 	FMultiplayerSessionsOnFindSessionsComplete MultiplayerSessionsOnFindSessionsComplete;
+	FMultiplayerSessionsOnFindSessionByCodeComplete MultiplayerSessionsOnFindSessionByCodeComplete;
 	FMultiplayerSessionsOnJoinSessionsComplete MultiplayerSessionsOnJoinSessionsComplete;
 	FMultiplayerSessionsOnDestroySessionComplete MultiplayerSessionsOnDestroySessionComplete;
 	FMultiplayerSessionsOnStartSessionComplete MultiplayerSessionsOnStartSessionComplete;
 	
+	/** Broadcast once every probe started for the last search results has completed */
+	FMultiplayerSessionsOnSessionLatenciesUpdated MultiplayerSessionsOnSessionLatenciesUpdated;
+	
+	/** 
+	 * Outcome of every create, destroy, join and start request on the game session, including the ones merged or dropped by the queue
+	 * Like the per operation delegates above it ignores the party session, see MultiplayerSessionsOnNamedSessionOperationComplete
+	 */
+	FMultiplayerSessionsOnSessionOperationComplete MultiplayerSessionsOnSessionOperationComplete;
+	
+	/** Outcome of every request on any session, along with the name of the session it ran on */
+	FMultiplayerSessionsOnNamedSessionOperationComplete MultiplayerSessionsOnNamedSessionOperationComplete;
+	
+	/** Broadcast when a transient network failure starts a reconnect to the last joined session instead of leaving it */
+	FMultiplayerSessionsOnReconnectStarted MultiplayerSessionsOnReconnectStarted;
+	
+	/** Broadcast when the client is back in the session, or has given up and left it */
+	FMultiplayerSessionsOnReconnectComplete MultiplayerSessionsOnReconnectComplete;
+	
+	/** Broadcast once QuickMatch has joined or hosted a session, or has given up */
+	FMultiplayerSessionsOnQuickMatchComplete MultiplayerSessionsOnQuickMatchComplete;
+
+	/** Broadcast once StartMatchmaking has joined or hosted the session of its match, or has given up */
+	FMultiplayerSessionsOnMatchmakingComplete MultiplayerSessionsOnMatchmakingComplete;
+	
 #pragma endregion Custom Delegates Declaration
 	
 #pragma region Session Operations
@@ -90,6 +366,7 @@ public:
 public:
 	/**
 	 * Creates a session for the host to join, Called from USikHUDWidget::HostGame
+	 * Queued behind running operations, replaces a create or join still waiting and destroys the active session first
 	 *
 	 * @param InCustomSessionSettings: Custom session settings to create the session with
 	 */
@@ -102,143 +379,1535 @@ public:
 	void FindSessions();
 
 	/**
-	 * Called from USikSubsystem::HandleAppExit and USikHUDWidget::JoinTheGivenSession
-	 * Stops if any session finding operation is active
+	 * Finds sessions matching the given query, the filters are sent to the backend as query terms
+	 * so that sessions which the user will never see are not returned at all
+	 *
+	 * Results are cached for SearchResultsCacheTTL seconds, while the cached snapshot is fresh no request is made,
+	 * it is broadcast on the next tick and the refresh is scheduled for when it turns stale
+	 * Calls made while a search is running share it instead of cancelling it
+	 *
+	 * @param InQuery: Filters to search the sessions with
 	 */
-	void CancelFindSessions();
-	
+	void FindSessions(const FSikSessionQuery& InQuery);
+
 	/**
-	 * Called from USikHUDWidget to join the session requested by the client
+	 * @returns the last search results for the given query, fresh or stale, nullptr if there are none
+	 * 
+	 * @param InQuery: Query the results were searched with
+	 */
+	FSikSessionSearchSnapshotPtr GetCachedSearchResults(const FSikSessionQuery& InQuery) const;
+
+	/**
+	 * Called from USikHUDWidget when the browse menu opens or its filter changes
+	 * Keeps searching with the given query, paced by the poll scheduler, results arrive through MultiplayerSessionsOnFindSessionsComplete
+	 * Calling it again with the same query keeps the current schedule
 	 *
-	 *  @param InSessionToJoin: Passed by the client after selecting the appropriate session he wishes to join
+	 * @param InQuery: Filters to search the sessions with
 	 */
-	void JoinSessions(FOnlineSessionSearchResult& InSessionToJoin);
+	void StartSessionBrowserPolling(const FSikSessionQuery& InQuery);
 
-	/** Called from USikLobbyWidget::OnStartGameClicked to start the actual session */
-	void StartSession();
-	
-private:
-	/** Destroys the currently active session */
-	void DestroySession();
+	/** Called from USikHUDWidget when the browse menu closes or a session is being joined */
+	void StopSessionBrowserPolling();
 
-#pragma endregion Session Operations
+	/**
+	 * Called from USikHUDWidget::LoadMoreSessions when the session list is scrolled to its end
+	 * Grows the polled result limit by SessionSearchResultStep, up to MaxRetainedSearchResults
+	 * 
+	 * This is not paging, lobby searches have no offset, the whole search runs again with the larger limit
+	 * and every later poll keeps asking for that many results, so each step costs a full search of the new size
+	 * Sessions already listed keep their rows, USikHudWidget only adds the ones it has not seen
+	 *
+	 * @returns true if more results were requested, false if every session is listed or the cap is reached
+	 */
+	bool RequestMoreSessionResults();
 
-#pragma region Session Operation Complete Delegates
+	/**
+	 * @returns the query the session browser starts polling with for the given filter, limited to SessionSearchResultStep results
+	 * 
+	 * @param InFilter: Filter the user has selected in the session browser
+	 */
+	FSikSessionQuery MakeSessionBrowserQuery(const FSikCustomSessionSettings& InFilter) const;
 
-private:
 	/**
-	 * Delegates for session interface to bind to so that we can get a callback on any session operation completion
+	 * Called from USikHUDWidget::EnterCode to find the one session hosted with the given code
+	 * Codes carrying a lobby id are decoded and looked up by id without any search,
+	 * otherwise or if the backend cannot look up by id an equality query on the session key limited to a single result is issued
+	 * Result is broadcast through MultiplayerSessionsOnFindSessionByCodeComplete,
+	 * a lookup requested while another one is in flight waits for it to complete
+	 *
+	 * @param InSessionCode: Session code entered by the user
 	 */
-	
-	FOnCreateSessionCompleteDelegate CreateSessionCompleteDelegate;
-	FDelegateHandle CreateSessionCompleteDelegateHandle;
-	
-	FOnFindSessionsCompleteDelegate FindSessionsCompleteDelegate;
-	FDelegateHandle FindSessionsCompleteDelegateHandle;
-	
-	FOnJoinSessionCompleteDelegate JoinSessionCompleteDelegate;
-	FDelegateHandle JoinSessionCompleteDelegateHandle;
-	
-	FOnDestroySessionCompleteDelegate DestroySessionCompleteDelegate;
-	FDelegateHandle DestroySessionCompleteDelegateHandle;
-	
-	FOnStartSessionCompleteDelegate StartSessionCompleteDelegate;
-	FDelegateHandle StartSessionCompleteDelegateHandle;
-		
-#pragma endregion Session Operation Complete Delegates
-	
-#pragma region Session Operations On Completion Delegates Callbacks
-	
+	void FindSessionByCode(const FString& InSessionCode);
+
 private:
-	/** Called when a session is successfully created */
-	void OnCreateSessionCompleteCallback(FName SessionName, bool bWasSuccessful);
+	/** Fallback of FindSessionByCode, searches for the session advertising the given code as its session key */
+	void FindSessionBySessionKey(const FString& InSessionCode);
 
-	/** Called when sessions with given session settings are found */
-	void OnFindSessionsCompleteCallback(bool bWasSuccessful);
+	/** Cancels the running session key search, browse searches are left alone as none runs alongside a key search */
+	void CancelSessionCodeSearch();
 
-	/** Called when a session is joined */
-	void OnJoinSessionCompleteCallback(FName SessionName, EOnJoinSessionCompleteResult::Type Result);
+	/** Runs PendingSessionSearchQuery once neither a browse search nor a code lookup is in flight */
+	void RunPendingSessionSearch();
 
-	/** Called when a session is destroyed */
-	void OnDestroySessionCompleteCallback(FName SessionName, bool bWasSuccessful);
+	/** Queues the query to run once the search or code lookup in flight completes, merged with a pending one of the same filters */
+	void SetPendingSessionSearch(const FSikSessionQuery& InQuery);
 
-	/** Called when a session is destroyed */
-	void OnStartSessionCompleteCallback(FName SessionName, bool bWasSuccessful);
-	
-#pragma endregion Session Operations On Completion Delegates Callbacks
+	/** Drops the pending query, the FindSessionsAsync tasks waiting on it complete with Cancelled */
+	void ResetPendingSessionSearch();
 
-#pragma region Defaults
-	
-private:
 	/**
-	 * This variable acts an access point to OnlineSubsystem's session interface
-	 *
-	 * Using this variable only I will be able to call for creation, destruction, joining and finding of sessions
-	 * Initialized in the constructor
+	 * Cancels the FindSessionsAsync tasks left without a search once a pending query is dropped
+	 * 
+	 * @param InDroppedQuery: Pending query that will not run
+	 * @param InReplacementQuery: Query pending in its place, tasks it covers keep waiting, null if none
 	 */
-	IOnlineSessionPtr SessionInterface;
+	void CancelAwaitedPendingSessionSearches(const FSikSessionQuery& InDroppedQuery, const FSikSessionQuery* InReplacementQuery);
 
-	/** Callback that calls HandleAppExit in case of any network connection failure */
-	UFUNCTION()
-	void HandleNetworkFailure(UWorld* World, UNetDriver* NetDriver, ENetworkFailure::Type FailureType, 
-		const FString& ErrorString);
+	/** Broadcasts the cached snapshot on the next tick, calls within the same tick broadcast once */
+	void BroadcastCachedSearchResults();
+
+	/** Runs the lookup right away, or once the lookups in flight and queued before it have completed */
+	void EnqueueSessionCodeLookup(FSikSessionCodeLookup&& InLookup);
+
+	/** Body of FindSessionByCode, looks the code up by id or falls back to the session key search */
+	void RunSessionCodeLookup(FSikSessionCodeLookup&& InLookup);
+
+	/** Runs the next queued lookup once none is in flight */
+	void RunNextSessionCodeLookup();
+
+	/** Closes the code lookup span and hands the result to whoever requested the lookup */
+	void CompleteFindSessionByCode(const FOnlineSessionSearchResult& InSessionResult, bool bWasSuccessful);
+
+	/** Issues the backend search for the given query, called by FindSessions once cache and in flight search are ruled out */
+	void StartSessionSearch(const FSikSessionQuery& InQuery);
+
+	/** 
+	 * Issues the next pass of the running browse search, skipping the ones the backend refuses
+	 * 
+	 * @return false if no pass is left to run
+	 */
+	bool StartSessionSearchPass();
+
+	/** Cancels the running pass once the search is over its budget and completes it with the results of the passes done */
+	void ExpireSessionSearchBudget();
+
+	/** Stops the budget timer of the running browse search */
+	void ClearSessionSearchBudgetTimer();
+
+	/** @returns the backend search of the given pass for the query */
+	TSharedRef<FOnlineSessionSearch> MakeSessionSearch(const FSikSessionQuery& InQuery, ESikSessionSearchPass InPass) const;
+
+	/** @returns the passes a search runs on the current backend, see ESikSessionSearchPass */
+	TArray<ESikSessionSearchPass> GetSessionSearchPasses() const;
+
+	/** Sets what the backend searches for in the given pass, LAN, lobbies or game servers */
+	void ApplySessionSearchPass(FOnlineSessionSearch& OutSearch, ESikSessionSearchPass InPass) const;
+
+	/** Flags the results of a game server search as dedicated, joining them must not go through the lobby path */
+	static void MarkDedicatedSearchResults(FOnlineSessionSearch& InOutSearch);
+
+	/** 
+	 * Issues the next pass of the running session key search, skipping the ones the backend refuses
+	 * 
+	 * @return false if no pass is left to run
+	 */
+	bool StartSessionCodeSearchPass();
+
+	/** Poll timer callback, searches with the session browser query unless a search is running or the rate limit applies */
+	void PollSessionBrowser();
 
 	/**
-	 * Called in case of network failure or if player exits the game or any similar scenario
-	 * Destroys any active session and cancels if the find session is in progress
+	 * Called when a browse search completes, asks the poll scheduler for the delay and arms the poll timer
+	 * 
+	 * @param InCompletedQuery: Query of the completed search, ignored unless it is the session browser query
+	 * @param bWasSuccessful: True if the search succeeded
+	 * @param InResults: Results of the search, nullptr if there are none
 	 */
-	void HandleAppExit();
+	void ScheduleNextSessionBrowserPoll(const FSikSessionQuery& InCompletedQuery, bool bWasSuccessful, 
+		const TArray<FOnlineSessionSearchResult>* InResults);
 
 	/**
-	 * Generates and returns a random unique code to create a session with
-	 * For the clients to later search and join a session with this unique code
-	 *
-	 * Appends the time in minutes, seconds and milliseconds and returns it as session code
-	 *
-	 * NOTE: Under extremely rare circumstances the generated code may not be unique and there might be a session with same codes
+	 * Freezes the results of a search into the next generation of snapshot
 	 * 
-	 * @return an FSting with a random unique code
+	 * @param InResults: Results of the search, moved from
 	 */
-	static FString GenerateSessionUniqueCode();
+	FSikSessionSearchSnapshotRef MakeSessionSearchSnapshot(TArray<FOnlineSessionSearchResult>&& InResults);
 
-	/** True if subsystem is finding sessions */
-	bool bFindSessionsInProgress = false;
-	
-	/** Stores the last created session search to get the search results */
-	TSharedPtr<FOnlineSessionSearch> LastCreatedSessionSearch;
+	/** @returns the result limit after the steps requested so far, capped at MaxRetainedSearchResults */
+	int32 GetSessionBrowserResultLimit() const;
+
+	/** Arms the poll timer to fire after the given delay */
+	void SetSessionBrowserPollTimer(float InDelay);
+
+	/** @returns seconds left before another browse search may be issued, zero or negative if it may be issued now */
+	double GetSessionSearchRateLimitWait() const;
+
+	/** Runs FindSessions with the given query after the delay unless a refresh is already scheduled for it */
+	void ScheduleSessionSearchRefresh(const FSikSessionQuery& InQuery, float InDelay);
+
+	/** @returns seconds since the cached results of the given query were fetched, negative if there are none */
+	double GetCachedSearchResultsAge(const FSikSessionQuery& InQuery) const;
+
+	/** @returns the fresh cached search result advertising the given session code, invalid if there is none */
+	FSikSessionHandle FindCachedSessionByCode(const FString& InSessionCode) const;
+
+public:
+	/**
+	 * Called from USikSubsystem::HandleAppExit and when a join is queued
+	 * Stops if any session finding operation is active
+	 * Listeners of MultiplayerSessionsOnFindSessionsComplete hear back unsuccessful, with an empty snapshot
+	 */
+	void CancelFindSessions();
 	
-	/** True when user requests to create a new session but the last created session is already active */
-	bool bCreateSessionOnDestroy = false;
+	/**
+	 * Called from USikHUDWidget to join the session requested by the client
+	 * Queued like CreateSession, also stops the session browser and cancels the running search
+	 *
+	 *  @param InSessionToJoin: Passed by the client after selecting the appropriate session he wishes to join
+	 */
+	void JoinSessions(const FOnlineSessionSearchResult& InSessionToJoin);
 
 	/**
-	 * When a session is already active player selects to create a new session then this will store the settings
-	 * As we will have to destroy the active session and then create a new one 
+	 * Called from USikHUDWidget to join a session of the browser, the session is copied once into the queued join
+	 *
+	 * @param InSessionToJoin: Session the client selected, nothing is queued if the handle is invalid
 	 */
-	FSikCustomSessionSettings SessionSettingsForTheSessionToCreateAfterDestruction;
+	void JoinSessions(const FSikSessionHandle& InSessionToJoin);
+
+	/** Called from USikLobbyWidget::OnStartGameClicked to start the actual session, repeated clicks are merged */
+	void StartSession();
 	
+private:
 	/** 
-	 * @returns true if the session is in the given state
-	 * @param State The session state to check
+	 * Queues the destruction of the given session 
+	 * 
+	 * @param InSessionName: Session to destroy, NAME_GameSession or NAME_PartySession
 	 */
-	bool IsSessionInState(EOnlineSessionState::Type State) const;
-	
-#pragma endregion Defaults
-	
-#pragma region Getter
-	
+	void DestroySession(FName InSessionName = NAME_GameSession);
+
+	/** Moves the session into a queued join, shared by both JoinSessions */
+	void EnqueueJoinSession(FOnlineSessionSearchResult&& InSessionToJoin);
+
+	/** Operation bodies run by ProcessNextSessionOperation, each ends with a call to FinishSessionOperation */
+	void ExecuteCreateSession(const FSikCustomSessionSettings& InCustomSessionSettings);
+	void ExecuteJoinSession(FOnlineSessionSearchResult& InSessionToJoin);
+	void ExecuteDestroySession();
+	void ExecuteStartSession();
+
+#pragma endregion Session Operations
+
+#pragma region Session Latency
+
+public:
+	/**
+	 * @returns the cached round trip time to the host of the given session in ms, negative if it is not measured
+	 * 
+	 * @param InSearchResult: Session to get the latency of
+	 */
+	int32 GetSessionLatency(const FOnlineSessionSearchResult& InSearchResult) const;
+
+	/**
+	 * Orders the sessions by the cached latency to their host, lowest first, unmeasured hosts keep their order at the end
+	 * The sessions are left as found, read the latency with GetSessionLatency
+	 * 
+	 * @param InOutSessions: Sessions to rank
+	 */
+	void RankSessionsByLatency(TArray<FSikSessionHandle>& InOutSessions) const;
+
+private:
+	/** Queues a probe for every host of the given sessions whose latency is not cached or has gone stale */
+	void ProbeSessionLatencies(const TArray<FOnlineSessionSearchResult>& InSearchResults);
+
+	/** Starts queued probes until MaxInFlightLatencyProbes are in flight, broadcasts once all have completed */
+	void PumpLatencyProbes();
+
+	/** Caches the measured latency of the host and starts the next probe */
+	void OnLatencyProbeCompleteCallback(int32 PingInMs, FString HostKey);
+
+	/** Writes the cached latency of its host into PingInMs of the given session */
+	void ApplyCachedLatency(FOnlineSessionSearchResult& InOutSearchResult) const;
+
+	/** @returns the key latencies of the host of the given session are cached with */
+	static FString GetSessionHostKey(const FOnlineSessionSearchResult& InSearchResult);
+
+	/** @returns the "ip:port" the host of the given session answers UdpEcho probes on, empty if it advertises none or has no IP */
+	FString GetSessionEchoAddress(const FOnlineSessionSearchResult& InSearchResult) const;
+
+	/** Starts answering latency probes while hosting, @returns true if the echo endpoint is running */
+	bool StartLatencyEchoServer();
+
+	/** Transport used to measure the latencies, created in Initialize */
+	TSharedPtr<ISikLatencyProbe> LatencyProbe;
+
+	/** Echo endpoint answering the UDP probes of other players while a game session is hosted */
+	TUniquePtr<FSikUdpEchoServer> LatencyEchoServer;
+
+	/** Transport used to measure the latency to session hosts */
+	UPROPERTY(Config)
+	ESikLatencyProbeTransport LatencyProbeTransport = ESikLatencyProbeTransport::Backend;
+
+	/** Port hosts answer UdpEcho probes on, advertised with the session under SETTING_LATENCYECHOPORT */
+	UPROPERTY(Config)
+	int32 LatencyProbeEchoPort = 7787;
+
+	/** Seconds after which a probe without answer counts as failed */
+	UPROPERTY(Config)
+	float LatencyProbeTimeout = 2.f;
+
+	/** Max number of probes in flight at once */
+	UPROPERTY(Config)
+	int32 MaxInFlightLatencyProbes = 4;
+
+	/** Seconds a measured latency is reused before the host is probed again */
+	UPROPERTY(Config)
+	float LatencyCacheTTL = 30.f;
+
+	/** Measured latencies keyed by host */
+	TMap<FString, FSikHostLatency> HostLatencyCache;
+
+	/** Probes waiting for a free slot, the ones before QueuedLatencyProbesHead have been started */
+	TArray<FSikLatencyProbeRequest> QueuedLatencyProbes;
+
+	/** Index of the next probe to start in QueuedLatencyProbes */
+	int32 QueuedLatencyProbesHead = 0;
+
+	/** Hosts of the probes waiting in QueuedLatencyProbes */
+	TSet<FString> QueuedLatencyProbeHosts;
+
+	/** Hosts being probed right now */
+	TSet<FString> InFlightLatencyProbes;
+
+	/** True while PumpLatencyProbes is starting probes, completions arriving meanwhile leave the pumping to it */
+	bool bPumpingLatencyProbes = false;
+
+	/** True if a probe completed since the last broadcast */
+	bool bLatencyProbesCompleted = false;
+
+#pragma endregion Session Latency
+
+#pragma region Session Metrics
+
 public:
+	/** @returns the durations of the session operations and flows, see FSikSessionMetrics */
+	FSikSessionMetrics& GetSessionMetrics() { return SessionMetrics; }
+
+	/**
+	 * @returns the rolling p50/p95/p99 durations of the given span, see the SIK_SPAN defines
+	 * 
+	 * @param InSpan: Name of the span, e.g. Sik.Flow.HostGame
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Metrics")
+	FSikLatencyPercentiles GetSessionLatencyPercentiles(FName InSpan) const;
+
+private:
+	/** @returns the span the given queued operation is measured with */
+	static FName GetSessionOperationSpan(ESikSessionOperation InOperation);
+
+	/** Closes the travel spans once a client has loaded the map of the joined session */
+	void OnPostLoadMapWithWorld(UWorld* InLoadedWorld);
+
+	/** Durations of the session operations and flows */
+	FSikSessionMetrics SessionMetrics;
+
+	/** Number of durations per span the percentiles are computed from */
+	UPROPERTY(Config)
+	int32 SessionMetricsWindowSize = 256;
+
+	/** Handle of the PostLoadMapWithWorld binding */
+	FDelegateHandle PostLoadMapDelegateHandle;
+
+#pragma endregion Session Metrics
+
+#pragma region Flight Recorder
+
+public:
+	/** @returns the recorder of the session calls, callbacks and travels, see FSikFlightRecorder */
+	FSikFlightRecorder& GetFlightRecorder() { return FlightRecorder; }
+
+	/**
+	 * Writes the flight recorder to Saved/FlightRecorder, decode it with -run=SikFlightRecorder
+	 * 
+	 * @param InReason: Why it is dumped, part of the file name
+	 * @returns the path of the dump
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Diagnostics")
+	FString DumpFlightRecorder(const FString& InReason);
+
+private:
+	/** @returns the flight recorder subject of the given queued operation */
+	static ESikFlightSubject GetSessionOperationSubject(ESikSessionOperation InOperation);
+
+	/** Dumps the flight recorder after a failure, at most once per FlightRecorderMinDumpInterval */
+	void DumpFlightRecorderOnFailure(const FString& InReason);
+
+	/** Records the failed travel and dumps the flight recorder */
+	void HandleTravelFailure(UWorld* World, ETravelFailure::Type FailureType, const FString& ErrorString);
+
+	/** Mutable as IsSessionInState records the states it sees */
+	mutable FSikFlightRecorder FlightRecorder;
+
+	/** Number of events the flight recorder keeps, 16 bytes each */
+	UPROPERTY(Config)
+	int32 FlightRecorderCapacity = 4096;
+
+	/** Dumps the flight recorder when a join, travel or the network connection fails */
+	UPROPERTY(Config)
+	bool bDumpFlightRecorderOnFailure = true;
+
+	/** Min seconds between two dumps triggered by failures, failures in a row are covered by the first dump */
+	UPROPERTY(Config)
+	float FlightRecorderMinDumpInterval = 10.f;
+
+	/** Time of the last dump triggered by a failure */
+	double LastFlightRecorderDumpTime = -UE_BIG_NUMBER;
+
+#pragma endregion Flight Recorder
+
+#pragma region Map Preload
+
+public:
+	/**
+	 * Starts loading the given map in the background so travelling to it does not wait for the full load
+	 * Also preloads the transition map if bPreloadTransitionMap is set, does nothing in PIE or if bPreloadTravelMaps is off
+	 * 
+	 * The loaded worlds are kept until the travel has loaded the map, the travel or the session fails or the player leaves
+	 * LoadMap finds them in memory, a travel starting before the load completes waits on the same request instead of loading again
+	 * 
+	 * @param InMapPath: Map to preload, travel options after '?' are ignored
+	 */
+	void PreloadTravelMaps(const FString& InMapPath);
+
+	/** Drops the preloaded map worlds, and ignores preloads still in flight, so they can be garbage collected */
+	void ReleasePreloadedMaps();
+
+	/** 
+	 * Drops the preloaded world of the given map only, the transition map and other preloads are kept
+	 * 
+	 * @param InMapPath: Map passed to PreloadTravelMaps, travel options after '?' are ignored
+	 */
+	void ReleasePreloadedMap(const FString& InMapPath);
+
+	/** True if PreloadTravelMaps actually loads anything in this world */
+	bool CanPreloadMaps() const;
+
+	/**
+	 * Returns how far the preload of the given map has got
+	 * 
+	 * @param InMapPath: Map passed to PreloadTravelMaps, travel options after '?' are ignored
+	 * @param OutProgress: Load progress from 0 to 1, 1 once ready
+	 */
+	ESikMapPrefetchState GetMapPreloadState(const FString& InMapPath, float& OutProgress) const;
+
+private:
+	/** Strips the travel options and returns the package name of the map, NAME_None if it is not a long package name */
+	static FName GetMapPackageName(const FString& InMapPath);
+
+	/** Issues the async load of the given map package unless it is already loaded or loading */
+	void PreloadMapPackage(const FString& InMapPath);
+
+	/** Keeps the world of the loaded package referenced until the travel is done */
+	void OnMapPreloadComplete(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result);
+
+	/** @returns the world of the given map package, following a world redirector, nullptr if it holds none */
+	static UWorld* FindPreloadedWorld(UPackage* InPackage);
+
+	/** @returns the preloaded world of the given map package, nullptr if it is not preloaded */
+	UWorld* GetPreloadedWorld(const FName& InPackageName) const;
+
+	/** 
+	 * Worlds of the preloaded maps, referenced so garbage collection during travel does not drop them
+	 * The world is held rather than its package, a package does not reference the objects it contains, like seamless travel does
+	 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UWorld>> PreloadedMapWorlds;
+
+	/** Map packages being loaded along with the time their load was issued */
+	TMap<FName, double> PendingMapPreloads;
+
+	/** Map packages whose preload failed, until the preloads are released */
+	TSet<FName> FailedMapPreloads;
+
+	/** Preloads the lobby map as soon as the player hosts or joins, and the match map while waiting in the lobby */
+	UPROPERTY(Config)
+	bool bPreloadTravelMaps = true;
+
+	/** Also preloads the transition map of seamless travel, see UGameMapsSettings::TransitionMap */
+	UPROPERTY(Config)
+	bool bPreloadTransitionMap = true;
+
+#pragma endregion Map Preload
+
+#pragma region Reconnect
+
+public:
+	/** @returns true while the client is trying to get back into the last joined session */
+	UFUNCTION(BlueprintPure, Category = "Reconnect")
+	bool IsReconnecting() const { return ReconnectAttempt > 0; }
+
+	/** Stops reconnecting and leaves the session, as if the reconnect had run out of attempts */
+	UFUNCTION(BlueprintCallable, Category = "Reconnect")
+	void CancelReconnect();
+
+	/**
+	 * Called from USikOnlineSession::HandleDisconnect before the engine leaves the world of a failed connection
+	 * While reconnecting the client stays in that world, the travel to the default map waits until the attempts run out
+	 * 
+	 * @return true if the disconnect is held off, the engine's own handling is skipped in that case
+	 */
+	bool DeferDisconnect(UWorld* InWorld, UNetDriver* InNetDriver);
+
+private:
+	/**
+	 * Starts reconnecting to the last joined session if the failure is one the connection can recover from
+	 * The engine's disconnect handling runs after the failure delegate, held off by DeferDisconnect while reconnecting
+	 * 
+	 * @return true if a reconnect was started or is already running, the session is kept in that case
+	 */
+	bool TryStartReconnect(const UWorld* World, ENetworkFailure::Type FailureType);
+
+	/** Waits the backoff delay of the next attempt, or gives up once ReconnectMaxAttempts is used up */
+	void ScheduleReconnectAttempt();
+
+	/** 
+	 * Travels back to the resolved connect string of the last joined session
+	 * Joins LastJoinedSession again first if the local session was dropped while disconnected
+	 */
+	void ExecuteReconnectAttempt();
+
+	/** 
+	 * Ends the reconnect, leaves the session if it failed
+	 * 
+	 * @param bWasSuccessful: True if the client is back in the session's map
+	 * @param bLeaveSession: False if the player has already moved on to another session, only used if it failed
+	 */
+	void FinishReconnect(bool bWasSuccessful, bool bLeaveSession = true);
+
+	/** Forgets the last joined session, called when the player creates or leaves a session on purpose */
+	void ClearReconnectTarget();
+
+	/** Session last joined successfully, joined again without a search if the reconnect finds the local session gone */
+	TOptional<FOnlineSessionSearchResult> LastJoinedSession;
+
+	/** Connect string resolved when LastJoinedSession was joined */
+	FString LastJoinedConnectString;
+
+	/** Number of the running reconnect attempt, 0 if not reconnecting */
+	int32 ReconnectAttempt = 0;
+
+	/** True between the travel of an attempt and its success or failure, so one failed attempt is counted once */
+	bool bReconnectAttemptInFlight = false;
+
+	/** True once DeferDisconnect held off the engine's disconnect handling, a failed reconnect then travels to the default map */
+	bool bDisconnectDeferred = false;
+
+	/** Timer for the backoff delay before the next attempt */
+	FTimerHandle ReconnectTimerHandle;
+
+	/** Reconnects to the last joined session on connection loss or timeout instead of leaving it */
+	UPROPERTY(Config)
+	bool bReconnectOnNetworkFailure = true;
+
+	/** Attempts made before leaving the session */
+	UPROPERTY(Config)
+	int32 ReconnectMaxAttempts = 4;
+
+	/** Seconds before the first attempt, doubled for every attempt after it */
+	UPROPERTY(Config)
+	float ReconnectInitialDelay = 0.5f;
+
+	/** Upper bound of the delay between two attempts */
+	UPROPERTY(Config)
+	float ReconnectMaxDelay = 8.f;
+
+	/** Random fraction of the delay added or removed so clients dropped together do not reconnect in lockstep */
+	UPROPERTY(Config)
+	float ReconnectJitterFraction = 0.2f;
+
+#pragma endregion Reconnect
+
+#pragma region Party
+
+public:
+	/**
+	 * Creates the party session next to the game session, friends join it through invites
+	 * The party outlives matches, whenever its leader ends up in a game session the members follow into it
+	 * 
+	 * @param InMaxMembers: Number of players the party can hold, leader included
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Party")
+	void CreateParty(int32 InMaxMembers = 4);
+
+	/**
+	 * Joins the given party session, called when an invite to a party is accepted
+	 * 
+	 * @param InPartyToJoin: Party session to join
+	 */
+	void JoinParty(const FOnlineSessionSearchResult& InPartyToJoin);
+
+	/** Leaves the party session, the game session is kept */
+	UFUNCTION(BlueprintCallable, Category = "Party")
+	void LeaveParty();
+
+	/** @returns true if the player is in a party session */
+	UFUNCTION(BlueprintPure, Category = "Party")
+	bool IsInParty() const;
+
+	/** @returns true if the player hosts the party session, only the leader decides which game session the party is in */
+	UFUNCTION(BlueprintPure, Category = "Party")
+	bool IsPartyLeader() const;
+
+private:
+	/** Body of a create on NAME_PartySession, run by ExecuteCreateSession */
+	void ExecuteCreateParty(int32 InMaxMembers);
+
+	/** Called on the leader once it is in a game session, advertises the session's code on the party session */
+	void PublishPartyGameSession();
+
+	/** Called on members when the party session settings change, follows the leader into its new game session */
+	void OnSessionSettingsUpdated(FName SessionName, const FOnlineSessionSettings& UpdatedSettings);
+
+	/** Joins the party when an invite to it is accepted, invites to game sessions are left to the game */
+	void OnSessionUserInviteAccepted(const bool bWasSuccessful, const int32 ControllerId, FUniqueNetIdPtr UserId, 
+		const FOnlineSessionSearchResult& InviteResult);
+
+	/** Joins the game session the party leader is in once the lookup of its code completes */
+	void FollowPartyIntoGameSession(const FOnlineSessionSearchResult& InSessionResult, bool bWasSuccessful);
+
+	/** Handles of the session interface delegates the party relies on */
+	FDelegateHandle SessionSettingsUpdatedDelegateHandle;
+	FDelegateHandle SessionUserInviteAcceptedDelegateHandle;
+
+	/** Game session code last advertised on the party session by the leader, or followed by a member */
+	FString PartyGameSessionCode;
+
+#pragma endregion Party
+
+#pragma region LAN
+
+public:
+	/**
+	 * Switches between the online backend and LAN sessions discovered by broadcast on the local network
+	 * LAN runs on Steam when it is signed in and on the Null subsystem otherwise, so it works without any network
+	 * Refused while a session exists or an operation is queued, and while the mock backend is in use
+	 * 
+	 * @param bInLanMode: True to host and find LAN sessions
+	 * @return true if the subsystem is in the requested mode
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LAN")
+	bool SetLanMode(bool bInLanMode);
+
+	/** @returns true if sessions are hosted and found on the local network */
+	UFUNCTION(BlueprintPure, Category = "LAN")
+	bool IsLanMode() const { return bLanMode; }
+
+	/**
+	 * Switches to a fresh mock backend, so automation tests and tools drive the session flows without a platform
+	 * Refused while a session exists or an operation is queued, same as SetLanMode
+	 * 
+	 * @param InSettings: Settings the mock backend synthesizes its lobbies and answers with
+	 * @return the mock backend now in use, nullptr if the switch was refused
+	 */
+	TSharedPtr<FSikMockOnlineSession, ESPMode::ThreadSafe> UseMockBackend(const FSikMockBackendSettings& InSettings);
+
+private:
+	/** @returns true if no session exists and no operation or code lookup is running, so the session interface can be swapped */
+	bool CanSwitchSessionInterface() const;
+
+	/** Drops the searches and cached results of the session interface being swapped out */
+	void ResetSessionSearchState();
+
+	/** 
+	 * @returns the session interface LAN sessions run on, nullptr if none is available
+	 * 
+	 * @param OutSubsystemName: Name of the online subsystem the interface belongs to
+	 */
+	static IOnlineSessionPtr ResolveLanSessionInterface(FName& OutSubsystemName);
+
+	/** Points the subsystem to the given session interface and moves the session event bindings over to it */
+	void SetSessionInterface(const IOnlineSessionPtr& InSessionInterface);
+
+	/** True while the session interface is the LAN one, set by SetLanMode, bStartInLanMode or -SikLan */
+	bool bLanMode = false;
+
+	/** Online subsystem the LAN session interface belongs to, Steam or Null */
+	FName LanSubsystemName;
+
+	/** Starts in LAN mode, the -SikLan command line switch does the same */
+	UPROPERTY(Config)
+	bool bStartInLanMode = false;
+
+	/**
+	 * Seconds a LAN search collects answers before completing, hosts on the local network answer within a few ms
+	 * Sent as the timeout of the search, 0 keeps the backend's own
+	 */
+	UPROPERTY(Config)
+	float LanSearchResultWindow = 0.08f;
+
+	/**
+	 * Lists the LAN hosts Steam finds next to the online sessions, the browser runs a LAN pass ahead of the lobby one
+	 * Off by default, it adds a search to every poll, LAN mode (bStartInLanMode, SetLanMode) lists them on its own
+	 */
+	UPROPERTY(Config)
+	bool bMergeLanSessions = false;
+
+#pragma endregion LAN
+
+#pragma region Session Tasks
+
+public:
+	/**
+	 * Awaitable versions of the session operations, each returns a handle completing with the outcome of that one call
+	 * Their outcome is not broadcast through the per operation delegates above, so a UI bound to them does not join or travel
+	 * a second time, MultiplayerSessionsOnSessionOperationComplete still reports them
+	 * 
+	 * A timeout of zero or less uses SessionTaskTimeout, a backend that does not call back within it
+	 * has its operation abandoned so the queue and the search flags do not stay stuck
+	 */
+	FSikSessionTaskHandle CreateSessionAsync(const FSikCustomSessionSettings& InCustomSessionSettings, float InTimeout = 0.f);
+	FSikSessionTaskHandle JoinSessionAsync(const FOnlineSessionSearchResult& InSessionToJoin, float InTimeout = 0.f);
+	FSikSessionTaskHandle StartSessionAsync(float InTimeout = 0.f);
+
+	/** 
+	 * Completes with the sessions found for the query, served from the cache while it is fresh, see FindSessions
+	 * The task is tied to the one search started for its query, results of any other search are not taken for it
+	 */
+	FSikSessionTaskHandle FindSessionsAsync(const FSikSessionQuery& InQuery, float InTimeout = 0.f);
+
+	/** Completes with the session hosted with the given code, see FindSessionByCode, the lookup is not broadcast */
+	FSikSessionTaskHandle FindSessionByCodeAsync(const FString& InSessionCode, float InTimeout = 0.f);
+
+	/**
+	 * Travels the first local player to the game session it has joined
+	 * 
+	 * @return false if there is no player or the session address could not be resolved
+	 */
+	bool TravelToJoinedSession();
+
+private:
+	/** Creates a task completing with TimedOut once the timeout elapses, kept alive by the subsystem until it completes */
+	TSharedRef<FSikSessionTask> MakeSessionTask(const FString& InDescription, float InTimeout);
+
+	/** Queues the operation with a task awaiting it */
+	FSikSessionTaskHandle EnqueueAwaitedSessionOperation(FSikQueuedSessionOperation&& InOperation, float InTimeout);
+
+	/** 
+	 * Stops awaiting a queued operation, the operation is dropped if nothing else awaits it and it has not started yet
+	 * A running operation is abandoned on timeout, its backend callback is never coming
+	 */
+	void AbortSessionOperationTask(const TSharedRef<FSikSessionTask>& InTask, ESikSessionOperationResult InResult);
+
+	/** Abandons the running operation whose backend callback did not arrive in time and moves on to the next one */
+	void TimeOutActiveSessionOperation();
+
+	/** 
+	 * Stops listening for the running operation's backend callback, reports it failed and moves on to the next one
+	 * 
+	 * @param InResult: Outcome reported for the abandoned operation
+	 */
+	void AbandonActiveSessionOperation(ESikSessionOperationResult InResult);
+
+	/** Abandons the code lookup whose backend callback did not arrive in time */
+	void TimeOutFindSessionByCode();
+
+	/**
+	 * Completes the FindSessionsAsync tasks tied to the given search
+	 * 
+	 * @param InSearchId: Id of the search that ended
+	 * @param InSnapshot: Sessions it found
+	 * @param InResult: How it ended
+	 */
+	void CompleteAwaitedSessionSearches(uint32 InSearchId, const FSikSessionSearchSnapshotRef& InSnapshot, ESikSessionOperationResult InResult);
+
+	/** Completes every pending task with Cancelled, called on shutdown */
+	void CancelSessionTasks();
+
+	/** Tasks not completed yet */
+	TArray<TSharedRef<FSikSessionTask>> PendingSessionTasks;
+
+	/** Seconds an awaited operation may take when the caller does not pass a timeout */
+	UPROPERTY(Config)
+	float SessionTaskTimeout = 30.f;
+
+	/** FindSessionsAsync tasks waiting on a browse search */
+	TArray<FSikAwaitedSessionSearch> AwaitedSessionSearches;
+
+#pragma endregion Session Tasks
+
+#pragma region Quick Match
+
+public:
+	/**
+	 * Joins the best session matching the query, or hosts a matching one if nothing fits before the deadline
+	 * Candidates are scored by the latency to their host, how full they are and how close they are to QuickMatchHostSettings,
+	 * a failed join moves on to the next candidate and the search is repeated while there is time left
+	 * Outcome is broadcast through MultiplayerSessionsOnQuickMatchComplete, travelling is left to the caller
+	 * 
+	 * @param InQuery: Sessions to consider, fields left at "Any" are taken from QuickMatchHostSettings when hosting
+	 * @param InDeadline: Time to look for a session before hosting one, a join still running at the deadline is waited for
+	 */
+	UFUNCTION(BlueprintCallable, Category = "QuickMatch")
+	void QuickMatch(const FSikSessionQuery& InQuery, FTimespan InDeadline);
+
+	/** Stops the quick match, a join or create the backend is already running carries on but is not reported */
+	UFUNCTION(BlueprintCallable, Category = "QuickMatch")
+	void CancelQuickMatch();
+
+	/** @returns true while a quick match is looking for, joining or hosting a session */
+	UFUNCTION(BlueprintPure, Category = "QuickMatch")
+	bool IsQuickMatching() const { return bQuickMatching; }
+
+private:
+	/** Searches for candidates with the time left, hosts once the deadline has passed */
+	void SearchQuickMatchCandidates();
+
+	/** Ranks the sessions found and joins the best one, searches again after QuickMatchRetryInterval if none fits */
+	void OnQuickMatchCandidatesFound(const FSikSessionTaskResult& InResult);
+
+	/** Joins the best candidate not tried yet, searches again once all have been tried */
+	void JoinNextQuickMatchCandidate();
+
+	/** Ends the quick match once joined, moves on to the next candidate or hosts otherwise */
+	void OnQuickMatchJoinComplete(const FSikSessionTaskResult& InResult);
+
+	/** Creates a session matching the query, the fields it leaves at "Any" are taken from QuickMatchHostSettings */
+	void HostQuickMatch();
+
+	/** Ends the quick match with the outcome of the create */
+	void OnQuickMatchHostComplete(const FSikSessionTaskResult& InResult);
+
+	/** Deadline timer callback, hosts right away unless a join is running, that one is waited for */
+	void OnQuickMatchDeadline();
+
+	/**
+	 * @returns the score of the session from 0 to 1, higher is better
+	 * 
+	 * @param InSearchResult: Session to score, already known to match the query
+	 * @param InSettings: Settings read out of the session
+	 */
+	float ScoreQuickMatchCandidate(const FOnlineSessionSearchResult& InSearchResult, const FSikPackedSessionSettings& InSettings) const;
+
+	/**
+	 * Tracks the step as the running one of the quick match or the dedicated server, the given function is called once it completes 
+	 * unless the step was replaced or dropped meanwhile
+	 * 
+	 * @param InStepSlot: Member holding the running step of the flow
+	 * @param InStep: Step to track
+	 * @param InOnComplete: Called with the outcome of the step
+	 */
+	void RunMatchFlowStep(FSikSessionTaskHandle USikSubsystem::* InStepSlot, const FSikSessionTaskHandle& InStep, 
+		void (USikSubsystem::*InOnComplete)(const FSikSessionTaskResult&));
+
+	/** 
+	 * Cancels the running step of a flow without moving the flow on
+	 * 
+	 * @param InStepSlot: Member holding the running step of the flow
+	 */
+	void CancelMatchFlowStep(FSikSessionTaskHandle USikSubsystem::* InStepSlot);
+
+	/** Fills the fields left empty with the first entry of the schema tables, 1v1 for the players */
+	void FillUnsetSessionSettings(FSikCustomSessionSettings& InOutSettings) const;
+
+	/** @returns seconds left before the deadline, zero or negative once it has passed */
+	double GetQuickMatchTimeLeft() const;
+
+	/** Ends the quick match and broadcasts its outcome */
+	void FinishQuickMatch(ESikMatchResult InResult);
+
+	/** True between QuickMatch and its outcome */
+	bool bQuickMatching = false;
+
+	/** True while a candidate is being joined, the deadline waits for the join instead of hosting */
+	bool bQuickMatchJoining = false;
+
+	/** Query of the running quick match */
+	FSikSessionQuery QuickMatchQuery;
+
+	/** Time the quick match stops looking and hosts */
+	double QuickMatchDeadlineTime = 0.0;
+
+	/** Candidates of the last search not tried yet, best first */
+	TArray<FSikSessionHandle> QuickMatchCandidates;
+
+	/** Ids of the sessions already tried, not joined again by later searches */
+	TSet<FString> QuickMatchTriedSessions;
+
+	/** Search, join or create the quick match is waiting on */
+	FSikSessionTaskHandle QuickMatchStep;
+
+	/** Timers of the deadline and of the next search */
+	FTimerHandle QuickMatchDeadlineTimerHandle;
+	FTimerHandle QuickMatchRetryTimerHandle;
+
+	/** Weights of the latency, fill and settings scores of a candidate, relative to each other */
+	UPROPERTY(Config)
+	float QuickMatchPingWeight = 0.5f;
+	UPROPERTY(Config)
+	float QuickMatchFillWeight = 0.3f;
+	UPROPERTY(Config)
+	float QuickMatchSettingsWeight = 0.2f;
+
+	/** Latency in ms that scores zero, lower latencies score linearly higher, hosts not measured yet score half */
+	UPROPERTY(Config)
+	int32 QuickMatchMaxPing = 200;
+
+	/** Number of the best candidates of a search that are tried before searching again */
+	UPROPERTY(Config)
+	int32 QuickMatchMaxCandidates = 5;
+
+	/** Seconds between two searches while no candidate fits */
+	UPROPERTY(Config)
+	float QuickMatchRetryInterval = 1.f;
+
+	/**
+	 * Settings the player prefers, ranks candidates on the fields the query leaves at "Any" and fills those fields when hosting
+	 * Empty fields have no preference
+	 */
+	UPROPERTY(Config)
+	FSikCustomSessionSettings QuickMatchHostSettings;
+
+#pragma endregion Quick Match
+
+#pragma region Matchmaking
+
+public:
+	/**
+	 * Enqueues the player with the matchmaker, which groups players of the same region and close skill
+	 * One member of a match is told to host, it creates a private session and reports its code once in the lobby,
+	 * the others look the code up and join
+	 * Outcome is broadcast through MultiplayerSessionsOnMatchmakingComplete, travelling is left to the caller
+	 * 
+	 * @param InRegion: Players are only matched within the same region
+	 * @param InSkill: Skill rating, the skill difference accepted widens while the player waits
+	 * @param InPreferences: Preferred settings, empty fields accept every value, visibility is ignored
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Matchmaking")
+	void StartMatchmaking(const FString& InRegion, int32 InSkill, const FSikCustomSessionSettings& InPreferences);
+
+	/** Leaves the queue, a host that has not reported its session yet sends the other members back to the queue */
+	UFUNCTION(BlueprintCallable, Category = "Matchmaking")
+	void CancelMatchmaking();
+
+	/** @returns true while matchmaking is waiting for, joining or hosting a match */
+	UFUNCTION(BlueprintPure, Category = "Matchmaking")
+	bool IsMatchmaking() const { return MatchmakingClient.IsValid() && MatchmakingClient->IsMatchmaking(); }
+
+private:
+	/** Hosts and joins the match through the session operations and reads the settings below */
+	friend class FSikMatchmakingClient;
+
+	/** Talks to the matchmaker and follows the player's ticket, created on Initialize */
+	TUniquePtr<FSikMatchmakingClient> MatchmakingClient;
+
+	/** Matchmaker served to other processes, started with -SikMatchmakerServer */
+	TUniquePtr<FSikMatchmakerServer> MatchmakerServer;
+
+	/** InProcess only matches players if this process serves the matchmaker, StartMatchmaking fails right away otherwise */
+	UPROPERTY(Config)
+	ESikMatchmakerTransport MatchmakerTransport = ESikMatchmakerTransport::InProcess;
+
+	/** Matchmaker server the Udp transport talks to, -SikMatchmakerServer and -run=SikMatchmaker listen on its port */
+	UPROPERTY(Config)
+	FString MatchmakerAddress = FString("127.0.0.1:7788");
+
+	/** 
+	 * Lets the matchmaker server take requests from other machines, it only listens on loopback otherwise
+	 * Tickets and reports are not authenticated, keep it off unless the port is firewalled to the game's own hosts
+	 */
+	UPROPERTY(Config)
+	bool bMatchmakerServerBindAny = false;
+
+	/** Seconds between two polls of the ticket, well within MatchmakerTicketTimeout */
+	UPROPERTY(Config)
+	float MatchmakerPollInterval = 0.5f;
+
+	/** Seconds matchmaking waits for a match before failing */
+	UPROPERTY(Config)
+	float MatchmakingTimeout = 120.f;
+
+	/** Tuning of the matchmaker served by this process, see FSikMatchmakerSettings */
+	UPROPERTY(Config)
+	float MatchmakerBatchInterval = 1.f;
+	UPROPERTY(Config)
+	int32 MatchmakerSkillWindow = 100;
+	UPROPERTY(Config)
+	float MatchmakerSkillWindowGrowth = 25.f;
+	UPROPERTY(Config)
+	int32 MatchmakerMaxSkillWindow = 1000;
+	UPROPERTY(Config)
+	float MatchmakerTicketTimeout = 10.f;
+	UPROPERTY(Config)
+	float MatchmakerHostReportTimeout = 60.f;
+
+#pragma endregion Matchmaking
+
+#pragma region Dedicated Server
+
+public:
+	/** @returns true if this process is a headless dedicated server, it hosts and advertises its own session */
+	UFUNCTION(BlueprintPure, Category = "DedicatedServer")
+	bool IsDedicatedServer() const { return bDedicatedServer; }
+
+	/**
+	 * Ends the match of a dedicated server, destroys its session, travels back to the lobby and advertises a fresh session
+	 * Called once the match map has been empty for DedicatedServerResetDelay, game modes call it when their match is over
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DedicatedServer")
+	void ResetDedicatedServer();
+
+	/**
+	 * Called by ASikLobbyGameMode on a dedicated server, starts the match once the lobby is full
+	 * 
+	 * @param InNumPlayers: Players in the lobby
+	 */
+	void HandleDedicatedServerLobbyPlayersChanged(int32 InNumPlayers);
+
+private:
+	/** Creates the session once in the lobby map, travels there first if the server was started on another map */
+	void HostDedicatedServerSession();
+
+	/** Tells the lobby to prefetch the match map, retries the create after DedicatedServerRetryInterval on failure */
+	void OnDedicatedServerSessionCreated(const FSikSessionTaskResult& InResult);
+
+	/** Travels to the match map whether or not the backend started the session */
+	void OnDedicatedServerSessionStarted(const FSikSessionTaskResult& InResult);
+
+	/** Advertises a fresh session, from the lobby map */
+	void OnDedicatedServerSessionDestroyed(const FSikSessionTaskResult& InResult);
+
+	/** Load timer callback, advertises the load once it moved by DedicatedServerLoadStep, resets the server once the match is empty */
+	void UpdateDedicatedServerLoad();
+
+	/** @returns the load advertised under SETTING_SERVERLOAD, from 0 to 100 */
+	int32 GetDedicatedServerLoad(int32 InNumPlayers) const;
+
+	/** @returns the number of players on the server */
+	int32 GetDedicatedServerNumPlayers() const;
+
+	/** @returns true if the current world is DedicatedServerLobbyMapPath */
+	bool IsInDedicatedServerLobby() const;
+
+	/** @returns the settings the session is advertised with, DedicatedServerSessionSettings overridden by -SikMap=, -SikGameMode= and -SikPlayers= */
+	FSikCustomSessionSettings GetDedicatedServerSessionSettings() const;
+
+	/** True if IsRunningDedicatedServer, set in Initialize */
+	bool bDedicatedServer = false;
+
+	ESikDedicatedServerStage DedicatedServerStage = ESikDedicatedServerStage::Idle;
+
+	/** Create, start or destroy the dedicated server is waiting on */
+	FSikSessionTaskHandle DedicatedServerStep;
+
+	/** Load last advertised, -1 before the first advertisement */
+	int32 AdvertisedDedicatedServerLoad = -1;
+
+	/** Time the match map became empty, 0 while players are on it */
+	double DedicatedServerEmptySince = 0.0;
+
+	FTimerHandle DedicatedServerLoadTimerHandle;
+	FTimerHandle DedicatedServerRetryTimerHandle;
+
+	/** Lobby map the dedicated server advertises its session from, set ServerDefaultMap to the same map */
+	UPROPERTY(Config)
+	FString DedicatedServerLobbyMapPath;
+
+	/** Match map travelled to once the lobby is full, by map name of the session schema */
+	UPROPERTY(Config)
+	TMap<FString, FString> DedicatedServerMatchMapPaths;
+
+	/** Settings the session is advertised with, empty fields take the first entry of the schema tables */
+	UPROPERTY(Config)
+	FSikCustomSessionSettings DedicatedServerSessionSettings;
+
+	/** Seconds between two load updates */
+	UPROPERTY(Config)
+	float DedicatedServerLoadInterval = 5.f;
+
+	/** Change of the load, in percent, that is advertised again, backends rate limit session updates */
+	UPROPERTY(Config)
+	int32 DedicatedServerLoadStep = 10;
+
+	/** Game thread time of a frame at the server tick rate, in ms, 33.3 at the default NetServerMaxTickRate of 30 */
+	UPROPERTY(Config)
+	float DedicatedServerFrameBudgetMs = 33.3f;
+
+	/** Seconds the match map stays empty before the server resets, leaves time for reconnects */
+	UPROPERTY(Config)
+	float DedicatedServerResetDelay = 15.f;
+
+	/** Seconds between two attempts at creating the session */
+	UPROPERTY(Config)
+	float DedicatedServerRetryInterval = 10.f;
+
+#pragma endregion Dedicated Server
+
+#pragma region Slot Reservations
+
+public:
+	/**
+	 * Called by ASikLobbyGameMode when a remote player enters the lobby, takes a slot for them if they joined without reserving
+	 * Otherwise the beacon keeps granting slots those players already fill
+	 * 
+	 * @param InUniqueId: Player entering
+	 */
+	void HandleLobbyPlayerLogin(const FUniqueNetIdRepl& InUniqueId);
+
+	/**
+	 * Called by ASikLobbyGameMode when a player leaves the lobby, frees their slot at once instead of once it times out
+	 * 
+	 * @param InUniqueId: Player leaving
+	 */
+	void HandleLobbyPlayerLogout(const FUniqueNetIdRepl& InUniqueId);
+
+private:
+	/**
+	 * Asks the beacon of the host for a slot, for the local player and the members of the party it leads, before joining
+	 * A full lobby is then found out over one round trip instead of after the map load
+	 * 
+	 * @returns false if the join goes ahead without a reservation, the host has no beacon or the join follows the party leader
+	 */
+	bool RequestSlotReservation(const FOnlineSessionSearchResult& InSessionToJoin);
+
+	/** Joins once the slots are reserved, fails the join as full or gone otherwise */
+	void OnSlotReservationComplete(EPartyReservationResult::Type InResult);
+
+	/** Beacon of the host could not be reached, joins without a reservation */
+	void OnSlotReservationConnectionFailure();
+
+	/** Destroys the client beacon of the reservation in flight, if any */
+	void DestroySlotReservationClient();
+
+	/** @returns the reservations of the join, the local player followed by the other members of the party it leads */
+	TArray<FPlayerReservation> GetSlotReservationMembers() const;
+
+	/** Opens the beacon while hosting the game session in the lobby map, closes it and stops advertising it anywhere else */
+	void UpdateSlotReservationHost();
+
+	/** Closes the beacon of the host */
+	void StopSlotReservationHost();
+
+	/** Adds a reservation of one for the player unless they hold one already, see HandleLobbyPlayerLogin */
+	static void ReserveSlotForLobbyPlayer(APartyBeaconHost& InReservationHost, const FUniqueNetIdRepl& InUniqueId);
+
+	/** Advertises the port of the beacon under SETTING_BEACONPORT, 0 removes it so clients join without reserving */
+	void AdvertiseSlotReservationPort(int32 InPort);
+
+	/** Client beacon of the reservation in flight */
+	TWeakObjectPtr<APartyBeaconClient> SlotReservationClient;
+
+	/** Beacon the clients connect to, owns its net driver */
+	TWeakObjectPtr<AOnlineBeaconHost> SlotReservationListener;
+
+	/** Keeps the reservations, registered with SlotReservationListener, expires the ones not used within SessionTimeoutSecs */
+	TWeakObjectPtr<APartyBeaconHost> SlotReservationHost;
+
+	/** True to reserve slots before joining and to open a beacon in the lobby when hosting */
+	UPROPERTY(Config)
+	bool bUseSlotReservations = true;
+
+#pragma endregion Slot Reservations
+
+#pragma region Session Operation Queue
+
+private:
+	/** Merges the operation with the waiting ones it makes redundant and queues it */
+	void EnqueueSessionOperation(FSikQueuedSessionOperation&& InOperation);
+
+	/** Runs the next queued operation unless one is already running */
+	void ProcessNextSessionOperation();
+
+	/** 
+	 * Ends the running operation, reports its outcome and moves on to the next one
+	 * 
+	 * @param InResult: Outcome of the running operation
+	 */
+	void FinishSessionOperation(ESikSessionOperationResult InResult);
+
+	/** Broadcasts MultiplayerSessionsOnNamedSessionOperationComplete, and MultiplayerSessionsOnSessionOperationComplete for the game session */
+	void ReportSessionOperation(const FSikQueuedSessionOperation& InOperation, ESikSessionOperationResult InResult);
+
+	/** Drops every waiting operation, the running one still completes */
+	void CancelSessionOperations();
+
+	/** Broadcasts the failure of the given operation through its per operation delegate, if it is one the widgets bind to */
+	void BroadcastSessionOperationFailure(const FSikQueuedSessionOperation& InOperation);
+
+	/** @returns the running or waiting operation on the given session, nullptr if there is none */
+	FSikQueuedSessionOperation* FindSessionOperation(ESikSessionOperation InOperation, FName InSessionName);
+
+	/** @returns true if the given operation on the given session is running or waiting in the queue */
+	bool IsSessionOperationQueued(ESikSessionOperation InOperation, FName InSessionName = NAME_GameSession) const;
+
+	/** 
+	 * @returns true if the running operation is on the game session and requested by the UI
+	 * Only those are broadcast through the per operation delegates the widgets bind to
+	 */
+	bool IsGameSessionOperation() const 
+	{ 
+		return IsGameSessionOperation(ActiveSessionOperation);
+	}
+
+	/** @returns true if the given operation is on the game session and requested by the UI */
+	static bool IsGameSessionOperation(const FSikQueuedSessionOperation& InOperation)
+	{
+		return InOperation.SessionName == NAME_GameSession && !InOperation.bFollowParty && !InOperation.bMatchFlow &&
+			!InOperation.bReconnect && !InOperation.bAwaited;
+	}
+
+	/** Operation waiting on the backend, None while idle */
+	FSikQueuedSessionOperation ActiveSessionOperation;
+
+	/** Operations waiting for the running one to complete */
+	TArray<FSikQueuedSessionOperation> SessionOperationQueue;
+
+#pragma endregion Session Operation Queue
+
+#pragma region Session Operation Complete Delegates
+
+private:
+	/**
+	 * Delegates for session interface to bind to so that we can get a callback on any session operation completion
+	 */
+	
+	FOnCreateSessionCompleteDelegate CreateSessionCompleteDelegate;
+	FDelegateHandle CreateSessionCompleteDelegateHandle;
+	
+	FOnFindSessionsCompleteDelegate FindSessionsCompleteDelegate;
+	FDelegateHandle FindSessionsCompleteDelegateHandle;
+	
+	FOnFindSessionsCompleteDelegate FindSessionByCodeCompleteDelegate;
+	FDelegateHandle FindSessionByCodeCompleteDelegateHandle;
+	
+	FOnJoinSessionCompleteDelegate JoinSessionCompleteDelegate;
+	FDelegateHandle JoinSessionCompleteDelegateHandle;
+	
+	FOnDestroySessionCompleteDelegate DestroySessionCompleteDelegate;
+	FDelegateHandle DestroySessionCompleteDelegateHandle;
+	
+	FOnStartSessionCompleteDelegate StartSessionCompleteDelegate;
+	FDelegateHandle StartSessionCompleteDelegateHandle;
+		
+#pragma endregion Session Operation Complete Delegates
+	
+#pragma region Session Operations On Completion Delegates Callbacks
+	
+private:
+	/** Called when a session is successfully created */
+	void OnCreateSessionCompleteCallback(FName SessionName, bool bWasSuccessful);
+
+	/** Called when sessions with given session settings are found, completions of stale passes are dropped */
+	void OnFindSessionsCompleteCallback(bool bWasSuccessful);
+
+	/** Collects the results of the pass that completed, issues the next one or completes the browse search */
+	void CompleteSessionSearchPass(bool bWasSuccessful);
+
+	/** Called when the session key lookup started by FindSessionByCode completes */
+	void OnFindSessionByCodeCompleteCallback(bool bWasSuccessful);
+
+	/** Called when the lookup of the session id decoded from the session code completes, ignored unless InLookupId is still in flight */
+	void OnFindSessionByIdCompleteCallback(int32 LocalUserNum, bool bWasSuccessful, const FOnlineSessionSearchResult& SearchResult, 
+		uint32 InLookupId);
+
+	/** Called when a session is joined */
+	void OnJoinSessionCompleteCallback(FName SessionName, EOnJoinSessionCompleteResult::Type Result);
+
+	/** Called when a session is destroyed */
+	void OnDestroySessionCompleteCallback(FName SessionName, bool bWasSuccessful);
+
+	/** Called when a session is destroyed */
+	void OnStartSessionCompleteCallback(FName SessionName, bool bWasSuccessful);
+	
+#pragma endregion Session Operations On Completion Delegates Callbacks
+
+#pragma region Defaults
+	
+private:
+	/**
+	 * This variable acts an access point to OnlineSubsystem's session interface
+	 *
+	 * Using this variable only I will be able to call for creation, destruction, joining and finding of sessions
+	 * Initialized in the constructor
+	 */
+	IOnlineSessionPtr SessionInterface;
+
+	/** Callback that reconnects on transient failures, see TryStartReconnect, and calls HandleAppExit otherwise */
+	UFUNCTION()
+	void HandleNetworkFailure(UWorld* World, UNetDriver* NetDriver, ENetworkFailure::Type FailureType, 
+		const FString& ErrorString);
+
+	/**
+	 * Called in case of network failure or if player exits the game or any similar scenario
+	 * Destroys any active session and cancels if the find session is in progress
+	 * 
+	 * @param bLeaveParty: Also leaves the party, false when only the connection to the game server was lost
+	 */
+	void HandleAppExit(bool bLeaveParty = true);
+
+	/** Handles of the engine delegates bound in Initialize, removed in Deinitialize */
+	FDelegateHandle PreExitDelegateHandle;
+	FDelegateHandle NetworkFailureDelegateHandle;
+	FDelegateHandle TravelFailureDelegateHandle;
+
+	/**
+	 * Generates and returns a random code to create a session with
+	 * Replaced by the code encoding the lobby id in AdvertiseSessionCode once the backend has assigned one,
+	 * backends without a lookup by id keep a short code as there is nothing to gain from the longer one
+	 * 
+	 * @return an FSting with a random code, see FSikSessionCode
+	 */
+	FString GenerateSessionUniqueCode() const;
+
+	/** @returns true if the backend finds a session from its id, so codes encoding the id are worth their length */
+	bool SupportsSessionLookupById() const;
+
+	/**
+	 * Called after the session is created, encodes the id of the created session into its code
+	 * and advertises it so that clients can join by code without searching
+	 *
+	 * @param SessionName: Name of the created session
+	 */
+	void AdvertiseSessionCode(FName SessionName);
+
+	/**
+	 * @returns the id of the first local player, or of the mock backend's local user when no player is signed in
+	 * nullptr if neither is available
+	 */
+	FUniqueNetIdPtr GetLocalUserId() const;
+
+	/**
+	 * @returns true if the mock backend should replace the platform session interface
+	 * Set by bUseMockBackend or the -SikMockBackend command line switch
+	 */
+	bool ShouldUseMockBackend() const;
+
+	/** Mock backend the session interface points to when it is in use, see FSikMockOnlineSession */
+	TSharedPtr<FSikMockOnlineSession, ESPMode::ThreadSafe> MockSession;
+
+	/** Replaces the platform session interface with the mock backend */
+	UPROPERTY(Config)
+	bool bUseMockBackend = false;
+
+	/** Seed of the mock backend, overridden by -SikMockSeed= */
+	UPROPERTY(Config)
+	int32 MockBackendSeed = 1;
+
+	/** Number of lobbies the mock backend synthesizes, overridden by -SikMockLobbies= */
+	UPROPERTY(Config)
+	int32 MockBackendLobbyCount = 200;
+
+	/** Seconds every mock backend operation takes */
+	UPROPERTY(Config)
+	float MockBackendLatency = 0.05f;
+
+	/** Random seconds added to or removed from MockBackendLatency */
+	UPROPERTY(Config)
+	float MockBackendLatencyJitter = 0.02f;
+
+	/** Chance from 0 to 1 that a mock backend operation fails, overridden by -SikMockFailureRate= */
+	UPROPERTY(Config)
+	float MockBackendFailureRate = 0.f;
+
+	/** Values the mock lobbies are hosted with */
+	UPROPERTY(Config)
+	TArray<FString> MockBackendMapNames;
+	UPROPERTY(Config)
+	TArray<FString> MockBackendGameModes;
+	UPROPERTY(Config)
+	TArray<FString> MockBackendPlayers;
+
+	/** Maps sessions can be hosted on, the index + 1 is the id advertised in FSikPackedSessionSettings, only append to it */
+	UPROPERTY(Config)
+	TArray<FString> SessionMapNames;
+
+	/** Game modes sessions can be hosted with, the index + 1 is the id advertised in FSikPackedSessionSettings, only append to it */
+	UPROPERTY(Config)
+	TArray<FString> SessionGameModes;
+
+	/** True if subsystem is finding sessions */
+	bool bFindSessionsInProgress = false;
+	
+	/** Stores the last created session search to get the search results */
+	TSharedPtr<FOnlineSessionSearch> LastCreatedSessionSearch;
+
+	/** Query of the browse search currently in progress */
+	FSikSessionQuery InFlightSessionSearchQuery;
+
+	/** Id of the browse search currently in progress, tells FindSessionsAsync tasks which search is theirs */
+	uint32 InFlightSessionSearchId = 0;
+
+	/** Id given to the last browse search started */
+	uint32 LastSessionSearchId = 0;
+
+	/** Passes of the running browse search not issued yet, see StartSessionSearchPass */
+	TArray<ESikSessionSearchPass> SessionSearchPasses;
+
+	/** Results of the completed passes of the running browse search */
+	TArray<FOnlineSessionSearchResult> SessionSearchPassResults;
+
+	/** True if any completed pass of the running browse search succeeded */
+	bool bSessionSearchPassSucceeded = false;
+
+	/** Seconds all passes of a browse search may take together, 0 leaves each pass to the backend's own timeout */
+	UPROPERTY(Config)
+	float SessionSearchTimeBudget = 10.f;
+
+	/** Time the running browse search is cut off at, 0 without budget */
+	double SessionSearchDeadline = 0.0;
+
+	/** Fires once the running browse search is over its budget */
+	FTimerHandle SessionSearchBudgetTimerHandle;
+
+	/** Passes of the running session key search not issued yet, run until one of them finds the session */
+	TArray<ESikSessionSearchPass> SessionCodeSearchPasses;
+
+	/** Searches for dedicated servers next to the lobbies, they are game servers no lobby search finds */
+	UPROPERTY(Config)
+	bool bSearchDedicatedServers = true;
+
+	/** Query requested while another search or a code lookup was in progress, run once it completes */
+	TOptional<FSikSessionQuery> PendingSessionSearchQuery;
+
+	/** True while a broadcast of the cached snapshot waits for the next tick */
+	bool bCachedSearchBroadcastPending = false;
+
+	/** Seconds search results are served from the cache before the backend is asked again */
+	UPROPERTY(Config)
+	float SearchResultsCacheTTL = 5.f;
+
+	/** Results of the last successful browse search along with its query and the time it completed */
+	FSikSessionSearchSnapshotPtr CachedSessionSearch;
+	FSikSessionQuery CachedSessionSearchQuery;
+	double CachedSessionSearchTime = 0.0;
+
+	/** Generation of the last snapshot made, counts the completed searches */
+	uint32 SessionSearchGeneration = 0;
+
+	/** Refresh scheduled for when the cached results turn stale */
+	FTimerHandle SessionSearchRefreshTimerHandle;
+	FSikSessionQuery ScheduledSessionSearchQuery;
+
+	/** Paces the session browser polls, configured from the SessionPoll properties */
+	FSikPollScheduler SessionPollScheduler;
+
+	/** Minimum seconds between two browse searches, also the poll interval while the list is visible and changing */
+	UPROPERTY(Config)
+	float SessionPollMinInterval = 2.f;
+
+	/** Seconds between polls while the session list is stable or the game is in the background */
+	UPROPERTY(Config)
+	float SessionPollIdleInterval = 8.f;
+
+	/** Upper bound of the backoff applied after empty or failed searches */
+	UPROPERTY(Config)
+	float SessionPollMaxBackoffInterval = 60.f;
+
+	/** Random fraction added to or removed from every poll delay */
+	UPROPERTY(Config)
+	float SessionPollJitterFraction = 0.2f;
+
+	/** True while the session browser is open and polling */
+	bool bSessionBrowserPolling = false;
+
+	/** Query the session browser polls with */
+	FSikSessionQuery SessionBrowserQuery;
+
+	/** Timer firing the next session browser poll */
+	FTimerHandle SessionBrowserPollTimerHandle;
+
+	/** Fingerprint of the last polled results, used to tell if the list is changing */
+	uint32 LastSessionBrowserFingerprint = 0;
+
+	/** Number of results the session browser asks for at first, and adds to the limit each time more are requested */
+	UPROPERTY(Config)
+	int32 SessionSearchResultStep = 20;
+
+	/** Hard cap on the sessions a single search may return and the subsystem retains */
+	UPROPERTY(Config)
+	int32 MaxRetainedSearchResults = 200;
+
+	/** Number of result steps the session browser asks for, reset when its filters change */
+	int32 SessionBrowserResultSteps = 1;
+
+	/** Number of sessions the last poll returned, tells if the backend has more to give */
+	int32 LastSessionBrowserResultCount = 0;
+
+	/** Time the last browse search was issued, used to rate limit the searches */
+	double LastSessionSearchStartTime = -UE_BIG_NUMBER;
+
+	/** True if subsystem is looking up a session by its code */
+	bool bFindSessionByCodeInProgress = false;
+
+	/** Stores the search created by FindSessionByCode, kept apart from the browse search */
+	TSharedPtr<FOnlineSessionSearch> LastSessionCodeSearch;
+
+	/** The session code that is being looked up */
+	FString SessionCodeToFind = FString("");
+
+	/** Lookup in flight and who requested it */
+	FSikSessionCodeLookup ActiveSessionCodeLookup;
+
+	/** Lookups requested while another one was in flight, run one at a time in the order they were requested */
+	TArray<FSikSessionCodeLookup> QueuedSessionCodeLookups;
+
+	/** Id given to the last lookup started */
+	uint32 LastSessionCodeLookupId = 0;
+
+	/** True when the session key lookup waits for the running browse search to complete */
+	bool bSessionKeyLookupPending = false;
+	
+	/** 
+	 * @returns true if the session is in the given state
+	 * @param State The session state to check
+	 * @param InSessionName The session to check
+	 */
+	bool IsSessionInState(EOnlineSessionState::Type State, FName InSessionName = NAME_GameSession) const;
+	
+#pragma endregion Defaults
+	
+#pragma region Getter
+	
+public:
+	/** @returns the map name table of FSikSessionSchema */
+	const TArray<FString>& GetSessionMapNames() const { return SessionMapNames; }
+
+	/** @returns the game mode name table of FSikSessionSchema */
+	const TArray<FString>& GetSessionGameModes() const { return SessionGameModes; }
+
+	/** @returns the tuning of the matchmaker served by this process */
+	FSikMatchmakerSettings GetMatchmakerSettings() const;
+
+	/** @returns the port of MatchmakerAddress, the matchmaker server listens on it */
+	int32 GetMatchmakerPort() const;
+
+	/** @returns true if the matchmaker server listens on every network interface, see bMatchmakerServerBindAny */
+	bool ShouldMatchmakerServerBindAny() const { return bMatchmakerServerBindAny; }
+
+	/** 
+	 * @returns true if the settings of the current session were read
+	 * @param OutSettings: The settings the session is hosted with
+	 */
+	bool GetSessionSchemaSettings(FSikPackedSessionSettings& OutSettings, FName InSessionName = NAME_GameSession) const;
+
+	/** 
+	 * @returns true if the address to travel to for the joined session was resolved
+	 * @param OutConnectString the resolved address
+	 * @param InSessionName the session to resolve the address of
+	 */
+	bool GetResolvedConnectString(FString& OutConnectString, FName InSessionName = NAME_GameSession) const;
+
 	/** 
 	 * @returns true if successfully fetched max players 
-	 * @param OutMaxPlayers the max number of players supported by the current session
+	 * @param OutMaxPlayers the max number of players supported by the session
+	 * @param InSessionName the session to read
 	 */
-	bool GetMaxPlayers(int32& OutMaxPlayers) const;
+	bool GetMaxPlayers(int32& OutMaxPlayers, FName InSessionName = NAME_GameSession) const;
 
 	/** 
 	 * @returns true if successfully fetched the requested setting 
 	 * @param InSettingName name of the setting to find
 	 * @param OutSessionSetting the fetched setting value
+	 * @param InSessionName the session to read
 	 */
-	bool GetSessionSetting(const FName InSettingName, FString& OutSessionSetting) const;
+	bool GetSessionSetting(const FName InSettingName, FString& OutSessionSetting, FName InSessionName = NAME_GameSession) const;
 	
 #pragma endregion Getter
 	
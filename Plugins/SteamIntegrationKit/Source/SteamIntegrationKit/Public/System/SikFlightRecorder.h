@@ -0,0 +1,144 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** What a flight recorder event records */
+enum class ESikFlightEventType : uint8
+{
+	/** Call issued to the session backend, Value carries call specific data such as the max search results */
+	Issued,
+	/** Completion callback received from the backend, Code is its result */
+	Callback,
+	/** Queued session operation finished, Code is the ESikSessionOperationResult */
+	Finished,
+	/** Session state changed as seen through IsSessionInState, Code is the EOnlineSessionState or NoSessionState */
+	SessionState,
+	TravelStarted,
+	TravelFinished,
+	/** Code is the ETravelFailure */
+	TravelFailed,
+	/** Code is the ENetworkFailure */
+	NetworkFailure,
+	/** Recorder was dumped, marks where an earlier dump ended */
+	Dumped
+};
+
+/** Call or flow an event belongs to */
+enum class ESikFlightSubject : uint8
+{
+	None,
+	CreateSession,
+	FindSessions,
+	CancelFindSessions,
+	FindSessionByCode,
+	FindSessionById,
+	FindSessionBySessionKey,
+	JoinSession,
+	DestroySession,
+	StartSession,
+	ServerTravel,
+	ClientTravel,
+	Reconnect,
+	QuickMatch,
+	Matchmaking,
+	SlotReservation
+};
+
+/**
+ * Single fixed size event, timestamped with the monotonic cycle counter
+ ******************************************************************************************/
+struct FSikFlightEvent
+{
+	uint64 Cycles = 0;
+	ESikFlightEventType Type = ESikFlightEventType::Issued;
+	ESikFlightSubject Subject = ESikFlightSubject::None;
+	uint8 Code = 0;
+	uint8 Reserved = 0;
+	int32 Value = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FSikFlightEvent& Event);
+};
+
+static_assert(sizeof(FSikFlightEvent) == 16, "Flight recorder events are expected to stay 16 bytes");
+
+/**
+ * Records what USikSubsystem asked of the session backend and what it heard back
+ * 
+ * Events go into a fixed circular buffer, recording is a store of 16 bytes with no allocation or lock,
+ * once full the oldest events are overwritten
+ * Game thread only, like the session callbacks it records
+ * 
+ * Dumps are written to Saved/FlightRecorder and decoded offline by USikFlightRecorderCommandlet:
+ * UnrealEditor-Cmd <Project> -run=SikFlightRecorder [-File=<dump>]
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API FSikFlightRecorder
+{
+public:
+	/** Code of SessionState events while there is no game session */
+	static constexpr uint8 NoSessionState = 0xFF;
+
+	FSikFlightRecorder();
+
+	/** Resizes the buffer, recorded events are dropped */
+	void SetCapacity(int32 InCapacity);
+
+	/** Records an event, the caller's current time is taken as its timestamp */
+	void Record(ESikFlightEventType InType, ESikFlightSubject InSubject, uint8 InCode = 0, int32 InValue = 0)
+	{
+		FSikFlightEvent& Event = Events[NextEvent];
+		Event.Cycles = FPlatformTime::Cycles64();
+		Event.Type = InType;
+		Event.Subject = InSubject;
+		Event.Code = InCode;
+		Event.Value = InValue;
+		
+		NextEvent = NextEvent + 1 == Events.Num() ? 0 : NextEvent + 1;
+		NumRecorded += 1;
+	}
+
+	/** Records the session state if it differs from the one recorded last */
+	void RecordSessionState(uint8 InState)
+	{
+		if (InState != LastSessionState)
+		{
+			LastSessionState = InState;
+			Record(ESikFlightEventType::SessionState, ESikFlightSubject::None, InState);
+		}
+	}
+
+	/**
+	 * Writes the recorded events to Saved/FlightRecorder on a background thread
+	 * 
+	 * @param InReason: Why the recorder is dumped, part of the file name and the header
+	 * @returns the path of the dump
+	 */
+	FString Dump(const FString& InReason);
+
+	/** Serializes the recorded events, oldest first, in the format Dump writes */
+	void Serialize(const FString& InReason, TArray<uint8>& OutData) const;
+
+	/**
+	 * Decodes a dump into a human readable timeline, one line per event
+	 * 
+	 * @param InData: Contents of a dump
+	 * @param OutTimeline: Header line followed by the events
+	 * @returns false if the data is not a dump of a known version
+	 */
+	static bool Decode(const TArray<uint8>& InData, TArray<FString>& OutTimeline);
+
+	/** @returns the directory dumps are written to */
+	static FString GetDumpDirectory();
+
+private:
+	/** Circular buffer of events, NextEvent is the oldest once it has wrapped */
+	TArray<FSikFlightEvent> Events;
+	int32 NextEvent = 0;
+
+	/** Events recorded since start up, tells whether the buffer has wrapped */
+	uint64 NumRecorded = 0;
+
+	/** Last state recorded by RecordSessionState */
+	uint8 LastSessionState = NoSessionState;
+};
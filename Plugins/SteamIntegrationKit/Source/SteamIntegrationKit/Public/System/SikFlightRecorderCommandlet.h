@@ -0,0 +1,24 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SikFlightRecorderCommandlet.generated.h"
+
+/**
+ * Offline decoder of the flight recorder dumps, prints the timeline of a dump to the console
+ * 
+ * UnrealEditor-Cmd <Project> -run=SikFlightRecorder [-File=<dump>]
+ * Without -File the newest dump in Saved/FlightRecorder is decoded
+ ******************************************************************************************/
+UCLASS()
+class STEAMINTEGRATIONKIT_API USikFlightRecorderCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USikFlightRecorderCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
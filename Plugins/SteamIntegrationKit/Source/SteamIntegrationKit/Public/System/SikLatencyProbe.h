@@ -0,0 +1,199 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "OnlineSubsystemTypes.h"
+#include "Serialization/ArrayReader.h"
+#include "System/SikRingBuffer.h"
+
+class FSocket;
+class FInternetAddr;
+class FUdpSocketReceiver;
+struct FIPv4Endpoint;
+
+/** Called once a probe completes with the measured round trip time, negative if the host could not be measured */
+DECLARE_DELEGATE_OneParam(FSikOnLatencyProbeComplete, int32 /*PingInMs*/);
+
+/**
+ * What a latency probe needs to know about the host it measures
+ ******************************************************************************************/
+struct FSikLatencyProbeRequest
+{
+	/** Identifies the host, results are cached per host key */
+	FString HostKey;
+
+	/** Endpoint the host answers probes on, "ip:port", empty if the host is only reachable through the backend */
+	FString HostAddress;
+
+	/** Ping the backend reported along with the search result, MAX_QUERY_PING if it reported none */
+	int32 ReportedPingInMs = MAX_QUERY_PING;
+
+	/** Steam relay ping location the host advertised, see FSikSteamPingLocation, empty if it advertised none */
+	FString PingLocation;
+};
+
+/**
+ * Steam relay network ping locations
+ * 
+ * Steam lobbies carry no ping, hosts advertise where they sit in the relay network instead
+ * and clients estimate the round trip from their own location without sending a single packet
+ * Everything fails gracefully without Steam, on other backends and while the relay network is not yet reachable
+ ******************************************************************************************/
+struct STEAMINTEGRATIONKIT_API FSikSteamPingLocation
+{
+	/** Starts measuring the local ping location in the background, it takes a few seconds to become available */
+	static void InitRelayNetworkAccess();
+
+	/** @return the local ping location as a string to advertise, empty if Steam has not measured it yet */
+	static FString GetLocalPingLocation();
+
+	/**
+	 * Estimates the round trip between this machine and the given location
+	 * 
+	 * @param InPingLocation: Location advertised by the host, as returned by GetLocalPingLocation on its side
+	 * @return the estimated ping in milliseconds, negative if the location cannot be parsed or the local one is unknown
+	 */
+	static int32 EstimatePingInMs(const FString& InPingLocation);
+};
+
+/**
+ * Transport measuring the round trip time to a session host
+ * USikSubsystem keeps a bounded number of probes in flight and caches what they measure
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API ISikLatencyProbe
+{
+public:
+	virtual ~ISikLatencyProbe() = default;
+
+	/**
+	 * Starts measuring the given host, OnComplete is called exactly once and may be called before Probe returns
+	 *
+	 * @param InRequest: Host to measure
+	 * @param OnComplete: Called with the measured ping
+	 */
+	virtual void Probe(const FSikLatencyProbeRequest& InRequest, FSikOnLatencyProbeComplete OnComplete) = 0;
+
+	/** Drops every probe in flight without completing it */
+	virtual void CancelAll() {}
+};
+
+/**
+ * Reads the ping the backend measured while searching, completes right away
+ * Hosts the backend reported none for, Steam lobbies, get an estimate from their advertised ping location
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API FSikBackendLatencyProbe : public ISikLatencyProbe
+{
+public:
+	virtual void Probe(const FSikLatencyProbeRequest& InRequest, FSikOnLatencyProbeComplete OnComplete) override;
+};
+
+/**
+ * Sends a datagram to the echo endpoint of the host, see FSikUdpEchoServer, and measures how long the echo takes
+ * Echoes are received and timed on a receiver thread as they arrive, the probes complete on the game thread
+ * Hosts without an address, reached through the backend only, get the ping the backend reported or estimated
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API FSikUdpEchoLatencyProbe : public ISikLatencyProbe
+{
+public:
+	/**
+	 * @param InTimeoutSeconds: Seconds after which a probe without echo fails
+	 */
+	explicit FSikUdpEchoLatencyProbe(float InTimeoutSeconds);
+
+	virtual ~FSikUdpEchoLatencyProbe() override;
+
+	virtual void Probe(const FSikLatencyProbeRequest& InRequest, FSikOnLatencyProbeComplete OnComplete) override;
+
+	virtual void CancelAll() override;
+
+private:
+	/** Completes the probes whose echo arrived and fails the ones that timed out */
+	bool Tick(float DeltaTime);
+
+	/** Called on the receiver thread for every datagram, queues the echoes of probes with their arrival time */
+	void OnEchoReceived(const FArrayReaderPtr& InData, const FIPv4Endpoint& InSender);
+
+	/** Probe waiting for its echo */
+	struct FInFlightProbe
+	{
+		double SentTime = 0.0;
+		FSikOnLatencyProbeComplete OnComplete;
+	};
+
+	/** Echo read by the receiver thread */
+	struct FReceivedEcho
+	{
+		uint32 Sequence = 0;
+		double ReceivedTime = 0.0;
+	};
+
+	/** Probes waiting for their echo keyed by the sequence number sent with them */
+	TMap<uint32, FInFlightProbe> InFlightProbes;
+
+	/** Sequence number of the next probe */
+	uint32 NextSequence = 1;
+
+	/** Socket the probes are sent and the echoes received on */
+	FSocket* Socket = nullptr;
+
+	/** Thread waiting on Socket, a reply read by the ticker would be timed up to a frame late */
+	TUniquePtr<FUdpSocketReceiver> Receiver;
+
+	/** Echoes handed from the receiver thread to the game thread */
+	TSikMpscRingBuffer<FReceivedEcho> ReceivedEchoes;
+
+	/** Seconds after which a probe without echo fails */
+	float TimeoutSeconds = 2.f;
+
+	/** Ticker completing the probes, registered while probes are in flight */
+	FTSTicker::FDelegateHandle TickerHandle;
+};
+
+/**
+ * Answers the probes of FSikUdpEchoLatencyProbe with the same datagram, anything else is dropped
+ * Replies are rate limited per sender address so the port cannot be used to reflect traffic
+ * Run by hosts while they host a game session
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API FSikUdpEchoServer
+{
+public:
+	~FSikUdpEchoServer();
+
+	/**
+	 * Binds the given port and starts echoing
+	 * 
+	 * @return true if the port could be bound
+	 */
+	bool Start(int32 InPort);
+
+	/** Stops echoing and closes the socket */
+	void Stop();
+
+	/** @returns true between a successful Start and Stop */
+	bool IsRunning() const { return Socket != nullptr; }
+
+private:
+	/** Echoes the pending datagrams */
+	bool Tick(float DeltaTime);
+
+	/** @returns true if the sender may get another reply in its current one second window, counting it */
+	bool ConsumeReplyBudget(const FInternetAddr& InSender, double InNow);
+
+	/** Replies sent to an address within its current window */
+	struct FSenderWindow
+	{
+		double StartTime = 0.0;
+		int32 Replies = 0;
+	};
+
+	/** Reply windows keyed by the sender address without port */
+	TMap<FString, FSenderWindow> SenderWindows;
+
+	/** Socket bound to the echo port */
+	FSocket* Socket = nullptr;
+
+	/** Ticker echoing the datagrams while the server runs */
+	FTSTicker::FDelegateHandle TickerHandle;
+};
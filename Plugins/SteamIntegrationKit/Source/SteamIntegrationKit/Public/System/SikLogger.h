@@ -1,60 +1,110 @@
-// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "Logging/LogMacros.h"
 #include "Logging/LogVerbosity.h"
-#include "Engine/Engine.h"
 
-/** Defined in UMssSubsystem.cpp */
+/** Defined in SikLogger.cpp */
 DECLARE_LOG_CATEGORY_EXTERN(SteamIntegrationKitLog, Log, All);
 
+// --------------------------------------------------------------------------
+//  COMPILE TIME FILTER
+// --------------------------------------------------------------------------
+
+#define SIK_LOG_LEVEL_NONE 0
+#define SIK_LOG_LEVEL_ERROR 1
+#define SIK_LOG_LEVEL_WARNING 2
+#define SIK_LOG_LEVEL_INFO 3
+
+/**
+ * Macros above this level compile to nothing, their format arguments are never evaluated
+ * Defaults to warnings in shipping builds, override with PublicDefinitions.Add("SIK_LOG_COMPILED_LEVEL=...")
+ */
+#ifndef SIK_LOG_COMPILED_LEVEL
+    #if UE_BUILD_SHIPPING
+        #define SIK_LOG_COMPILED_LEVEL SIK_LOG_LEVEL_WARNING
+    #else
+        #define SIK_LOG_COMPILED_LEVEL SIK_LOG_LEVEL_INFO
+    #endif
+#endif
+
 // --------------------------------------------------------------------------
 //  INTERNAL (DO NOT CALL DIRECTLY)
 // --------------------------------------------------------------------------
 
-inline void Internal_Log(const ELogVerbosity::Type Verbosity,
-                         const char* FunctionName,
-                         const FColor ScreenColor,
-                         const FString& UserMessage)
+namespace SikLog
 {
-    const FString FinalMessage = FString::Printf(TEXT("[%s] %s"), ANSI_TO_TCHAR(FunctionName), *UserMessage);
-
-    switch (Verbosity)
+    /** @returns true if the category lets the verbosity through, checked before any formatting */
+    FORCEINLINE bool IsEnabled(const ELogVerbosity::Type Verbosity)
     {
-        case ELogVerbosity::Error:
-            UE_LOG(SteamIntegrationKitLog, Error, TEXT("%s"), *FinalMessage);
-            break;
-
-        case ELogVerbosity::Warning:
-            UE_LOG(SteamIntegrationKitLog, Warning, TEXT("%s"), *FinalMessage);
-            break;
-
-        case ELogVerbosity::Display:
-        case ELogVerbosity::Log:
-        default:
-            UE_LOG(SteamIntegrationKitLog, Log, TEXT("%s"), *FinalMessage);
-            break;
+        return !SteamIntegrationKitLog.IsSuppressed(Verbosity);
     }
 
-#if !UE_BUILD_SHIPPING
-    if (GEngine)
+    /**
+     * Queues the message for the sink thread which prefixes it with the function name and writes it to the log
+     * FormatMessage writes the text straight into a slot of the queue, it is not called for messages dropped by a full queue
+     * Written in place while the sink is not running, and for errors when the queue is full
+     */
+    STEAMINTEGRATIONKIT_API void Enqueue(ELogVerbosity::Type Verbosity, const ANSICHAR* FunctionName, 
+        TFunctionRef<void(TCHAR* /*OutText*/, int32 /*TextCapacity*/)> FormatMessage);
+
+    /** Formats the message into the queue without allocating, see Enqueue */
+    template <typename FormatType, typename... ArgTypes>
+    FORCENOINLINE void Log(const ELogVerbosity::Type Verbosity, const ANSICHAR* FunctionName, const FormatType& Format, ArgTypes... Args)
     {
-        GEngine->AddOnScreenDebugMessage(INDEX_NONE, 8.f, ScreenColor, FinalMessage);
+        Enqueue(Verbosity, FunctionName, [&](TCHAR* OutText, const int32 TextCapacity)
+        {
+            FCString::Snprintf(OutText, TextCapacity, Format, Args...);
+        });
     }
-#endif
+
+    /** Writes every queued message before returning, called on shutdown and on crash */
+    STEAMINTEGRATIONKIT_API void Flush();
+
+    /** Starts and stops the sink thread, called by the module */
+    STEAMINTEGRATIONKIT_API void StartSink();
+    STEAMINTEGRATIONKIT_API void StopSink();
 }
 
+#define SIK_LOG_INTERNAL(Verbosity, Format, ...) \
+    do \
+    { \
+        if (SikLog::IsEnabled(ELogVerbosity::Verbosity)) \
+        { \
+            SikLog::Log(ELogVerbosity::Verbosity, __FUNCTION__, Format, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+/** Keeps the call in a dead branch, the arguments stay used and the format stays type-checked but nothing is emitted */
+#define SIK_LOG_COMPILED_OUT(Format, ...) \
+    do \
+    { \
+        if (false) \
+        { \
+            SikLog::Log(ELogVerbosity::Log, __FUNCTION__, Format, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
 // --------------------------------------------------------------------------
 //  MACROS FOR EASY USAGE
 // --------------------------------------------------------------------------
 
-#define LOG_INFO(Format, ...) \
-    Internal_Log(ELogVerbosity::Log, __FUNCTION__, FColor::Cyan, FString::Printf(Format, ##__VA_ARGS__))
+#if SIK_LOG_COMPILED_LEVEL >= SIK_LOG_LEVEL_INFO
+    #define LOG_INFO(Format, ...) SIK_LOG_INTERNAL(Log, Format, ##__VA_ARGS__)
+#else
+    #define LOG_INFO(Format, ...) SIK_LOG_COMPILED_OUT(Format, ##__VA_ARGS__)
+#endif
 
-#define LOG_WARNING(Format, ...) \
-    Internal_Log(ELogVerbosity::Warning, __FUNCTION__, FColor::Yellow, FString::Printf(Format, ##__VA_ARGS__))
+#if SIK_LOG_COMPILED_LEVEL >= SIK_LOG_LEVEL_WARNING
+    #define LOG_WARNING(Format, ...) SIK_LOG_INTERNAL(Warning, Format, ##__VA_ARGS__)
+#else
+    #define LOG_WARNING(Format, ...) SIK_LOG_COMPILED_OUT(Format, ##__VA_ARGS__)
+#endif
 
-#define LOG_ERROR(Format, ...) \
-    Internal_Log(ELogVerbosity::Error, __FUNCTION__, FColor::Red, FString::Printf(Format, ##__VA_ARGS__))
\ No newline at end of file
+#if SIK_LOG_COMPILED_LEVEL >= SIK_LOG_LEVEL_ERROR
+    #define LOG_ERROR(Format, ...) SIK_LOG_INTERNAL(Error, Format, ##__VA_ARGS__)
+#else
+    #define LOG_ERROR(Format, ...) SIK_LOG_COMPILED_OUT(Format, ##__VA_ARGS__)
+#endif
@@ -0,0 +1,335 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Misc/Guid.h"
+#include "System/SikSessionSchema.h"
+
+class FSocket;
+class FInternetAddr;
+
+/** Where a matchmaking ticket stands, as answered to every request about it */
+enum class ESikMatchmakingTicketState : uint8
+{
+	/** Not known to the matchmaker, never enqueued, expired or cancelled */
+	Unknown,
+	/** Waiting for enough compatible players */
+	Waiting,
+	/** Grouped into a match, waiting for its host to report the session */
+	Matched,
+	/** Hosts the match, creates a session with the assigned settings and reports its code */
+	Host,
+	/** Joins the match, the assignment carries the code of the host's session */
+	Join,
+	/** Host whose report was received, the ticket can be cancelled */
+	Reported
+};
+
+/**
+ * What a player is looking for, enqueued with the matchmaker
+ ******************************************************************************************/
+struct FSikMatchmakingTicket
+{
+	/** Picked by the client, identifies the ticket in every request */
+	FGuid TicketId;
+
+	/** Players are only matched within the same region */
+	FString Region;
+
+	/** Skill rating, players are matched with close ratings first and the window widens while they wait */
+	int32 Skill = 0;
+
+	/** Preferred settings, unset fields (id 0, Players Any) accept every value */
+	FSikPackedSessionSettings Preferences;
+};
+
+/**
+ * Match a ticket was put into
+ ******************************************************************************************/
+struct FSikMatchAssignment
+{
+	/** Identifies the match, shared by all its members */
+	FGuid MatchId;
+
+	/** Settings the members agreed on, the host creates the session with them, unset fields are up to the host */
+	FSikPackedSessionSettings Settings;
+
+	/** Number of players in the match, host included */
+	int32 NumPlayers = 0;
+
+	/** Code of the session the host reported, set for Join only */
+	FString SessionCode;
+};
+
+/**
+ * Answer of the matchmaker about one ticket
+ ******************************************************************************************/
+struct FSikMatchmakingStatus
+{
+	FGuid TicketId;
+
+	ESikMatchmakingTicketState State = ESikMatchmakingTicketState::Unknown;
+
+	/** Match of the ticket, set from Matched on */
+	FSikMatchAssignment Assignment;
+};
+
+/**
+ * Tuning of the matchmaker, read from the USikSubsystem config
+ ******************************************************************************************/
+struct FSikMatchmakerSettings
+{
+	/** Seconds between two rounds of grouping the waiting tickets */
+	float BatchInterval = 1.f;
+
+	/** Largest skill difference within a match when the tickets were just enqueued */
+	int32 SkillWindow = 100;
+
+	/** Skill difference added to the window for every second a ticket waits */
+	float SkillWindowGrowth = 25.f;
+
+	/** Upper bound of the skill window */
+	int32 MaxSkillWindow = 1000;
+
+	/** Seconds without any request about a ticket after which it is dropped, clients poll well within it */
+	float TicketTimeout = 10.f;
+
+	/** Seconds the host of a match has to report its session, the other members are put back in the queue after that */
+	float HostReportTimeout = 60.f;
+};
+
+/**
+ * Groups matchmaking tickets into matches, shared by the in-process connection and FSikMatchmakerServer
+ * 
+ * Tickets are bucketed by region and grouped in batches of BatchInterval, each batch sorts a bucket by skill
+ * and takes runs of compatible tickets whose skill spread fits the window of every member
+ * The member waiting longest hosts, the others are told to join once the host has reported its session
+ * 
+ * Clients poll their ticket, a ticket not polled for TicketTimeout is dropped, so crashed clients do not get matched
+ * Time is passed in by the caller so batches can be replayed and benchmarked
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API FSikMatchmaker
+{
+public:
+	explicit FSikMatchmaker(const FSikMatchmakerSettings& InSettings);
+
+	/**
+	 * Adds the ticket to the queue, enqueueing a known ticket again only refreshes it
+	 * 
+	 * @param InTicket: Ticket to enqueue
+	 * @param InNow: Current time in seconds
+	 */
+	FSikMatchmakingStatus Enqueue(const FSikMatchmakingTicket& InTicket, double InNow);
+
+	/** @returns where the ticket stands, and keeps it from expiring */
+	FSikMatchmakingStatus Poll(const FGuid& InTicketId, double InNow);
+
+	/**
+	 * Called by the host once its session is created, hands the session code to the other members
+	 * 
+	 * @param InTicketId: Ticket of the host
+	 * @param InSessionCode: Code of the created session
+	 */
+	FSikMatchmakingStatus ReportHosted(const FGuid& InTicketId, const FString& InSessionCode, double InNow);
+
+	/** Drops the ticket, a host that has not reported yet dissolves its match and the other members wait again */
+	void Cancel(const FGuid& InTicketId);
+
+	/** Drops expired tickets and matches, groups the waiting tickets once BatchInterval has passed */
+	void Tick(double InNow);
+
+	/** Groups the waiting tickets right away, Tick calls it every BatchInterval */
+	void FormMatches(double InNow);
+
+	/** @returns the number of tickets waiting to be matched */
+	int32 GetNumWaitingTickets() const;
+
+private:
+	/** Ticket along with its state */
+	struct FTicketEntry
+	{
+		FSikMatchmakingTicket Ticket;
+		ESikMatchmakingTicketState State = ESikMatchmakingTicketState::Waiting;
+		double EnqueueTime = 0.0;
+		double LastSeenTime = 0.0;
+		FGuid MatchId;
+	};
+
+	/** Match waiting for or done with its host's report */
+	struct FMatch
+	{
+		FSikMatchAssignment Assignment;
+		FGuid HostTicketId;
+		TArray<FGuid> MemberTicketIds;
+		double CreatedTime = 0.0;
+	};
+
+	/** @returns the status of the given ticket */
+	FSikMatchmakingStatus MakeStatus(const FGuid& InTicketId) const;
+
+	/** Groups the waiting tickets of one region, candidates are sorted by skill */
+	void FormMatchesInBucket(TArray<FTicketEntry*>& InCandidates, ESikPlayersConfig InPlayers, double InNow);
+
+	/** @returns the skill spread the ticket accepts after waiting until the given time */
+	int32 GetSkillWindow(const FTicketEntry& InEntry, double InNow) const;
+
+	/** Puts the members of the match back in the queue and drops the match */
+	void DissolveMatch(const FGuid& InMatchId);
+
+	FSikMatchmakerSettings Settings;
+
+	TMap<FGuid, FTicketEntry> Tickets;
+
+	TMap<FGuid, FMatch> Matches;
+
+	/** Time of the next batch */
+	double NextBatchTime = 0.0;
+};
+
+/** Called with the answer of the matchmaker to a request about a ticket */
+DECLARE_DELEGATE_OneParam(FSikOnMatchmakingStatus, const FSikMatchmakingStatus& /*Status*/);
+
+/**
+ * Transport USikSubsystem talks to the matchmaker through
+ * Every request but Cancel is answered through OnStatus, possibly before the call returns
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API ISikMatchmakerConnection
+{
+public:
+	virtual ~ISikMatchmakerConnection() = default;
+
+	virtual void Enqueue(const FSikMatchmakingTicket& InTicket) = 0;
+	virtual void Poll(const FGuid& InTicketId) = 0;
+	virtual void ReportHosted(const FGuid& InTicketId, const FString& InSessionCode) = 0;
+	virtual void Cancel(const FGuid& InTicketId) = 0;
+
+	/** Answers of the matchmaker */
+	FSikOnMatchmakingStatus OnStatus;
+};
+
+/**
+ * Calls a matchmaker in the same process, answers right away
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API FSikLocalMatchmakerConnection : public ISikMatchmakerConnection
+{
+public:
+	/**
+	 * @param InMatchmaker: Matchmaker to call
+	 * @param bInTickMatchmaker: True if nothing else ticks the matchmaker, it is then ticked by this connection
+	 */
+	FSikLocalMatchmakerConnection(const TSharedRef<FSikMatchmaker>& InMatchmaker, bool bInTickMatchmaker);
+
+	virtual ~FSikLocalMatchmakerConnection() override;
+
+	virtual void Enqueue(const FSikMatchmakingTicket& InTicket) override;
+	virtual void Poll(const FGuid& InTicketId) override;
+	virtual void ReportHosted(const FGuid& InTicketId, const FString& InSessionCode) override;
+	virtual void Cancel(const FGuid& InTicketId) override;
+
+private:
+	TSharedRef<FSikMatchmaker> Matchmaker;
+
+	/** Ticker of the matchmaker, registered if this connection ticks it */
+	FTSTicker::FDelegateHandle TickerHandle;
+};
+
+/**
+ * Sends the requests as datagrams to FSikMatchmakerServer, over loopback when the server runs on the same machine
+ * Datagrams may be lost, the subsystem repeats its polls and reports until they are answered
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API FSikUdpMatchmakerConnection : public ISikMatchmakerConnection
+{
+public:
+	/** @param InServerAddress: Address of the matchmaker server, "127.0.0.1:7788" */
+	explicit FSikUdpMatchmakerConnection(const FString& InServerAddress);
+
+	virtual ~FSikUdpMatchmakerConnection() override;
+
+	/** @returns true if the socket was created and the server address resolved */
+	bool IsValid() const { return Socket != nullptr && ServerAddress.IsValid(); }
+
+	virtual void Enqueue(const FSikMatchmakingTicket& InTicket) override;
+	virtual void Poll(const FGuid& InTicketId) override;
+	virtual void ReportHosted(const FGuid& InTicketId, const FString& InSessionCode) override;
+	virtual void Cancel(const FGuid& InTicketId) override;
+
+	/** Request datagrams as sent to FSikMatchmakerServer */
+	static TArray<uint8> MakeEnqueueRequest(const FSikMatchmakingTicket& InTicket);
+	static TArray<uint8> MakePollRequest(const FGuid& InTicketId);
+	static TArray<uint8> MakeReportHostedRequest(const FGuid& InTicketId, const FString& InSessionCode);
+	static TArray<uint8> MakeCancelRequest(const FGuid& InTicketId);
+
+	/**
+	 * Reads the answer of the server out of a datagram
+	 * 
+	 * @return false if the datagram is not a well formed status
+	 */
+	static bool ReadStatus(TConstArrayView<uint8> InDatagram, FSikMatchmakingStatus& OutStatus);
+
+private:
+	/** Reads the answers of the server */
+	bool Tick(float DeltaTime);
+
+	/** Sends the given datagram to the server */
+	void Send(const TArray<uint8>& InPacket);
+
+	/** Socket the requests are sent and the answers received on */
+	FSocket* Socket = nullptr;
+
+	/** Resolved server address */
+	TSharedPtr<FInternetAddr> ServerAddress;
+
+	/** Ticker reading the answers while the connection exists */
+	FTSTicker::FDelegateHandle TickerHandle;
+};
+
+/**
+ * Serves a matchmaker to the FSikUdpMatchmakerConnection of other processes
+ * Runs inside a game started with -SikMatchmakerServer or standalone through -run=SikMatchmaker
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API FSikMatchmakerServer
+{
+public:
+	explicit FSikMatchmakerServer(const FSikMatchmakerSettings& InSettings);
+
+	~FSikMatchmakerServer();
+
+	/**
+	 * Binds the given port and starts serving, on loopback only unless told otherwise
+	 * 
+	 * @param InPort: Port the clients send to
+	 * @param bInBindAny: True to serve every network interface, the server trusts whatever reaches it
+	 * @return true if the port could be bound
+	 */
+	bool Start(int32 InPort, bool bInBindAny = false);
+
+	/** Stops serving and closes the socket, the tickets are kept */
+	void Stop();
+
+	/** @returns the matchmaker served, local clients call it directly */
+	TSharedRef<FSikMatchmaker> GetMatchmaker() const { return Matchmaker; }
+
+	/**
+	 * Passes one request datagram on to the matchmaker
+	 * 
+	 * @param InRequest: Datagram as received, see FSikUdpMatchmakerConnection::MakeEnqueueRequest
+	 * @param InNow: Current time in seconds
+	 * @param OutReply: The status datagram to send back, empty for requests without answer
+	 * @return false if the datagram is not a well formed request, it is dropped then
+	 */
+	bool HandleRequest(TConstArrayView<uint8> InRequest, double InNow, TArray<uint8>& OutReply);
+
+private:
+	/** Answers the pending requests and ticks the matchmaker */
+	bool Tick(float DeltaTime);
+
+	TSharedRef<FSikMatchmaker> Matchmaker;
+
+	/** Socket bound to the server port */
+	FSocket* Socket = nullptr;
+
+	/** Ticker serving the requests while the server runs */
+	FTSTicker::FDelegateHandle TickerHandle;
+};
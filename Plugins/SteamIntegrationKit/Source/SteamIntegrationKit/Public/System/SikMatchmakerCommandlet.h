@@ -0,0 +1,26 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SikMatchmakerCommandlet.generated.h"
+
+/**
+ * Runs the matchmaker as a standalone local server, the games reach it with MatchmakerTransport set to Udp
+ * 
+ * UnrealEditor-Cmd <Project> -run=SikMatchmaker [-Port=<port>] [-BindAny]
+ * Without -Port the port of MatchmakerAddress is used, the tuning is read from the USikSubsystem config
+ * Listens on loopback only unless -BindAny or bMatchmakerServerBindAny is set
+ * Serves until the process is asked to exit
+ ******************************************************************************************/
+UCLASS()
+class STEAMINTEGRATIONKIT_API USikMatchmakerCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USikMatchmakerCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
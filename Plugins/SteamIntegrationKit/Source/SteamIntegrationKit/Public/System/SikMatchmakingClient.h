@@ -0,0 +1,125 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/TimerHandle.h"
+#include "System/SikMatchmaker.h"
+#include "System/SikSessionTask.h"
+
+class USikSubsystem;
+struct FSikCustomSessionSettings;
+enum class ESikMatchResult : uint8;
+
+/** Where the matchmaking of FSikMatchmakingClient stands */
+enum class ESikMatchmakingStage : uint8
+{
+	None,
+	/** Ticket enqueued, waiting to be matched */
+	Queued,
+	/** Picked to host, creating the session */
+	Hosting,
+	/** Session created, waiting for the lobby to load before reporting the session to the matchmaker */
+	AwaitingTravel,
+	/** Lobby loaded, reporting the session code until the matchmaker acknowledges it */
+	Reporting,
+	/** Looking up and joining the session of the host */
+	Joining
+};
+
+/**
+ * Matchmaking of USikSubsystem, enqueues the player with FSikMatchmaker through an ISikMatchmakerConnection
+ * and hosts or joins the match it is put into through the session operations of the subsystem
+ * Owned by the subsystem, which exposes StartMatchmaking, CancelMatchmaking and the outcome delegate
+ ******************************************************************************************/
+class FSikMatchmakingClient
+{
+public:
+	explicit FSikMatchmakingClient(USikSubsystem& InSubsystem);
+
+	~FSikMatchmakingClient();
+
+	UE_NONCOPYABLE(FSikMatchmakingClient);
+
+	/** See USikSubsystem::StartMatchmaking */
+	void Start(const FString& InRegion, int32 InSkill, const FSikCustomSessionSettings& InPreferences);
+
+	/** See USikSubsystem::CancelMatchmaking */
+	void Cancel();
+
+	/** @returns true while matchmaking is waiting for, joining or hosting a match */
+	bool IsMatchmaking() const
+	{
+		return Stage == ESikMatchmakingStage::Queued || Stage == ESikMatchmakingStage::Hosting || Stage == ESikMatchmakingStage::Joining;
+	}
+
+	/** Called once the host is in the lobby of its match, the other members are handed the session code from now on */
+	void OnLobbyLoaded();
+
+private:
+	/** Creates the connection to the matchmaker for the configured transport */
+	void CreateConnection();
+
+	/** Enqueues a new ticket, the previous one is forgotten */
+	void EnqueueTicket();
+
+	/** Poll timer callback, keeps the ticket alive, gives up once MatchmakingTimeout has passed while queued */
+	void Poll();
+
+	/** Handles the answers of the matchmaker about the current ticket */
+	void OnStatus(const FSikMatchmakingStatus& InStatus);
+
+	/** Creates the session of the match with the settings its members agreed on */
+	void HostMatch();
+
+	/** Keeps the code of the created session to report it once the lobby is loaded */
+	void OnHostComplete(const FSikSessionTaskResult& InResult);
+
+	/** Leaves the queue and looks up the session the host reported */
+	void JoinMatch();
+
+	/** Joins the session found */
+	void OnSessionFound(const FSikSessionTaskResult& InResult);
+
+	/** Ends the matchmaking once joined, enqueues again while there is time left otherwise */
+	void OnJoinComplete(const FSikSessionTaskResult& InResult);
+
+	/**
+	 * Tracks the step as the running one, the given function is called once it completes unless the step was replaced or dropped meanwhile
+	 * 
+	 * @param InStep: Step to track
+	 * @param InOnComplete: Called with the outcome of the step
+	 */
+	void RunStep(const FSikSessionTaskHandle& InStep, void (FSikMatchmakingClient::*InOnComplete)(const FSikSessionTaskResult&));
+
+	/** Broadcasts the outcome, matchmaking stays around to report the session after Hosted */
+	void Finish(ESikMatchResult InResult);
+
+	/** Cancels the ticket and stops polling */
+	void Stop();
+
+	/** Subsystem owning this client, its session operations host and join the match */
+	USikSubsystem& Subsystem;
+
+	/** Connection to the matchmaker, created by the first Start */
+	TSharedPtr<ISikMatchmakerConnection> Connection;
+
+	ESikMatchmakingStage Stage = ESikMatchmakingStage::None;
+
+	/** Ticket of the player, a new one is enqueued after a failed join */
+	FSikMatchmakingTicket Ticket;
+
+	/** Match the player was put into */
+	FSikMatchAssignment Assignment;
+
+	/** Code of the session hosted for the match, reported once the lobby is loaded */
+	FString SessionCode;
+
+	/** Time matchmaking gives up while still queued */
+	double DeadlineTime = 0.0;
+
+	/** Create, lookup or join matchmaking is waiting on */
+	FSikSessionTaskHandle Step;
+
+	FTimerHandle PollTimerHandle;
+};
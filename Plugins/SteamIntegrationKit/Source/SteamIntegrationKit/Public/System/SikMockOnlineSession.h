@@ -0,0 +1,154 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/OnlineSessionInterface.h"
+#include "OnlineSessionSettings.h"
+#include "Math/RandomStream.h"
+
+/**
+ * Settings the mock backend synthesizes its lobbies and answers with
+ ******************************************************************************************/
+struct FSikMockBackendSettings
+{
+	/** Seed of every random decision, same seed and same calls give the same answers */
+	int32 Seed = 1;
+
+	/** Number of lobbies hosted by other players */
+	int32 LobbyCount = 200;
+
+	/** Seconds each operation takes before its completion is triggered */
+	float Latency = 0.05f;
+
+	/** Random seconds added to or removed from Latency */
+	float LatencyJitter = 0.02f;
+
+	/** Chance from 0 to 1 that an operation fails */
+	float FailureRate = 0.f;
+
+	/** Values the lobbies are hosted with, picked at random for each lobby */
+	TArray<FString> MapNames;
+	TArray<FString> GameModes;
+	TArray<FString> Players;
+
+	/** Chance from 0 to 1 that a lobby is private */
+	float PrivateLobbyRate = 0.1f;
+};
+
+/**
+ * Session interface answering from synthesized lobbies instead of an online service
+ * Lets the session flows of USikSubsystem run without a Steam client, on headless machines and in benchmarks
+ * Completions are triggered from the core ticker after the configured latency, never from within the call
+ * 
+ * Sessions created here are added to the lobbies so they can be found and joined by code from the same process
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API FSikMockOnlineSession : public IOnlineSession, public TSharedFromThis<FSikMockOnlineSession, ESPMode::ThreadSafe>
+{
+public:
+	/** Synthesizes the lobbies from the given settings */
+	explicit FSikMockOnlineSession(const FSikMockBackendSettings& InSettings);
+
+	virtual ~FSikMockOnlineSession() override;
+
+	/** @returns the id of the local user, used when no local player is signed in */
+	FUniqueNetIdRef GetLocalUserId() const { return LocalUserId; }
+
+	/** @returns the settings the lobbies were synthesized with */
+	const FSikMockBackendSettings& GetSettings() const { return Settings; }
+
+	/** @returns every lobby that can be found, used by the benchmarks as synthetic search results */
+	const TArray<FOnlineSessionSearchResult>& GetLobbies() const { return Lobbies; }
+
+#pragma region IOnlineSession
+
+	virtual FUniqueNetIdPtr CreateSessionIdFromString(const FString& SessionIdStr) override;
+	virtual FNamedOnlineSession* GetNamedSession(FName SessionName) override;
+	virtual void RemoveNamedSession(FName SessionName) override;
+	virtual EOnlineSessionState::Type GetSessionState(FName SessionName) const override;
+	virtual bool HasPresenceSession() override;
+	virtual bool CreateSession(int32 HostingPlayerNum, FName SessionName, const FOnlineSessionSettings& NewSessionSettings) override;
+	virtual bool CreateSession(const FUniqueNetId& HostingPlayerId, FName SessionName, const FOnlineSessionSettings& NewSessionSettings) override;
+	virtual bool StartSession(FName SessionName) override;
+	virtual bool UpdateSession(FName SessionName, FOnlineSessionSettings& UpdatedSessionSettings, bool bShouldRefreshOnlineData = true) override;
+	virtual bool EndSession(FName SessionName) override;
+	virtual bool DestroySession(FName SessionName, const FOnDestroySessionCompleteDelegate& CompletionDelegate = FOnDestroySessionCompleteDelegate()) override;
+	virtual bool IsPlayerInSession(FName SessionName, const FUniqueNetId& UniqueId) override;
+	virtual bool StartMatchmaking(const TArray<FUniqueNetIdRef>& LocalPlayers, FName SessionName, const FOnlineSessionSettings& NewSessionSettings, TSharedRef<FOnlineSessionSearch>& SearchSettings) override;
+	virtual bool CancelMatchmaking(int32 SearchingPlayerNum, FName SessionName) override;
+	virtual bool CancelMatchmaking(const FUniqueNetId& SearchingPlayerId, FName SessionName) override;
+	virtual bool FindSessions(int32 SearchingPlayerNum, const TSharedRef<FOnlineSessionSearch>& SearchSettings) override;
+	virtual bool FindSessions(const FUniqueNetId& SearchingPlayerId, const TSharedRef<FOnlineSessionSearch>& SearchSettings) override;
+	virtual bool FindSessionById(const FUniqueNetId& SearchingUserId, const FUniqueNetId& SessionId, const FUniqueNetId& FriendId, const FOnSingleSessionResultCompleteDelegate& CompletionDelegate) override;
+	virtual bool CancelFindSessions() override;
+	virtual bool PingSearchResults(const FOnlineSessionSearchResult& SearchResult) override;
+	virtual bool JoinSession(int32 LocalUserNum, FName SessionName, const FOnlineSessionSearchResult& DesiredSession) override;
+	virtual bool JoinSession(const FUniqueNetId& LocalUserId, FName SessionName, const FOnlineSessionSearchResult& DesiredSession) override;
+	virtual bool FindFriendSession(int32 LocalUserNum, const FUniqueNetId& Friend) override;
+	virtual bool FindFriendSession(const FUniqueNetId& LocalUserId, const FUniqueNetId& Friend) override;
+	virtual bool FindFriendSession(const FUniqueNetId& LocalUserId, const TArray<FUniqueNetIdRef>& FriendList) override;
+	virtual bool SendSessionInviteToFriend(int32 LocalUserNum, FName SessionName, const FUniqueNetId& Friend) override;
+	virtual bool SendSessionInviteToFriend(const FUniqueNetId& LocalUserId, FName SessionName, const FUniqueNetId& Friend) override;
+	virtual bool SendSessionInviteToFriends(int32 LocalUserNum, FName SessionName, const TArray<FUniqueNetIdRef>& Friends) override;
+	virtual bool SendSessionInviteToFriends(const FUniqueNetId& LocalUserId, FName SessionName, const TArray<FUniqueNetIdRef>& Friends) override;
+	virtual bool GetResolvedConnectString(FName SessionName, FString& ConnectInfo, FName PortType = NAME_GamePort) override;
+	virtual bool GetResolvedConnectString(const FOnlineSessionSearchResult& SearchResult, FName PortType, FString& ConnectInfo) override;
+	virtual FOnlineSessionSettings* GetSessionSettings(FName SessionName) override;
+	virtual bool RegisterPlayer(FName SessionName, const FUniqueNetId& PlayerId, bool bWasInvited) override;
+	virtual bool RegisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef>& Players, bool bWasInvited = false) override;
+	virtual bool UnregisterPlayer(FName SessionName, const FUniqueNetId& PlayerId) override;
+	virtual bool UnregisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef>& Players) override;
+	virtual void RegisterLocalPlayer(const FUniqueNetId& PlayerId, FName SessionName, const FOnRegisterLocalPlayerCompleteDelegate& Delegate) override;
+	virtual void UnregisterLocalPlayer(const FUniqueNetId& PlayerId, FName SessionName, const FOnUnregisterLocalPlayerCompleteDelegate& Delegate) override;
+	virtual void RemovePlayerFromSession(int32 LocalUserNum, FName SessionName, const FUniqueNetId& TargetPlayerId) override;
+	virtual int32 GetNumSessions() override;
+	virtual void DumpSessionState() override;
+
+protected:
+	virtual FNamedOnlineSession* AddNamedSession(FName SessionName, const FOnlineSessionSettings& SessionSettings) override;
+	virtual FNamedOnlineSession* AddNamedSession(FName SessionName, const FOnlineSession& Session) override;
+
+#pragma endregion IOnlineSession
+
+private:
+	/** Runs the given completion once the simulated latency has passed, dropped if this session is destroyed first */
+	FTSTicker::FDelegateHandle Schedule(TFunction<void(FSikMockOnlineSession&)>&& InCompletion);
+
+	/** @returns the next simulated latency in seconds */
+	float NextLatency();
+
+	/** @returns true if the next operation should fail */
+	bool NextOperationFails();
+
+	/** Adds a lobby hosted by someone else, or by the local user when InHostId is the local user id */
+	FOnlineSessionSearchResult& AddLobby(const FOnlineSessionSettings& InSessionSettings, const FUniqueNetIdRef& InHostId, const FString& InHostName);
+
+	/** @returns a new session id formatted like a Steam lobby id, so session codes can encode it */
+	FString GenerateLobbyId();
+
+	/** @returns true if the lobby matches every term of the search */
+	static bool MatchesSearch(const FOnlineSessionSearchResult& InLobby, const FOnlineSessionSearch& InSearch);
+
+	/** @returns the lobby with the given session id, nullptr if there is none */
+	FOnlineSessionSearchResult* FindLobby(const FString& InSessionId);
+
+	/** Settings the lobbies were synthesized with */
+	FSikMockBackendSettings Settings;
+
+	/** Source of every random decision */
+	FRandomStream RandomStream;
+
+	/** Id of the local user */
+	FUniqueNetIdRef LocalUserId;
+
+	/** Every lobby that can be found, including the ones created locally */
+	TArray<FOnlineSessionSearchResult> Lobbies;
+
+	/** Sessions the local user created or joined */
+	TArray<FNamedOnlineSession> Sessions;
+
+	/** Search waiting for its simulated latency to pass */
+	TSharedPtr<FOnlineSessionSearch> PendingSearch;
+	FTSTicker::FDelegateHandle PendingSearchHandle;
+};
@@ -0,0 +1,51 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+
+/**
+ * Decides how long the session browser waits before asking the backend again
+ * 
+ * - Visible list whose results keep changing polls at MinInterval
+ * - Visible but stable list, or a list in the background, polls at IdleInterval
+ * - Empty or failed results back off exponentially from MinInterval up to MaxBackoffInterval
+ * - Every delay gets a random jitter so clients opened at the same time do not poll in lockstep
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API FSikPollScheduler
+{
+public:
+	/** Seconds between polls while the list is visible and changing, also the floor of every delay */
+	float MinInterval = 2.f;
+
+	/** Seconds between polls while the list is stable or not visible */
+	float IdleInterval = 8.f;
+
+	/** Upper bound of the backoff applied to empty and failed results */
+	float MaxBackoffInterval = 60.f;
+
+	/** Fraction of the delay added or removed at random, 0.2 means +-20% */
+	float JitterFraction = 0.2f;
+
+	/** Clears the backoff, called when polling starts */
+	void Reset();
+
+	/**
+	 * Computes the delay before the next poll from the outcome of the last one
+	 * 
+	 * @param bWasSuccessful: True if the last search succeeded
+	 * @param bWasEmpty: True if the last search returned no sessions
+	 * @param bHasChanged: True if the results differ from the ones before
+	 * @param bIsVisible: True if the list is on screen and the game has focus
+	 * @return seconds to wait before polling again
+	 */
+	float ComputeNextDelay(bool bWasSuccessful, bool bWasEmpty, bool bHasChanged, bool bIsVisible);
+
+private:
+	/** Number of empty or failed polls in a row */
+	int32 ConsecutiveEmptyPolls = 0;
+
+	/** Source of the jitter */
+	FRandomStream RandomStream = FRandomStream(static_cast<int32>(FPlatformTime::Cycles()));
+};
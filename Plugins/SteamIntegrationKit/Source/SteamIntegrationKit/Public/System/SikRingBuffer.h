@@ -0,0 +1,140 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Bounded lock free queue for many producers and a single consumer
+ * 
+ * Every slot carries a sequence number telling whether it is free to write or ready to read,
+ * producers claim a slot with a single compare exchange and never wait on each other or on the consumer
+ * Pushing into a full queue fails instead of blocking, the caller decides what to drop
+ * 
+ * Capacity is rounded up to a power of two
+ ******************************************************************************************/
+template <typename ElementType>
+class TSikMpscRingBuffer
+{
+public:
+	explicit TSikMpscRingBuffer(uint32 InCapacity)
+		: Capacity(FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 2u)))
+		, Mask(Capacity - 1)
+		, Slots(MakeUnique<FSlot[]>(Capacity))
+	{
+		for (uint32 Index = 0; Index < Capacity; ++Index)
+		{
+			Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+		}
+	}
+
+	UE_NONCOPYABLE(TSikMpscRingBuffer);
+
+	/** 
+	 * Moves the element into the queue, safe to call from any thread
+	 * @returns false if the queue is full, the element is left untouched then
+	 */
+	bool Push(ElementType&& InElement)
+	{
+		return PushInPlace([&InElement](ElementType& OutSlotElement)
+		{
+			OutSlotElement = MoveTemp(InElement);
+		});
+	}
+
+	/** 
+	 * Claims a slot and lets the writer fill the element in it, safe to call from any thread
+	 * The consumer stops at the slot until the writer returns, keep it short
+	 * @returns false if the queue is full, the writer is not called then
+	 */
+	template <typename WriterType>
+	bool PushInPlace(WriterType&& InWriter)
+	{
+		uint64 Position = PushPosition.load(std::memory_order_relaxed);
+		
+		for (;;)
+		{
+			FSlot& Slot = Slots[Position & Mask];
+			const uint64 Sequence = Slot.Sequence.load(std::memory_order_acquire);
+			const int64 Difference = static_cast<int64>(Sequence) - static_cast<int64>(Position);
+			
+			if (Difference == 0)
+			{
+				if (PushPosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					InWriter(Slot.Element);
+					Slot.Sequence.store(Position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (Difference < 0)
+			{
+				return false;
+			}
+			else
+			{
+				Position = PushPosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/** 
+	 * Moves the oldest element out of the queue, only ever call from the one consumer thread
+	 * @returns false if the queue is empty
+	 */
+	bool Pop(ElementType& OutElement)
+	{
+		return PopInPlace([&OutElement](ElementType& InSlotElement)
+		{
+			OutElement = MoveTemp(InSlotElement);
+		});
+	}
+
+	/** 
+	 * Lets the reader handle the oldest element where it is stored, only ever call from the one consumer thread
+	 * @returns false if the queue is empty, the reader is not called then
+	 */
+	template <typename ReaderType>
+	bool PopInPlace(ReaderType&& InReader)
+	{
+		const uint64 Position = PopPosition.load(std::memory_order_relaxed);
+		
+		FSlot& Slot = Slots[Position & Mask];
+		if (Slot.Sequence.load(std::memory_order_acquire) != Position + 1)
+		{
+			return false;
+		}
+		
+		InReader(Slot.Element);
+		Slot.Sequence.store(Position + Capacity, std::memory_order_release);
+		PopPosition.store(Position + 1, std::memory_order_relaxed);
+		
+		return true;
+	}
+
+	/** @returns the number of queued elements, only a hint while producers are pushing */
+	uint32 NumApprox() const
+	{
+		return static_cast<uint32>(PushPosition.load(std::memory_order_relaxed) - PopPosition.load(std::memory_order_relaxed));
+	}
+
+	uint32 GetCapacity() const { return Capacity; }
+
+private:
+	struct FSlot
+	{
+		std::atomic<uint64> Sequence { 0 };
+		ElementType Element;
+	};
+
+	const uint32 Capacity;
+	const uint32 Mask;
+	TUniquePtr<FSlot[]> Slots;
+
+	/** Next position to push to, shared by the producers and kept apart from the consumer's to avoid false sharing */
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> PushPosition { 0 };
+
+	/** Next position to pop from, only written by the consumer */
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> PopPosition { 0 };
+};
@@ -0,0 +1,71 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "Subsystem/SikSubsystem.h"
+#include "SikSessionAsyncAction.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSikSessionAsyncActionOutputPin, ESikSessionOperationResult, Result);
+
+/**
+ * Latent Blueprint nodes awaiting one session operation, see the Async functions of USikSubsystem
+ * Exactly one of the output pins fires, after the operation completes, times out or the node is cancelled
+ ******************************************************************************************/
+UCLASS()
+class STEAMINTEGRATIONKIT_API USikSessionAsyncAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Fired when the operation succeeded */
+	UPROPERTY(BlueprintAssignable)
+	FSikSessionAsyncActionOutputPin OnSuccess;
+
+	/** Fired when the operation failed, timed out or was cancelled */
+	UPROPERTY(BlueprintAssignable)
+	FSikSessionAsyncActionOutputPin OnFailure;
+
+	/**
+	 * Creates a session and waits for the outcome
+	 * 
+	 * @param Timeout: Seconds to wait for the backend, zero or less uses the subsystem's default
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Sessions", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Create Session (Async)"))
+	static USikSessionAsyncAction* CreateSessionAsync(UObject* WorldContextObject, const FSikCustomSessionSettings& SessionSettings, float Timeout = 0.f);
+
+	/** Starts the created session and waits for the outcome */
+	UFUNCTION(BlueprintCallable, Category = "Sessions", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Start Session (Async)"))
+	static USikSessionAsyncAction* StartSessionAsync(UObject* WorldContextObject, float Timeout = 0.f);
+
+	/**
+	 * Looks the session code up, joins the session and travels to it
+	 * 
+	 * @param Timeout: Seconds each step may take, zero or less uses the subsystem's default
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Sessions", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Join Session By Code (Async)"))
+	static USikSessionAsyncAction* JoinSessionByCodeAsync(UObject* WorldContextObject, const FString& SessionCode, float Timeout = 0.f);
+
+	/** Stops waiting, OnFailure fires with Cancelled unless the operation already completed */
+	UFUNCTION(BlueprintCallable, Category = "Sessions")
+	void Cancel();
+
+	virtual void Activate() override;
+
+private:
+	/** Creates the node, the operation is started once the node is activated */
+	static USikSessionAsyncAction* MakeAction(UObject* WorldContextObject, TFunction<FSikSessionTaskHandle(USikSubsystem&)>&& InStartOperation);
+
+	/** Fires the output pin matching the result and releases the node */
+	void OnTaskComplete(const FSikSessionTaskResult& InResult);
+
+	/** World the node was called from */
+	TWeakObjectPtr<UObject> WorldContext;
+
+	/** Starts the awaited operation on the subsystem */
+	TFunction<FSikSessionTaskHandle(USikSubsystem&)> StartOperation;
+
+	/** Handle of the running operation */
+	FSikSessionTaskHandle TaskHandle;
+};
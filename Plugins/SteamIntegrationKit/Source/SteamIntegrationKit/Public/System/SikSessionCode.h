@@ -0,0 +1,62 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Reversible session code scheme
+ * 
+ * A code is SETTING_SESSION_CODELENGTH characters of the BCDFGHJKLMNPQRSTVWXZ alphabet:
+ * eight payload characters holding a base 20 number followed by one Luhn mod 20 check character
+ * 
+ * Payloads below 2^32 carry the scrambled account part of a Steam lobby id, so the code decodes back
+ * into the id of the lobby it was created for and two lobbies can never share a code
+ * Payloads from 2^32 upwards are random codes for backends whose session ids do not fit the scheme,
+ * those can only be found through the session key search
+ * 
+ * Backends without a lookup by id, Steam among them, gain nothing from the longer code and use
+ * SETTING_SESSION_SHORTCODELENGTH random characters instead, found through the session key search as well
+ ******************************************************************************************/
+struct STEAMINTEGRATIONKIT_API FSikSessionCode
+{
+	/**
+	 * Encodes the given session id into a session code
+	 * 
+	 * @param InSessionId: Session id as returned by FUniqueNetId::ToString
+	 * @param OutCode: The encoded session code
+	 * @return true if the id is a lobby id the scheme can encode
+	 */
+	static bool EncodeSessionId(const FString& InSessionId, FString& OutCode);
+
+	/**
+	 * Decodes the session id back out of a session code
+	 * 
+	 * @param InCode: Session code entered by the user
+	 * @param OutSessionId: The decoded session id, in the format accepted by IOnlineSession::CreateSessionIdFromString
+	 * @return true if the code is well formed, passes the checksum and carries a session id
+	 */
+	static bool DecodeSessionId(const FString& InCode, FString& OutSessionId);
+
+	/** @return a random code with a valid checksum whose payload never decodes into a session id */
+	static FString GenerateRandomCode();
+
+	/** @return a random code of SETTING_SESSION_SHORTCODELENGTH characters, without check character */
+	static FString GenerateShortCode();
+
+	/** @return true if the code has the expected length, alphabet and check character */
+	static bool IsWellFormed(const FString& InCode);
+
+	/** @return true if the code is a short code, SETTING_SESSION_SHORTCODELENGTH characters of the alphabet */
+	static bool IsWellFormedShortCode(const FString& InCode);
+
+private:
+	/** Appends the check character and returns the finished code for the given payload */
+	static FString BuildCode(uint64 InPayload);
+
+	/** Reads the payload out of a well formed code */
+	static uint64 ReadPayload(const FString& InCode);
+
+	/** @return the Luhn mod 20 check character index for the given payload characters */
+	static int32 ComputeCheckIndex(const FString& InPayloadChars);
+};
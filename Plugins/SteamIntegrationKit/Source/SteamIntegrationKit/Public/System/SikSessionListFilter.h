@@ -0,0 +1,64 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystem/SikSubsystem.h"
+
+/**
+ * Session of the filtered list along with the settings read out of it
+ ******************************************************************************************/
+struct FSikSessionListEntry
+{
+	/** Session id, widgets of the session browser are keyed by it */
+	FString Key;
+
+	/** Settings the session is hosted with, see FSikSessionSchema::ToReadable for the names */
+	FSikPackedSessionSettings Settings;
+
+	/** The session, points into the results the list was built from */
+	const FOnlineSessionSearchResult* SearchResult = nullptr;
+
+	/** Index of the session in the results the list was built from */
+	int32 ResultIndex = INDEX_NONE;
+};
+
+/**
+ * Filter and diff step of the session browser, shared by USikHudWidget::UpdateSessionsList and the benchmarks
+ * The backend already applies the filter, it is checked again only to guard against backends ignoring query terms
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API FSikSessionListFilter
+{
+public:
+	/** @param InFilter: Filter the user has selected in the session browser */
+	explicit FSikSessionListFilter(const FSikCustomSessionSettings& InFilter);
+
+	/**
+	 * @returns true if the session has open slots, is public, uses this build's schema and matches the filter
+	 * 
+	 * @param InSearchResult: Session to check
+	 * @param OutSettings: Settings read out of the session, filled even if it does not match
+	 */
+	bool Matches(const FOnlineSessionSearchResult& InSearchResult, FSikPackedSessionSettings& OutSettings) const;
+
+	/**
+	 * Filters the results and compares them with the sessions listed before
+	 * 
+	 * @param InSearchResults: Results of the last search
+	 * @param InPreviousKeys: Keys of the sessions listed before
+	 * @param OutEntries: Sessions to list, in the order of the results
+	 * @param OutKeys: Keys of the sessions to list
+	 * @param OutRemovedKeys: Keys listed before that are not listed anymore
+	 */
+	void Apply(const TArray<FOnlineSessionSearchResult>& InSearchResults, const TSet<FString>& InPreviousKeys, 
+		TArray<FSikSessionListEntry>& OutEntries, TSet<FString>& OutKeys, TArray<FString>& OutRemovedKeys) const;
+
+private:
+	/** Filter the user has selected, names resolved to ids once so each result is checked with integer compares */
+	FSikPackedSessionSettings Filter;
+
+	/** True when the filter field is "Any" */
+	bool bShowAllMap = true;
+	bool bShowAllGameMode = true;
+	bool bShowAllPlayers = true;
+};
@@ -0,0 +1,145 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "SikSessionMetrics.generated.h"
+
+DECLARE_STATS_GROUP(TEXT("SteamIntegrationKit"), STATGROUP_Sik, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Session operations started"), STAT_SikSessionOperationsStarted, STATGROUP_Sik, STEAMINTEGRATIONKIT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Session operations failed"), STAT_SikSessionOperationsFailed, STATGROUP_Sik, STEAMINTEGRATIONKIT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Session searches started"), STAT_SikSessionSearchesStarted, STATGROUP_Sik, STEAMINTEGRATIONKIT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Sessions in last search"), STAT_SikSessionSearchResults, STATGROUP_Sik, STEAMINTEGRATIONKIT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Latency probes in flight"), STAT_SikLatencyProbesInFlight, STATGROUP_Sik, STEAMINTEGRATIONKIT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Open spans"), STAT_SikOpenSpans, STATGROUP_Sik, STEAMINTEGRATIONKIT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Matchmaking tickets waiting"), STAT_SikMatchmakingTicketsWaiting, STATGROUP_Sik, STEAMINTEGRATIONKIT_API);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Find sessions complete"), STAT_SikFindSessionsComplete, STATGROUP_Sik, STEAMINTEGRATIONKIT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Session list filter"), STAT_SikSessionListFilter, STATGROUP_Sik, STEAMINTEGRATIONKIT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update sessions list"), STAT_SikUpdateSessionsList, STATGROUP_Sik, STEAMINTEGRATIONKIT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Rank sessions"), STAT_SikRankSessions, STATGROUP_Sik, STEAMINTEGRATIONKIT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Form matches"), STAT_SikFormMatches, STATGROUP_Sik, STEAMINTEGRATIONKIT_API);
+
+/** Session operations, from the call on USikSubsystem to its completion callback */
+#define SIK_SPAN_CREATESESSION FName("Sik.CreateSession")
+#define SIK_SPAN_FINDSESSIONS FName("Sik.FindSessions")
+#define SIK_SPAN_FINDSESSIONBYCODE FName("Sik.FindSessionByCode")
+#define SIK_SPAN_JOINSESSION FName("Sik.JoinSession")
+#define SIK_SPAN_DESTROYSESSION FName("Sik.DestroySession")
+#define SIK_SPAN_STARTSESSION FName("Sik.StartSession")
+
+/** End to end flows of the menu, from the button press until the player is in the lobby */
+#define SIK_SPAN_HOSTGAME FName("Sik.Flow.HostGame")
+#define SIK_SPAN_JOINBYCODE FName("Sik.Flow.JoinByCode")
+#define SIK_SPAN_SERVERTRAVEL FName("Sik.Flow.ServerTravel")
+#define SIK_SPAN_CLIENTTRAVEL FName("Sik.Flow.ClientTravel")
+
+/** From the network failure until the client is back in the session's map, or gives up */
+#define SIK_SPAN_RECONNECT FName("Sik.Flow.Reconnect")
+
+/** Time to match, from USikSubsystem::QuickMatch until a session is joined or hosted, travel not included */
+#define SIK_SPAN_QUICKMATCH FName("Sik.Flow.QuickMatch")
+
+/** Time to match, from USikSubsystem::StartMatchmaking until the matched session is joined or hosted, travel not included */
+#define SIK_SPAN_MATCHMAKING FName("Sik.Flow.Matchmaking")
+
+/** Rolling percentiles of the durations a span took */
+USTRUCT(BlueprintType)
+struct FSikLatencyPercentiles
+{
+	GENERATED_BODY()
+
+	/** Number of successful completions the percentiles are computed from, at most the window size */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	int32 SampleCount = 0;
+
+	/** Completions since start up or the last reset */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	int32 SucceededCount = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	int32 FailedCount = 0;
+
+	/** Durations in ms, zero while there are no samples */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	float P50 = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	float P95 = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	float P99 = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	float Max = 0.f;
+};
+
+/**
+ * Measures the session operations and flows, owned by USikSubsystem
+ * 
+ * A span is opened when an operation or flow starts and closed when it completes, possibly frames later
+ * Each open span is an Unreal Insights trace region, so the async gap shows on the timing view
+ * Successful durations are kept in a rolling window per span, queried as percentiles in process or with "Sik.Stats"
+ * 
+ * Only one span of each name is open at a time, opening it again restarts it
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API FSikSessionMetrics
+{
+public:
+	/** Opens the span, restarts it if it is already open */
+	void BeginSpan(FName InSpan);
+
+	/**
+	 * Closes the span and records its duration, does nothing if it is not open
+	 * 
+	 * @param InSpan: Span to close
+	 * @param bSucceeded: Only successful durations are added to the percentiles, failures are counted
+	 */
+	void EndSpan(FName InSpan, bool bSucceeded);
+
+	/** Closes the span without recording it, used when the operation was abandoned */
+	void CancelSpan(FName InSpan);
+
+	/** Closes every open span as failed, used when the session is torn down */
+	void FailOpenSpans();
+
+	/** @returns true if the span is open */
+	bool IsSpanOpen(FName InSpan) const { return OpenSpans.Contains(InSpan); }
+
+	/** @returns the percentiles of the given span, empty if it never completed */
+	FSikLatencyPercentiles GetPercentiles(FName InSpan) const;
+
+	/** @returns the names of every span that completed at least once */
+	TArray<FName> GetSpanNames() const;
+
+	/** Forgets every recorded duration, open spans stay open */
+	void Reset();
+
+	/** Sets the number of durations the percentiles are computed from, clamped to at least one */
+	void SetWindowSize(int32 InWindowSize);
+
+	/** Logs a line with the percentiles of every span */
+	void LogSummary() const;
+
+private:
+	/** Rolling window of the durations of a span */
+	struct FSpanHistory
+	{
+		/** Durations in ms, overwritten oldest first once the window is full */
+		TArray<float> Samples;
+		int32 NextSample = 0;
+
+		int32 SucceededCount = 0;
+		int32 FailedCount = 0;
+	};
+
+	/** Closes the trace region of the span */
+	void CloseSpan(FName InSpan);
+
+	/** Start time of every open span */
+	TMap<FName, double> OpenSpans;
+
+	/** Recorded durations of every span that completed */
+	TMap<FName, FSpanHistory> SpanHistories;
+
+	/** Number of durations kept per span */
+	int32 WindowSize = 256;
+};
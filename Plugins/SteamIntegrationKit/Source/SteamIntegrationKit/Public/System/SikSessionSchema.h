@@ -0,0 +1,129 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SikSessionSchema.generated.h"
+
+struct FSikCustomSessionSettings;
+class FOnlineSessionSettings;
+
+/**
+ * Single session setting the whole schema is advertised under, see FSikPackedSessionSettings::Pack
+ * Doubles as the filter bucket key, a fully specified public filter is sent as one equality term on it
+ */
+#define SETTING_SESSIONSCHEMA FName("SikSettings")
+
+/**
+ * Fields of the schema also advertised as integers of their own, for filters leaving some field on "Any"
+ * Lobby filters only compare whole values, a partial filter cannot be matched against the packed one
+ */
+#define SETTING_SCHEMA_MAP FName("SikMap")
+#define SETTING_SCHEMA_GAMEMODE FName("SikMode")
+#define SETTING_SCHEMA_PLAYERS FName("SikPlayers")
+#define SETTING_SCHEMA_VISIBILITY FName("SikVisibility")
+
+/** Players configuration a session is hosted with */
+UENUM(BlueprintType)
+enum class ESikPlayersConfig : uint8
+{
+	/** Unset, or any configuration when filtering */
+	Any = 0 UMETA(DisplayName = "Any"),
+	OneVsOne UMETA(DisplayName = "1v1"),
+	TwoVsTwo UMETA(DisplayName = "2v2"),
+	FourVsFour UMETA(DisplayName = "4v4")
+};
+
+/** Whether a session is listed in the session browser */
+UENUM(BlueprintType)
+enum class ESikSessionVisibility : uint8
+{
+	Public,
+	Private
+};
+
+/**
+ * Typed form of FSikCustomSessionSettings, advertised by the host as one integer
+ * Map and game mode are ids into the name tables of USikSubsystem (SessionMapNames, SessionGameModes), 0 is unset
+ * 
+ * Layout of the packed value, bit 31 stays clear so backends storing it signed compare it the same way
+ *      * Bits 0 to 7: Map id
+ *      * Bits 8 to 15: Game mode id
+ *      * Bits 16 to 19: Players
+ *      * Bit 20: Private
+ *      * Bits 24 to 27: Schema version, values of another version do not unpack
+ ******************************************************************************************/
+USTRUCT(BlueprintType)
+struct STEAMINTEGRATIONKIT_API FSikPackedSessionSettings
+{
+	GENERATED_BODY()
+
+	/** Index + 1 of the map in USikSubsystem::SessionMapNames */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings")
+	uint8 MapId = 0;
+
+	/** Index + 1 of the game mode in USikSubsystem::SessionGameModes */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings")
+	uint8 GameModeId = 0;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings")
+	ESikPlayersConfig Players = ESikPlayersConfig::Any;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings")
+	ESikSessionVisibility Visibility = ESikSessionVisibility::Public;
+
+	/** Bumped whenever the layout or the meaning of an id changes, so mismatched builds do not list each other's sessions */
+	static constexpr int32 SchemaVersion = 1;
+
+	/** @returns the value advertised under SETTING_SESSIONSCHEMA */
+	int32 Pack() const;
+
+	/**
+	 * Reads settings out of an advertised value
+	 * 
+	 * @return false if the value was packed with another schema version
+	 */
+	static bool Unpack(int32 InPacked, FSikPackedSessionSettings& OutSettings);
+
+	/** @returns the number of public connections the players configuration needs, 2 if unset */
+	int32 GetNumPublicConnections() const;
+
+	bool operator==(const FSikPackedSessionSettings& Other) const
+	{
+		return MapId == Other.MapId && GameModeId == Other.GameModeId && Players == Other.Players && Visibility == Other.Visibility;
+	}
+};
+
+/**
+ * Converts between the readable settings the UI works with and the packed ones sent over the backend
+ * Names are looked up once at the boundary, everything past it compares integers
+ ******************************************************************************************/
+struct STEAMINTEGRATIONKIT_API FSikSessionSchema
+{
+	/** @returns the id of the map, 0 if it is not in USikSubsystem::SessionMapNames */
+	static uint8 GetMapId(const FString& InMapName);
+
+	/** @returns the id of the game mode, 0 if it is not in USikSubsystem::SessionGameModes */
+	static uint8 GetGameModeId(const FString& InGameMode);
+
+	/** @returns the players configuration written as "1v1", "2v2" or "4v4", Any for anything else */
+	static ESikPlayersConfig ParsePlayers(const FString& InPlayers);
+
+	/** @returns the name of the map, empty if the id is unset or unknown */
+	static FString GetMapName(uint8 InMapId);
+
+	/** @returns the name of the game mode, empty if the id is unset or unknown */
+	static FString GetGameModeName(uint8 InGameModeId);
+
+	/** @returns "1v1", "2v2" or "4v4", empty if unset */
+	static FString GetPlayersName(ESikPlayersConfig InPlayers);
+
+	/** Looks up the ids of the readable settings, unknown names end up unset */
+	static FSikPackedSessionSettings FromReadable(const FSikCustomSessionSettings& InSettings);
+
+	/** Looks up the names of the typed settings */
+	static FSikCustomSessionSettings ToReadable(const FSikPackedSessionSettings& InSettings);
+
+	/** Sets the packed value and the per field keys the backend filters on, see SETTING_SCHEMA_MAP */
+	static void Advertise(const FSikPackedSessionSettings& InSettings, FOnlineSessionSettings& OutSessionSettings);
+};
@@ -0,0 +1,107 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSessionSettings.h"
+#include "Online/OnlineSessionNames.h"
+
+struct FSikSessionHandle;
+
+/**
+ * Results of one session search, frozen once the search completes and shared by everyone reading them
+ * 
+ * The subsystem hands out the snapshot itself or handles into it instead of copies of the results,
+ * so a refresh costs one move of the results whatever the number of listeners and widgets
+ * A snapshot is never modified, the next search makes a new one, with the next generation
+ ******************************************************************************************/
+class FSikSessionSearchSnapshot : public TSharedFromThis<FSikSessionSearchSnapshot>
+{
+public:
+	FSikSessionSearchSnapshot() = default;
+
+	FSikSessionSearchSnapshot(const uint32 InGeneration, TArray<FOnlineSessionSearchResult>&& InResults)
+		: Generation(InGeneration), Results(MoveTemp(InResults)) {}
+
+	/** @returns the number of the search the results come from, 0 for an empty snapshot not coming from any search */
+	uint32 GetGeneration() const { return Generation; }
+
+	/** @returns the sessions found, in the order the backend returned them */
+	const TArray<FOnlineSessionSearchResult>& GetResults() const { return Results; }
+
+	/** @returns a handle to the result at the given index, invalid if out of range */
+	FSikSessionHandle GetHandle(int32 InIndex) const;
+
+	/** 
+	 * @returns a handle to the result advertising the given session code under SETTING_SESSIONKEY, invalid if there is none
+	 * The first lookup indexes every result by its code, the later ones are a single map lookup
+	 */
+	FSikSessionHandle FindBySessionKey(const FString& InSessionKey) const;
+
+private:
+	uint32 Generation = 0;
+
+	TArray<FOnlineSessionSearchResult> Results;
+
+	/** Index of each result by its session code, built by the first FindBySessionKey, the results never change after that */
+	mutable TMap<FString, int32> SessionKeyIndex;
+	mutable bool bSessionKeyIndexBuilt = false;
+};
+
+using FSikSessionSearchSnapshotRef = TSharedRef<const FSikSessionSearchSnapshot>;
+using FSikSessionSearchSnapshotPtr = TSharedPtr<const FSikSessionSearchSnapshot>;
+
+/**
+ * One session of a search, by index into the snapshot it was found in
+ * Keeps the snapshot alive, so a handle held by a widget stays valid after later searches replace it
+ ******************************************************************************************/
+struct FSikSessionHandle
+{
+	FSikSessionHandle() = default;
+
+	FSikSessionHandle(const FSikSessionSearchSnapshotRef& InSnapshot, const int32 InIndex) : Snapshot(InSnapshot), Index(InIndex) {}
+
+	/** @returns true if the handle points to a session */
+	bool IsValid() const { return Snapshot.IsValid() && Snapshot->GetResults().IsValidIndex(Index); }
+
+	/** @returns the session, nullptr if the handle is invalid */
+	const FOnlineSessionSearchResult* Get() const { return IsValid() ? &Snapshot->GetResults()[Index] : nullptr; }
+
+	/** Only on a valid handle */
+	const FOnlineSessionSearchResult& operator*() const { check(IsValid()); return Snapshot->GetResults()[Index]; }
+	const FOnlineSessionSearchResult* operator->() const { check(IsValid()); return &Snapshot->GetResults()[Index]; }
+
+	/** @returns the generation of the snapshot, 0 if the handle is invalid */
+	uint32 GetGeneration() const { return Snapshot.IsValid() ? Snapshot->GetGeneration() : 0; }
+
+private:
+	FSikSessionSearchSnapshotPtr Snapshot;
+
+	int32 Index = INDEX_NONE;
+};
+
+inline FSikSessionHandle FSikSessionSearchSnapshot::GetHandle(const int32 InIndex) const
+{
+	return Results.IsValidIndex(InIndex) ? FSikSessionHandle(AsShared(), InIndex) : FSikSessionHandle();
+}
+
+inline FSikSessionHandle FSikSessionSearchSnapshot::FindBySessionKey(const FString& InSessionKey) const
+{
+	if (!bSessionKeyIndexBuilt)
+	{
+		bSessionKeyIndexBuilt = true;
+		SessionKeyIndex.Reserve(Results.Num());
+		
+		FString SessionKey;
+		for (int32 Index = 0; Index < Results.Num(); ++Index)
+		{
+			if (Results[Index].Session.SessionSettings.Get(SETTING_SESSIONKEY, SessionKey))
+			{
+				SessionKeyIndex.FindOrAdd(SessionKey, Index);
+			}
+		}
+	}
+	
+	const int32* Index = SessionKeyIndex.Find(InSessionKey);
+	return Index ? GetHandle(*Index) : FSikSessionHandle();
+}
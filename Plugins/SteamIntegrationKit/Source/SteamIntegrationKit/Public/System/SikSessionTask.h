@@ -0,0 +1,161 @@
+﻿// Copyright (c) 2025 The Unreal Guy. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Engine/TimerHandle.h"
+#include "Interfaces/OnlineSessionInterface.h"
+#include "OnlineSessionSettings.h"
+#include "System/SikSessionSnapshot.h"
+#include "SikSessionTask.generated.h"
+
+/** Session operations USikSubsystem runs one at a time, in the order they were requested */
+UENUM(BlueprintType)
+enum class ESikSessionOperation : uint8
+{
+	None,
+	Create,
+	Destroy,
+	Join,
+	Start
+};
+
+/** How a requested session operation ended */
+UENUM(BlueprintType)
+enum class ESikSessionOperationResult : uint8
+{
+	Succeeded,
+	Failed,
+	/** Merged into a later request of the same kind, that request reports the actual outcome */
+	Coalesced,
+	/** Dropped before running because of a later conflicting request or shutdown */
+	Cancelled,
+	/** Backend did not call back within the timeout of the awaiting FSikSessionTaskHandle */
+	TimedOut
+};
+
+/**
+ * Outcome of an awaited session operation, only the fields of the awaited operation are filled
+ ******************************************************************************************/
+struct FSikSessionTaskResult
+{
+	/** How the operation ended */
+	ESikSessionOperationResult Result = ESikSessionOperationResult::Failed;
+
+	/** Result reported by the backend, Join only */
+	EOnJoinSessionCompleteResult::Type JoinResult = EOnJoinSessionCompleteResult::UnknownError;
+
+	/** Session found, FindSessionByCode only */
+	FOnlineSessionSearchResult SessionResult;
+
+	/** Sessions found, shared with the session browser rather than copied, FindSessions only */
+	FSikSessionSearchSnapshotPtr SearchSnapshot;
+
+	/** @returns true if the operation succeeded */
+	bool WasSuccessful() const { return Result == ESikSessionOperationResult::Succeeded; }
+};
+
+/**
+ * Pending outcome of one session operation started through the Async functions of USikSubsystem
+ * Completed exactly once, by the operation itself, its timeout or Cancel, whichever comes first
+ * Everything runs on the game thread, continuations are called from the completing backend callback
+ ******************************************************************************************/
+class STEAMINTEGRATIONKIT_API FSikSessionTask : public TSharedFromThis<FSikSessionTask>
+{
+public:
+	explicit FSikSessionTask(const FString& InDescription);
+
+	/** Name of the awaited operation, used in logs */
+	const FString& GetDescription() const { return Description; }
+
+	/** @returns true once the result is set */
+	bool IsComplete() const { return bIsComplete; }
+
+	/** Future of the result, never block the game thread on it, the result is set there */
+	TSharedFuture<FSikSessionTaskResult> GetFuture() const { return Future; }
+
+	/**
+	 * Sets the result and runs the continuations, does nothing if the task is already complete
+	 * 
+	 * @param InResult: Outcome of the operation
+	 * @return true if this call completed the task
+	 */
+	bool Complete(const FSikSessionTaskResult& InResult);
+
+	/** Shortcut of Complete for outcomes without any payload */
+	bool Complete(ESikSessionOperationResult InResult);
+
+	/**
+	 * Stops the awaited operation and completes the task with the given result
+	 * Operations still waiting in the queue are dropped, running ones are abandoned on timeout and detached otherwise
+	 * 
+	 * @param InResult: Cancelled or TimedOut
+	 */
+	void Abort(ESikSessionOperationResult InResult);
+
+	/** Runs the continuation once the task completes, right away if it already has */
+	void AddContinuation(TFunction<void(const FSikSessionTaskResult&)>&& InContinuation);
+
+	/** Set by whoever runs the operation, called by Abort before the task is completed */
+	TFunction<void(ESikSessionOperationResult)> OnAbort;
+
+	/** Timer completing the task with TimedOut */
+	FTimerHandle TimeoutTimerHandle;
+
+private:
+	FString Description;
+
+	bool bIsComplete = false;
+
+	TPromise<FSikSessionTaskResult> Promise;
+	TSharedFuture<FSikSessionTaskResult> Future;
+
+	TArray<TFunction<void(const FSikSessionTaskResult&)>> Continuations;
+};
+
+/**
+ * Handle to an awaited session operation, returned by USikSubsystem::CreateSessionAsync and friends
+ * 
+ * Operations are queued by the subsystem, so steps can be requested back to back without waiting on each other,
+ * or chained with Then when a step needs the result of the one before
+ * 
+ *		Subsystem->CreateSessionAsync(Settings)
+ *			.Then([Subsystem](const FSikSessionTaskResult&) { return Subsystem->StartSessionAsync(); })
+ *			.OnComplete([](const FSikSessionTaskResult& Result) { ... travel ... });
+ ******************************************************************************************/
+struct STEAMINTEGRATIONKIT_API FSikSessionTaskHandle
+{
+	FSikSessionTaskHandle() = default;
+	explicit FSikSessionTaskHandle(const TSharedRef<FSikSessionTask>& InTask) : Task(InTask) {}
+
+	/** @returns true if the handle points to a task */
+	bool IsValid() const { return Task.IsValid(); }
+
+	/** @returns true once the awaited operation has an outcome */
+	bool IsComplete() const { return Task.IsValid() && Task->IsComplete(); }
+
+	/** Future of the result, poll it with IsReady, never Wait on it from the game thread */
+	TSharedFuture<FSikSessionTaskResult> GetFuture() const;
+
+	/** Stops waiting, the task completes with Cancelled unless it already has an outcome */
+	void Cancel() const;
+
+	/**
+	 * Runs the callback once the operation completes, right away if it already has
+	 * 
+	 * @return this handle, so calls can be chained
+	 */
+	const FSikSessionTaskHandle& OnComplete(TFunction<void(const FSikSessionTaskResult&)>&& InCallback) const;
+
+	/**
+	 * Starts the next step once this one completes, the step is skipped if this one did not succeed
+	 * 
+	 * @param InNextStep: Starts the next operation and returns its handle, an invalid handle ends the chain with this result
+	 * @return handle completing with the last step, cancelling it cancels whichever step is running
+	 */
+	FSikSessionTaskHandle Then(TFunction<FSikSessionTaskHandle(const FSikSessionTaskResult&)>&& InNextStep) const;
+
+	/** Task the handle points to */
+	TSharedPtr<FSikSessionTask> Task;
+};
@@ -9,6 +9,7 @@
 #include "SikHudWidget.generated.h"
 
 class USikSessionDataWidget;
+class UScrollBox;
 
 /**
  * Hud class implements the multiplayer sessions subsystem
@@ -36,14 +37,50 @@ private:
 	
 	/**
 	 * Called when user enters any session code he wishes to join
-	 * Function requests the SikSubsystem to find all the active session
-	 * Then it checks if any session is hosted with the entered code and then requests to join it 
+	 * Function requests the SikSubsystem to look up the session hosted with the entered code
+	 * Then joins it in OnSessionFoundByCodeCallback
 	 * 
 	 * @param InSessionCode: Session code entered by the user
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SikHud")
 	void EnterCode(const FText& InSessionCode);
 
+	/**
+	 * Called when the user toggles between online and LAN sessions, see USikSubsystem::SetLanMode
+	 * The open session list is cleared and filled from the new backend
+	 * 
+	 * @param bInLanMode: True to host and find sessions on the local network
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SikHud")
+	void SetLanMode(bool bInLanMode);
+
+	/**
+	 * Called when the user presses quick match, joins the best session matching the filter or hosts one if none fits
+	 * in time, see USikSubsystem::QuickMatch
+	 * 
+	 * @param InFilter: Sessions to consider, fields left empty or at "Any" accept every value
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SikHud")
+	void QuickMatch(const FSikCustomSessionSettings& InFilter);
+
+	/** Called when the user stops the running quick match */
+	UFUNCTION(BlueprintCallable, Category = "SikHud")
+	void CancelQuickMatch();
+
+	/**
+	 * Called when the user queues for a match, see USikSubsystem::StartMatchmaking
+	 * 
+	 * @param InRegion: Region of the player, only players of the same region are matched
+	 * @param InSkill: Skill rating of the player
+	 * @param InPreferences: Preferred settings, fields left empty accept every value
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SikHud")
+	void StartMatchmaking(const FString& InRegion, int32 InSkill, const FSikCustomSessionSettings& InPreferences);
+
+	/** Called when the user leaves the matchmaking queue */
+	UFUNCTION(BlueprintCallable, Category = "SikHud")
+	void CancelMatchmaking();
+
 #pragma endregion Core Functions
 	
 #pragma region Subsystem Callbacks
@@ -60,10 +97,19 @@ private:
 	/**
 	 * Callback from subsystem binding after completing finding sessions operation
 	 *
-	 * @param SessionResults: True if session creation was successful
+	 * @param SessionResults: Sessions found, shared with the subsystem
 	 * @param bWasSuccessful: True when the operation was successful
 	 */
-	void OnSessionsFoundCallback(const TArray<FOnlineSessionSearchResult>& SessionResults, bool bWasSuccessful);
+	void OnSessionsFoundCallback(const FSikSessionSearchSnapshotRef& SessionResults, bool bWasSuccessful);
+
+	/**
+	 * Callback from subsystem binding after completing the session code lookup
+	 * Joins the found session if the lookup was successful, lookups of the matchmaking are left to it
+	 *
+	 * @param SessionResult: The session hosted with the entered code
+	 * @param bWasSuccessful: True when a session with the entered code was found
+	 */
+	void OnSessionFoundByCodeCallback(const FOnlineSessionSearchResult& SessionResult, bool bWasSuccessful);
 
 	/**
 	 * Callback from subsystem binding after completing session joining operation
@@ -72,23 +118,33 @@ private:
 	 */
 	void OnSessionJoinedCallback(EOnJoinSessionCompleteResult::Type Result);
 
+	/**
+	 * Callback from subsystem binding once the quick match or the matchmaking has joined or hosted a session
+	 * Travels like a join or a host would
+	 *
+	 * @param Result: How the quick match or the matchmaking ended
+	 */
+	UFUNCTION()
+	void OnMatchCompleteCallback(ESikMatchResult Result);
+
 #pragma endregion Subsystem Callbacks
 
 #pragma region Defaults
 	
 private:
-	/**
-	 * When sessions are found by SikSubsystem this function is called if player has requested to join the session via code
-	 * This function then filters the result and checks is a session exists with given session code and joins it
-	 * 
-	 * @param SessionSearchResults 
-	 */
-	void JoinSessionViaSessionCode(const TArray<FOnlineSessionSearchResult>& SessionSearchResults);
-	
-	/** Updates the active session list if there is any change in active sessions */
-	void UpdateSessionsList(const TArray<FOnlineSessionSearchResult>& Results);
+	/** Updates the active session list if there is any change in active sessions, widgets are handed handles into the snapshot */
+	void UpdateSessionsList(const FSikSessionSearchSnapshotRef& Results);
 	
-	/** Called by UpdateSessionsList after update of list is completed to find new sessions */
+	/** 
+	 * Orders the session widgets by the latency to their host, lowest first, and shows the latency on each
+	 * The scroll box is refilled only when the order changes
+	 */
+	void RankSessionsList();
+
+	/** Callback from subsystem binding once the latencies of the listed hosts have been measured, re-ranks the list */
+	void OnSessionLatenciesUpdatedCallback();
+
+	/** Called by UpdateSessionsList after update of list is completed to keep the subsystem polling with the current filter */
 	void FindNewSessionsIfAllowed();
 
 	/**
@@ -105,10 +161,17 @@ private:
 	UPROPERTY()
 	TObjectPtr<USikSubsystem> SikSubsystem;
 
-	/** Path to the lobby map, we will travel to this map after creating a session successfully */
+	/** 
+	 * Path to the lobby map, we will travel to this map after creating a session successfully
+	 * Preloaded as soon as the player hosts or joins, see USikSubsystem::PreloadTravelMaps
+	 */
 	UPROPERTY(EditDefaultsOnly, Category = "Defaults")
 	FString LobbyMapPath = FString("");
 
+	/** Seconds the quick match looks for a session to join before hosting one */
+	UPROPERTY(EditDefaultsOnly, Category = "Defaults")
+	float QuickMatchDeadline = 10.f;
+
 	/** Called when player opens the browse menu to start finding session only when browse menu is open */
 	UFUNCTION(BlueprintCallable, Category = "Defaults")
 	void StartFindingSessions();
@@ -117,18 +180,34 @@ private:
 	UFUNCTION(BlueprintCallable, Category = "Defaults")
 	void StopFindingSessions();
 	
+	/** 
+	 * Called when the sessions scroll box is scrolled to its end to list more sessions, does nothing once all are listed
+	 * Runs the whole search again with a larger limit, see USikSubsystem::RequestMoreSessionResults
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Defaults")
+	void LoadMoreSessions();
+	
 	/** Flag that allows to find sessions only when browse menu is open */
 	bool bCanFindNewSessions = false;
 	
-	/** True when user has requested to join via session code */
-	bool bJoinSessionViaCode = false;
-
 	/** The session code that user wishes to join */
 	FString SessionCodeToJoin = "";
 
 	/** Widget class to add to the session data scroll box */
 	UPROPERTY(EditDefaultsOnly, Category = "Defaults")
 	TSubclassOf<USikSessionDataWidget> SessionDataWidgetClass;
+
+	/** Scroll box the session data widgets are added to, scrolling it to its end calls LoadMoreSessions */
+	UPROPERTY(meta = (BindWidgetOptional))
+	TObjectPtr<UScrollBox> SessionsScrollBox;
+
+	/** Distance from the end of SessionsScrollBox, in slate units, at which more sessions are requested */
+	UPROPERTY(EditDefaultsOnly, Category = "Defaults")
+	float LoadMoreScrollThreshold = 100.f;
+
+	/** Bound to SessionsScrollBox, requests more sessions once the list is scrolled close to its end */
+	UFUNCTION()
+	void OnSessionsScrolled(float CurrentOffset);
 	
 	UPROPERTY()
 	TMap<FString, USikSessionDataWidget*> ActiveSessionWidgets;
@@ -139,6 +218,9 @@ private:
 	 * sessions which has no change
 	 */
 	TSet<FString> LastSessionKeys;
+
+	/** Session keys in the order their widgets are shown in the scroll box */
+	TArray<FString> DisplayedSessionOrder;
 	
 	/** Getter for SikSubsystem */
 	TObjectPtr<USikSubsystem> GetSikSubsystem();
@@ -149,7 +231,7 @@ public:
 	 *
 	 * @paran InSessionToJoin: The session user wishes to join
 	 */
-	void JoinTheGivenSession(FOnlineSessionSearchResult& InSessionToJoin);
+	void JoinTheGivenSession(const FSikSessionHandle& InSessionToJoin);
 
 #pragma endregion Defaults
 	
@@ -10,6 +10,8 @@
 class UHorizontalBox;
 class UTextBlock;
 class UButton;
+class ASikLobbyGameState;
+class ASikLobbyPlayerState;
 
 /**
  * Lobby widget shown after joining the lobby map.
@@ -18,6 +20,7 @@ class UButton;
  *      * Sees session code
  *      * Sees Start button (disabled until lobby full)
  *      * Clicking Start → calls USikSubsystem::StartSession()
+ *      * Tells every lobby member to prefetch the selected map, and sees how many have it ready
  * 
  * - Client:
  *      * Sees session code only (no Start button / disabled)
@@ -68,6 +71,10 @@ private:
 	UPROPERTY(meta = (BindWidget))
 	TObjectPtr<UUserWidget> StartGameButton;
 
+	/** Displays how many lobby members have the selected map loaded (host only) */
+	UPROPERTY(meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> MapPrefetchText;
+
 #pragma endregion Components
     
 #pragma region Bindings
@@ -85,6 +92,9 @@ private:
 	UFUNCTION()
 	void OnSessionStartedCallback(bool bWasSuccessful);
 
+	/** Refreshes the map prefetch text whenever a lobby member reports progress */
+	void OnMapPrefetchChanged(const ASikLobbyPlayerState* PlayerState);
+
 #pragma endregion Bindings
     
 #pragma region Defaults
@@ -106,6 +116,12 @@ private:
     
 	/** Getter for SikSubsystem */
 	TObjectPtr<USikSubsystem> GetSikSubsystem();
+
+	/** Returns the lobby game state, null if the lobby map uses another game state */
+	ASikLobbyGameState* GetLobbyGameState() const;
+
+	/** Tells the lobby to prefetch the selected map, host only */
+	void PrefetchSelectedMap();
     
 #pragma endregion Defaults
     
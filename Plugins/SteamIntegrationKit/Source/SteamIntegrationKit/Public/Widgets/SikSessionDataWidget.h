@@ -4,7 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
-#include "OnlineSessionSettings.h"
+#include "System/SikSessionSnapshot.h"
 #include "SikSessionDataWidget.generated.h"
 
 struct FSikCustomSessionSettings;
@@ -40,6 +40,10 @@ private:
 	UPROPERTY(meta = (BindWidget))
 	TObjectPtr<UTextBlock> GameMode;
 
+	/** Text to show the latency to the host, optional */
+	UPROPERTY(meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> Ping;
+
 	/** Button to let user join this session */
 	UPROPERTY(meta = (BindWidget))
 	TObjectPtr<UButton> JoinSessionButton;
@@ -61,8 +65,8 @@ private:
 	/** Ref to the main menu widget set via setter, for when user joins this session we can call the main menu widget to join this session */
 	TWeakObjectPtr<USikHudWidget> SikHudWidget;
 	
-	/** Stores the session search result for this widget */
-	FOnlineSessionSearchResult SessionSearchResult;
+	/** Session this widget shows, the search result itself stays in the snapshot of the subsystem */
+	FSikSessionHandle SessionHandle;
 
 #pragma endregion CachedData
 	
@@ -70,12 +74,22 @@ private:
 	
 public:
 	/** Called from USikHudWidget::AddSessionSearchResultsToScrollBox upon adding this widget to the scroll box to fill it with necessary information */
-	void SetSessionInfo(const FOnlineSessionSearchResult& InSessionSearchResultRef, 
-		const FSikCustomSessionSettings& SessionSettings);
+	void SetSessionInfo(const FSikSessionHandle& InSessionHandle, const FSikCustomSessionSettings& SessionSettings);
 
 	/** Called from USikHudWidget::AddSessionSearchResultsToScrollBox upon adding this widget to the scroll box to set the ref to main menu widget */
 	void SetSikHudWidget(USikHudWidget* InSikHUDWidget);
+
+	/** Called from USikHudWidget::RankSessionsList to show the latency to the host, negative if it is not measured */
+	void SetPing(int32 InPingInMs);
 	
 #pragma endregion Setters
+
+#pragma region Getters
+
+public:
+	/** @returns the session this widget shows */
+	const FSikSessionHandle& GetSessionHandle() const { return SessionHandle; }
+
+#pragma endregion Getters
 	
 };
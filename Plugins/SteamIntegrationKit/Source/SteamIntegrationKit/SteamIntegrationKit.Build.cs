@@ -14,16 +14,28 @@ public class SteamIntegrationKit : ModuleRules
 				"Core",
 				"CoreUObject",
 				"Engine",
+				"EngineSettings",
 				"UMG",
 				"Slate",
 				"SlateCore",
 				"Networking",
+				"Sockets",
 				"InputCore",
+				"Json",
 				"NetCore", 
 				"OnlineSubsystem", 
 				"OnlineSubsystemSteam",
 				"OnlineSubsystemUtils"
 			}
 		);
+
+		// Steam relay ping locations, see FSikSteamPingLocation, only where the Steamworks SDK ships
+		bool bWithSteamworks = Target.Platform == UnrealTargetPlatform.Win64 || Target.Platform == UnrealTargetPlatform.Linux ||
+			Target.Platform == UnrealTargetPlatform.Mac;
+		if (bWithSteamworks)
+		{
+			AddEngineThirdPartyPrivateStaticDependencies(Target, "Steamworks");
+		}
+		PrivateDefinitions.Add("WITH_SIK_STEAMWORKS=" + (bWithSteamworks ? "1" : "0"));
 	}
 }